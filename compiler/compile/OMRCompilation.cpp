@@ -49,6 +49,7 @@
 #include "env/ObjectModel.hpp"                 // for ObjectModel
 #include "env/KnownObjectTable.hpp"            // for KnownObjectTable
 #include "env/PersistentInfo.hpp"              // for PersistentInfo
+#include "env/SegmentPool.hpp"                 // for SegmentPool
 #include "env/StackMemoryRegion.hpp"
 #include "env/TRMemory.hpp"                    // for TR_Memory, etc
 #include "env/defines.h"                       // for TR_HOST_X86
@@ -318,9 +319,11 @@ OMR::Compilation::Compilation(
    _gpuPtxCount(0),
    _scratchSpaceLimit(TR::Options::_scratchSpaceLimit),
    _cpuTimeAtStartOfCompilation(-1),
+   _scratchSegmentPool(NULL),
    _bitVectorPool(self()),
    _tlsManager(*self())
    {
+   memset(_peakScratchBytes, 0, sizeof(_peakScratchBytes));
    _aotClassInfo = new (m->trHeapMemory()) TR::list<TR::AOTClassInfo*>(getTypedAllocator<TR::AOTClassInfo*>(self()->allocator()));
 
    if (TR::isJ9())
@@ -853,6 +856,7 @@ int32_t OMR::Compilation::compile()
      if (printCodegenTime) genILTime.startTiming(self());
      _ilGenSuccess = _methodSymbol->genIL(self()->fe(), self(), self()->getSymRefTab(), _ilGenRequest);
      if (printCodegenTime) genILTime.stopTiming(self());
+     self()->recordScratchMemoryPhase(ILGenScratchMemory);
    }
 
    // Force a crash during compilation if the crashDuringCompile option is set
@@ -906,6 +910,7 @@ int32_t OMR::Compilation::compile()
       optRtn = self()->performOptimizations();
 
       self()->printMemStatsAfter("optimization");
+      self()->recordScratchMemoryPhase(OptimizationScratchMemory);
 
       if (printCodegenTime) optTime.stopTiming(self());
 
@@ -937,6 +942,7 @@ int32_t OMR::Compilation::compile()
            cgRtn = self()->cg()->generateCode();
 
            self()->printMemStatsAfter("all codegen");
+           self()->recordScratchMemoryPhase(CodeGenScratchMemory);
 
            if (printCodegenTime) codegenTime.stopTiming(self());
          }
@@ -2310,6 +2316,24 @@ void OMR::Compilation::printMemStatsAfter(const char *name)
    {
    }
 
+void
+OMR::Compilation::setScratchSegmentPool(TR::SegmentPool *pool)
+   {
+   _scratchSegmentPool = pool;
+   if (_scratchSegmentPool)
+      _scratchSegmentPool->resetPeakBytesInUse();
+   }
+
+void
+OMR::Compilation::recordScratchMemoryPhase(ScratchMemoryPhase phase)
+   {
+   if (_scratchSegmentPool)
+      {
+      _peakScratchBytes[phase] = _scratchSegmentPool->peakBytesInUse();
+      _scratchSegmentPool->resetPeakBytesInUse();
+      }
+   }
+
 bool
 OMR::Compilation::isPICSite(TR::Instruction *instruction)
    {
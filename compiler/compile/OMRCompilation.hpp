@@ -103,6 +103,7 @@ namespace TR { class Optimizer; }
 namespace TR { class Recompilation; }
 namespace TR { class RegisterMappedSymbol; }
 namespace TR { class ResolvedMethodSymbol; }
+namespace TR { class SegmentPool; }
 namespace TR { class Symbol; }
 namespace TR { class SymbolReference; }
 namespace TR { class SymbolReferenceTable; }
@@ -894,6 +895,23 @@ public:
 
    void printMemStatsAfter(const char *name);
 
+   enum ScratchMemoryPhase
+      {
+      ILGenScratchMemory,
+      OptimizationScratchMemory,
+      CodeGenScratchMemory,
+      NumScratchMemoryPhases
+      };
+
+   // The pool the scratch memory of this compilation comes from, when the
+   // caller keeps one; used to measure the peak scratch memory of each phase.
+   // Setting it starts the ilgen peak from what is in use now, not from the
+   // peak of an earlier compilation using the same pool.
+   void setScratchSegmentPool(TR::SegmentPool *pool);
+   TR::SegmentPool *getScratchSegmentPool() { return _scratchSegmentPool; }
+   size_t getPeakScratchBytes(ScratchMemoryPhase phase) { return _peakScratchBytes[phase]; }
+   void recordScratchMemoryPhase(ScratchMemoryPhase phase);
+
    TR::ResolvedMethodSymbol *createJittedMethodSymbol(TR_ResolvedMethod *resolvedMethod);
 
    bool isGPUCompilation() { return _flags.testAny(IsGPUCompilation);}
@@ -1187,6 +1205,9 @@ private:
    size_t                            _scratchSpaceLimit;
    int64_t                           _cpuTimeAtStartOfCompilation;
 
+   TR::SegmentPool                  *_scratchSegmentPool;
+   size_t                            _peakScratchBytes[NumScratchMemoryPhases];
+
    int32_t _gpuBlockDimX;
    void * _gpuParms;
    ListHeadAndTail<char*> _gpuPtxList;
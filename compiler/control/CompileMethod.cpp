@@ -46,10 +46,73 @@
 #include "ilgen/IlGenRequest.hpp"              // for CompileIlGenRequest
 #include "ilgen/IlGeneratorMethodDetails.hpp"
 #include "infra/Assert.hpp"                    // for TR_ASSERT
+#include "infra/ThreadLocal.h"                 // for tlsDefine, tlsGet, tlsSet
 #include "ras/Debug.hpp"                       // for createDebugObject, etc
 #include "omr.h"
+#include "env/SegmentPool.hpp"
 #include "env/SystemSegmentProvider.hpp"
 
+#define SCRATCH_SEGMENT_SIZE      (1 << 16)
+#define SCRATCH_SEGMENT_POOL_SIZE 256        // keep at most 16MB of scratch segments per thread
+
+// The scratch memory segments of each compiling thread are kept across its
+// compilations, rather than each compilation allocating and freeing all of its
+// scratch memory. After each compilation the pool is trimmed down to what that
+// compilation needed at its high water mark, so that a single large compilation
+// does not keep its memory for the life of the thread.
+//
+struct ScratchSegmentPool
+   {
+   ScratchSegmentPool(TR::RawAllocator rawAllocator) :
+      _systemSegmentProvider(SCRATCH_SEGMENT_SIZE, rawAllocator),
+      _segmentPool(_systemSegmentProvider, SCRATCH_SEGMENT_POOL_SIZE, rawAllocator)
+      {
+      }
+
+   TR::SystemSegmentProvider _systemSegmentProvider;
+   TR::SegmentPool _segmentPool;
+   };
+
+tlsDefine(ScratchSegmentPool *, threadScratchSegmentPool);
+
+static TR::SegmentPool &
+getScratchSegmentPool()
+   {
+   ScratchSegmentPool *pool = tlsGet(threadScratchSegmentPool, ScratchSegmentPool *);
+   if (!pool)
+      {
+      TR::RawAllocator rawAllocator;
+      pool = new (rawAllocator) ScratchSegmentPool(rawAllocator);
+      tlsSet(threadScratchSegmentPool, pool);
+      }
+   return pool->_segmentPool;
+   }
+
+void
+releaseScratchSegmentPool()
+   {
+   ScratchSegmentPool *pool = tlsGet(threadScratchSegmentPool, ScratchSegmentPool *);
+   if (pool)
+      {
+      TR::RawAllocator rawAllocator;
+      pool->~ScratchSegmentPool();
+      rawAllocator.deallocate(pool);
+      tlsSet(threadScratchSegmentPool, NULL);
+      }
+   }
+
+// Trims the pool once the scratch memory of a compilation has been released
+//
+class ScratchSegmentPoolTrimmer
+   {
+public:
+   ScratchSegmentPoolTrimmer(TR::SegmentPool &pool) : _pool(pool) {}
+   ~ScratchSegmentPoolTrimmer() { _pool.trim(); }
+
+private:
+   TR::SegmentPool &_pool;
+   };
+
 static void
 writePerfToolEntry(void *start, uint32_t size, const char *name)
    {
@@ -135,6 +198,7 @@ int32_t commonJitInit(OMR::FrontEnd &fe, char *cmdLineOptions)
    TR::Options::setCanJITCompile(true);
    TR::Options::getCmdLineOptions()->setOption(TR_NoRecompile);
    TR::CompilationController::init(NULL);
+   tlsAlloc(threadScratchSegmentPool);
 
    void *pseudoTOC = NULL;
 #if defined(TR_TARGET_POWER)
@@ -237,8 +301,9 @@ compileMethodFromDetails(
    OMR::FrontEnd &fe = OMR::FrontEnd::singleton();
    auto jitConfig = fe.jitConfig();
    TR::RawAllocator rawAllocator;
-   TR::SystemSegmentProvider scratchSegmentProvider(1 << 16, rawAllocator);
-   TR::Region dispatchRegion(scratchSegmentProvider, rawAllocator);
+   TR::SegmentPool &scratchSegmentPool = getScratchSegmentPool();
+   ScratchSegmentPoolTrimmer trimScratchSegmentPool(scratchSegmentPool); // must be destroyed after dispatchRegion
+   TR::Region dispatchRegion(scratchSegmentPool, rawAllocator);
    TR_Memory trMemory(*fe.persistentMemory(), dispatchRegion);
    TR_ResolvedMethod & compilee = *((TR_ResolvedMethod *)details.getMethod());
 
@@ -293,6 +358,7 @@ compileMethodFromDetails(
       TR_ASSERT(TR::comp() == NULL, "there seems to be a current TLS TR::Compilation object %p for this thread. At this point there should be no current TR::Compilation object", TR::comp());
       TR::Compilation compiler(0, omrVMThread, &fe, &compilee, request, *options, dispatchRegion, &trMemory, plan);
       TR_ASSERT(TR::comp() == &compiler, "the TLS TR::Compilation object %p for this thread does not match the one %p just created.", TR::comp(), &compiler);
+      compiler.setScratchSegmentPool(&scratchSegmentPool);
 
       try
          {
@@ -329,6 +395,18 @@ compileMethodFromDetails(
          translationTime = TR::Compiler->vm.getUSecClock() - translationTime;
          totalCompilationTime+=translationTime;
 
+         if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseJitMemory))
+            {
+            TR_VerboseLog::writeLineLocked(TR_Vlog_MEMORY,"scratch peak KB: ilgen=%llu opt=%llu codegen=%llu; thread pool KB=%llu, segments recycled=%llu allocated=%llu; %s",
+                                           (unsigned long long)(compiler.getPeakScratchBytes(TR::Compilation::ILGenScratchMemory) >> 10),
+                                           (unsigned long long)(compiler.getPeakScratchBytes(TR::Compilation::OptimizationScratchMemory) >> 10),
+                                           (unsigned long long)(compiler.getPeakScratchBytes(TR::Compilation::CodeGenScratchMemory) >> 10),
+                                           (unsigned long long)(scratchSegmentPool.bytesPooled() >> 10),
+                                           (unsigned long long)scratchSegmentPool.segmentsRecycled(),
+                                           (unsigned long long)scratchSegmentPool.segmentsRequested(),
+                                           compiler.signature());
+            }
+
          if (rc == 0) // success!
             {
 
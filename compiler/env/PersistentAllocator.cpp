@@ -18,25 +18,393 @@
 
 #include "env/PersistentAllocator.hpp"
 
+#include <string.h>
+#include "infra/Assert.hpp"
+
+#define SLAB_SIZE (64 * 1024)
+#define THREAD_CACHE_REFILL_COUNT 16                               // blocks moved to or from a thread cache at a time
+#define THREAD_CACHE_LIMIT (4 * THREAD_CACHE_REFILL_COUNT)         // free blocks a thread cache keeps per size class
+
+// Every allocation is preceded by a header, sized to keep the allocation
+// aligned as malloc would. A free block reuses the header as its link.
+//
+struct OMR::PersistentAllocator::Block
+   {
+   union
+      {
+      struct
+         {
+         size_t _size;         // bytes requested
+         uint32_t _category;
+         uint32_t _sizeClass;  // NUM_SIZE_CLASSES for a large allocation
+         } _header;
+      Block *_next;
+      double _align[2];
+      };
+   };
+
+#define BLOCK_HEADER_SIZE (sizeof(OMR::PersistentAllocator::Block))
+#define LARGE_SIZE_CLASS  NUM_SIZE_CLASSES
+
+struct OMR::PersistentAllocator::ThreadCache
+   {
+   PersistentAllocator *_owner;
+   ThreadCache *_next;
+   Block *_freeLists[NUM_SIZE_CLASSES];
+   uint32_t _freeCounts[NUM_SIZE_CLASSES];
+   CategoryStatistics _statistics[NUM_CATEGORIES];
+   };
+
+static inline size_t
+blockSize(uint32_t sizeClass)
+   {
+   return (sizeClass + 1) * OMR::PersistentAllocator::SIZE_CLASS_GRANULE;
+   }
+
 OMR::PersistentAllocator::PersistentAllocator(const TR::PersistentAllocatorKit &allocatorKit) :
-   _rawAllocator(allocatorKit.rawAllocator)
+   _rawAllocator(allocatorKit.rawAllocator),
+   _slabAlloc(NULL),
+   _slabTop(NULL),
+   _slabs(NULL),
+   _slabBytes(0),
+   _threadCaches(NULL)
+   {
+   MUTEX_INIT(_mutex);
+   memset(_freeLists, 0, sizeof(_freeLists));
+   memset(_statistics, 0, sizeof(_statistics));
+#if defined(PERSISTENT_ALLOCATOR_THREAD_CACHES)
+   // Without a key every allocation takes the lock
+   _threadCacheKeyCreated = (0 == pthread_key_create(&_threadCacheKey, releaseCacheAtThreadExit));
+#endif
+   }
+
+OMR::PersistentAllocator::~PersistentAllocator() throw()
+   {
+#if defined(PERSISTENT_ALLOCATOR_THREAD_CACHES)
+   // No more exit callbacks for the caches freed below
+   if (_threadCacheKeyCreated)
+      pthread_key_delete(_threadCacheKey);
+#endif
+
+   while (_threadCaches)
+      {
+      ThreadCache *cache = _threadCaches;
+      _threadCaches = cache->_next;
+      _rawAllocator.deallocate(cache);
+      }
+
+   while (_slabs)
+      {
+      Block *slab = _slabs;
+      _slabs = slab->_next;
+      _rawAllocator.deallocate(slab);
+      }
+
+   MUTEX_DESTROY(_mutex);
+   }
+
+OMR::PersistentAllocator::ThreadCache *
+OMR::PersistentAllocator::getThreadCache() throw()
    {
+#if defined(PERSISTENT_ALLOCATOR_THREAD_CACHES)
+   if (!_threadCacheKeyCreated)
+      return NULL;
+
+   ThreadCache *cache = static_cast<ThreadCache *>(pthread_getspecific(_threadCacheKey));
+   if (cache)
+      return cache;
+
+   cache = static_cast<ThreadCache *>(_rawAllocator.allocate(sizeof(ThreadCache), std::nothrow));
+   if (!cache)
+      return NULL;
+   memset(cache, 0, sizeof(ThreadCache));
+   cache->_owner = this;
+   if (0 != pthread_setspecific(_threadCacheKey, cache))
+      {
+      _rawAllocator.deallocate(cache);
+      return NULL;
+      }
+
+   MUTEX_ENTER(_mutex);
+   cache->_next = _threadCaches;
+   _threadCaches = cache;
+   MUTEX_EXIT(_mutex);
+
+   return cache;
+#else
+   return NULL;
+#endif
+   }
+
+void
+OMR::PersistentAllocator::releaseThreadCache() throw()
+   {
+#if defined(PERSISTENT_ALLOCATOR_THREAD_CACHES)
+   if (!_threadCacheKeyCreated)
+      return;
+
+   ThreadCache *cache = static_cast<ThreadCache *>(pthread_getspecific(_threadCacheKey));
+   if (!cache)
+      return;
+
+   pthread_setspecific(_threadCacheKey, NULL);
+   releaseCache(cache);
+#endif
+   }
+
+// Called by pthreads when a thread with a cache exits
+//
+void
+OMR::PersistentAllocator::releaseCacheAtThreadExit(void *cache)
+   {
+   ThreadCache *threadCache = static_cast<ThreadCache *>(cache);
+   threadCache->_owner->releaseCache(threadCache);
+   }
+
+// Return the blocks and statistics of a cache no longer associated with a
+// thread to the allocator, and free it
+//
+void
+OMR::PersistentAllocator::releaseCache(ThreadCache *cache) throw()
+   {
+   MUTEX_ENTER(_mutex);
+   for (uint32_t c = 0; c < NUM_SIZE_CLASSES; c++)
+      {
+      while (cache->_freeLists[c])
+         {
+         Block *block = cache->_freeLists[c];
+         cache->_freeLists[c] = block->_next;
+         block->_next = _freeLists[c];
+         _freeLists[c] = block;
+         }
+      }
+   for (uint32_t i = 0; i < NUM_CATEGORIES; i++)
+      {
+      _statistics[i]._allocations += cache->_statistics[i]._allocations;
+      _statistics[i]._bytes += cache->_statistics[i]._bytes;
+      }
+   for (ThreadCache **link = &_threadCaches; *link; link = &(*link)->_next)
+      {
+      if (*link == cache)
+         {
+         *link = cache->_next;
+         break;
+         }
+      }
+   MUTEX_EXIT(_mutex);
+
+   _rawAllocator.deallocate(cache);
+   }
+
+// Take count blocks of sizeClass from the shared free list, carving more from
+// the current slab as needed. Returns NULL (and no blocks) if memory runs out.
+// The caller must hold _mutex.
+//
+OMR::PersistentAllocator::Block *
+OMR::PersistentAllocator::allocateBlocks(uint32_t sizeClass, uint32_t count, Block *&last) throw()
+   {
+   size_t size = blockSize(sizeClass);
+   Block *first = NULL;
+   last = NULL;
+
+   for (uint32_t i = 0; i < count; i++)
+      {
+      Block *block = _freeLists[sizeClass];
+      if (block)
+         {
+         _freeLists[sizeClass] = block->_next;
+         }
+      else
+         {
+         if ((size_t)(_slabTop - _slabAlloc) < size)
+            {
+            // The rest of the current slab is too small to use
+            uint8_t *slab = static_cast<uint8_t *>(_rawAllocator.allocate(SLAB_SIZE, std::nothrow));
+            if (!slab)
+               break;
+            // The first block header of a slab links it for the destructor
+            Block *slabLink = reinterpret_cast<Block *>(slab);
+            slabLink->_next = _slabs;
+            _slabs = slabLink;
+            _slabAlloc = slab + BLOCK_HEADER_SIZE;
+            _slabTop = slab + SLAB_SIZE;
+            _slabBytes += SLAB_SIZE;
+            }
+         block = reinterpret_cast<Block *>(_slabAlloc);
+         _slabAlloc += size;
+         }
+      block->_next = first;
+      first = block;
+      if (!last)
+         last = block;
+      }
+
+   return first;
+   }
+
+void
+OMR::PersistentAllocator::freeBlocks(uint32_t sizeClass, Block *first, Block *last) throw()
+   {
+   last->_next = _freeLists[sizeClass];
+   _freeLists[sizeClass] = first;
+   }
+
+void *
+OMR::PersistentAllocator::allocateLarge(size_t size, uint32_t category, CategoryStatistics &statistics) throw()
+   {
+   Block *block = static_cast<Block *>(_rawAllocator.allocate(BLOCK_HEADER_SIZE + size, std::nothrow));
+   if (!block)
+      return NULL;
+   block->_header._size = size;
+   block->_header._category = category;
+   block->_header._sizeClass = LARGE_SIZE_CLASS;
+   statistics._allocations++;
+   statistics._bytes += size;
+   return block + 1;
+   }
+
+void *
+OMR::PersistentAllocator::allocate(size_t size, uint32_t category, const std::nothrow_t tag) throw()
+   {
+   TR_ASSERT(category < NUM_CATEGORIES, "Persistent allocation category %u out of range", category);
+
+   ThreadCache *cache = getThreadCache();
+   uint32_t sizeClass = (uint32_t)((size + BLOCK_HEADER_SIZE + SIZE_CLASS_GRANULE - 1) / SIZE_CLASS_GRANULE) - 1;
+   if (size > SIZE_CLASS_GRANULE * NUM_SIZE_CLASSES || sizeClass >= NUM_SIZE_CLASSES)
+      {
+      if (cache)
+         return allocateLarge(size, category, cache->_statistics[category]);
+
+      MUTEX_ENTER(_mutex);
+      void *p = allocateLarge(size, category, _statistics[category]);
+      MUTEX_EXIT(_mutex);
+      return p;
+      }
+
+   Block *block;
+   if (cache)
+      {
+      block = cache->_freeLists[sizeClass];
+      if (block)
+         {
+         cache->_freeLists[sizeClass] = block->_next;
+         cache->_freeCounts[sizeClass]--;
+         }
+      else
+         {
+         Block *last;
+         MUTEX_ENTER(_mutex);
+         block = allocateBlocks(sizeClass, THREAD_CACHE_REFILL_COUNT, last);
+         MUTEX_EXIT(_mutex);
+         if (!block)
+            return NULL;
+         cache->_freeLists[sizeClass] = block->_next;
+         for (Block *b = block->_next; b; b = b->_next)
+            cache->_freeCounts[sizeClass]++;
+         }
+      cache->_statistics[category]._allocations++;
+      cache->_statistics[category]._bytes += size;
+      }
+   else
+      {
+      Block *last;
+      MUTEX_ENTER(_mutex);
+      block = allocateBlocks(sizeClass, 1, last);
+      if (block)
+         {
+         _statistics[category]._allocations++;
+         _statistics[category]._bytes += size;
+         }
+      MUTEX_EXIT(_mutex);
+      if (!block)
+         return NULL;
+      }
+
+   block->_header._size = size;
+   block->_header._category = category;
+   block->_header._sizeClass = sizeClass;
+   return block + 1;
    }
 
 void *
 OMR::PersistentAllocator::allocate(size_t size, const std::nothrow_t tag, void * hint) throw()
    {
-   return _rawAllocator.allocate(size, tag, hint);
+   return allocate(size, UNCATEGORIZED, tag);
    }
 
 void *
 OMR::PersistentAllocator::allocate(size_t size, void * hint)
    {
-   return _rawAllocator.allocate(size, hint);
+   void * const alloc = allocate(size, UNCATEGORIZED, std::nothrow);
+   if (!alloc) throw std::bad_alloc();
+   return alloc;
    }
 
 void
 OMR::PersistentAllocator::deallocate(void * p, const size_t sizeHint) throw()
    {
-   _rawAllocator.deallocate(p, sizeHint);
+   if (!p)
+      return;
+
+   Block *block = static_cast<Block *>(p) - 1;
+   size_t size = block->_header._size;
+   uint32_t category = block->_header._category;
+   uint32_t sizeClass = block->_header._sizeClass;
+   TR_ASSERT(sizeClass <= LARGE_SIZE_CLASS && category < NUM_CATEGORIES, "Bad persistent allocation header at %p", p);
+
+   ThreadCache *cache = getThreadCache();
+   if (!cache)
+      {
+      MUTEX_ENTER(_mutex);
+      _statistics[category]._allocations--;
+      _statistics[category]._bytes -= size;
+      if (sizeClass != LARGE_SIZE_CLASS)
+         freeBlocks(sizeClass, block, block);
+      MUTEX_EXIT(_mutex);
+      if (sizeClass == LARGE_SIZE_CLASS)
+         _rawAllocator.deallocate(block);
+      return;
+      }
+
+   cache->_statistics[category]._allocations--;
+   cache->_statistics[category]._bytes -= size;
+   if (sizeClass == LARGE_SIZE_CLASS)
+      {
+      _rawAllocator.deallocate(block);
+      }
+   else
+      {
+      block->_next = cache->_freeLists[sizeClass];
+      cache->_freeLists[sizeClass] = block;
+      if (++cache->_freeCounts[sizeClass] > THREAD_CACHE_LIMIT)
+         {
+         // Return a batch to the shared free list for other threads to use
+         Block *first = cache->_freeLists[sizeClass];
+         Block *last = first;
+         for (uint32_t i = 1; i < THREAD_CACHE_REFILL_COUNT; i++)
+            last = last->_next;
+         cache->_freeLists[sizeClass] = last->_next;
+         cache->_freeCounts[sizeClass] -= THREAD_CACHE_REFILL_COUNT;
+         MUTEX_ENTER(_mutex);
+         freeBlocks(sizeClass, first, last);
+         MUTEX_EXIT(_mutex);
+         }
+      }
+   }
+
+void
+OMR::PersistentAllocator::getCategoryStatistics(uint32_t category, size_t &liveAllocations, size_t &liveBytes)
+   {
+   MUTEX_ENTER(_mutex);
+   int64_t allocations = _statistics[category]._allocations;
+   int64_t bytes = _statistics[category]._bytes;
+   for (ThreadCache *cache = _threadCaches; cache; cache = cache->_next)
+      {
+      allocations += cache->_statistics[category]._allocations;
+      bytes += cache->_statistics[category]._bytes;
+      }
+   MUTEX_EXIT(_mutex);
+
+   liveAllocations = allocations > 0 ? (size_t)allocations : 0;
+   liveBytes = bytes > 0 ? (size_t)bytes : 0;
    }
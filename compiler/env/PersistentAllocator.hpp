@@ -34,21 +34,79 @@ namespace TR { using OMR::PersistentAllocator; }
 
 #include "env/RawAllocator.hpp"  // for RawAllocator
 #include "env/PersistentAllocatorKit.hpp" // for PersistentAllocatorKit
+#include "omrmutex.h"            // for MUTEX
+
+// Thread caches need a thread exit callback to return their blocks, which a
+// pthread key destructor provides. Elsewhere every allocation takes the lock.
+//
+#if defined(SUPPORTS_THREAD_LOCAL) && (defined(LINUX) || defined(OSX) || defined(AIXPPC))
+#define PERSISTENT_ALLOCATOR_THREAD_CACHES
+#include <pthread.h>
+#endif
 
 namespace OMR {
 
+/**
+ * @brief The PersistentAllocator allocates memory which lives until it is
+ * explicitly deallocated, typically for the life of the compiler.
+ *
+ * Small allocations are served from size class segregated free lists which
+ * are carved out of slabs obtained from the raw allocator, rather than each
+ * going to malloc. Each thread keeps a cache of free blocks per size class,
+ * refilled from and flushed to the shared free lists in batches, so that most
+ * allocations and deallocations do not take the lock. A thread's cache is
+ * returned when the thread exits, or earlier by releaseThreadCache(). Large
+ * allocations go directly to the raw allocator.
+ *
+ * Every allocation is tagged with a category (the TR_MemoryBase::ObjectType
+ * of TR_PersistentMemory allocations), for which the allocator keeps the
+ * number of live allocations and bytes.
+ */
 class PersistentAllocator
    {
 public:
+   enum
+      {
+      SIZE_CLASS_GRANULE = 16,
+      NUM_SIZE_CLASSES = 32,           // blocks of 16 to 512 bytes, header included
+      NUM_CATEGORIES = 256,
+      UNCATEGORIZED = NUM_CATEGORIES - 1
+      };
+
    PersistentAllocator(const TR::PersistentAllocatorKit &allocatorKit);
 
+   /**
+    * @brief Free the slabs and thread caches. Allocations from the slabs must
+    * no longer be in use, and no thread may use the allocator any more.
+    */
+   ~PersistentAllocator() throw();
+
    void *allocate(size_t size, const std::nothrow_t tag, void * hint = 0) throw();
    void * allocate(size_t size, void * hint = 0);
+   void *allocate(size_t size, uint32_t category, const std::nothrow_t tag) throw();
    void deallocate(void * p, const size_t sizeHint = 0) throw();
 
+   /**
+    * @brief Return the free blocks cached by the calling thread to the shared
+    * free lists. Call before a thread which used the allocator exits.
+    */
+   void releaseThreadCache() throw();
+
+   /**
+    * @brief The number of live allocations, and the bytes they requested, of
+    * one category. Counts kept by other threads are read without
+    * synchronization, so they may be slightly out of date.
+    */
+   void getCategoryStatistics(uint32_t category, size_t &liveAllocations, size_t &liveBytes);
+
+   /**
+    * @brief Bytes obtained from the raw allocator for the size class slabs
+    */
+   size_t slabBytes() const { return _slabBytes; }
+
    friend bool operator ==(const PersistentAllocator &left, const PersistentAllocator &right)
       {
-      return left._rawAllocator == right._rawAllocator;
+      return &left == &right;
       }
 
    friend bool operator !=(const PersistentAllocator &left, const PersistentAllocator &right)
@@ -59,8 +117,38 @@ public:
 private:
    PersistentAllocator(const PersistentAllocator &);
 
-   TR::RawAllocator _rawAllocator;
+   struct Block;
+   struct ThreadCache;
+
+   struct CategoryStatistics
+      {
+      int64_t _allocations;
+      int64_t _bytes;
+      };
 
+   ThreadCache *getThreadCache() throw();
+   void releaseCache(ThreadCache *cache) throw();
+   static void releaseCacheAtThreadExit(void *cache);
+   void *allocateLarge(size_t size, uint32_t category, CategoryStatistics &statistics) throw();
+
+   // The caller must hold _mutex
+   Block *allocateBlocks(uint32_t sizeClass, uint32_t count, Block *&last) throw();
+   void freeBlocks(uint32_t sizeClass, Block *first, Block *last) throw();
+
+   TR::RawAllocator _rawAllocator;
+#if defined(PERSISTENT_ALLOCATOR_THREAD_CACHES)
+   pthread_key_t _threadCacheKey;
+   bool _threadCacheKeyCreated;
+#endif
+
+   MUTEX _mutex;                                    // protects all of the following
+   Block *_freeLists[NUM_SIZE_CLASSES];
+   uint8_t *_slabAlloc;
+   uint8_t *_slabTop;
+   Block *_slabs;                                   // linked through the first block header of each slab
+   size_t _slabBytes;
+   ThreadCache *_threadCaches;
+   CategoryStatistics _statistics[NUM_CATEGORIES];  // of allocations made without a thread cache, and of released thread caches
    };
 
 }
@@ -24,6 +24,12 @@ TR::SegmentPool::SegmentPool(TR::SegmentProvider &backingProvider, size_t poolSi
    _poolSize(poolSize),
    _storedSegments(0),
    _backingProvider(backingProvider),
+   _segmentsInUse(0),
+   _highWaterMark(0),
+   _bytesInUse(0),
+   _peakBytesInUse(0),
+   _segmentsRecycled(0),
+   _segmentsRequested(0),
    _segmentStack(StackContainer(DequeAllocator(rawAllocator)))
    {
    }
@@ -54,14 +60,34 @@ TR::SegmentPool::request(size_t requiredSize)
       TR::MemorySegment &recycledSegment = _segmentStack.top().get();
       _segmentStack.pop();
       recycledSegment.reset();
+      ++_segmentsRecycled;
+      noteInUse(recycledSegment);
       return recycledSegment;
       }
-   return _backingProvider.request(requiredSize);
+   TR::MemorySegment &newSegment = _backingProvider.request(requiredSize);
+   ++_segmentsRequested;
+   noteInUse(newSegment);
+   return newSegment;
+   }
+
+void
+TR::SegmentPool::noteInUse(TR::MemorySegment &segment) throw()
+   {
+   ++_segmentsInUse;
+   if (_segmentsInUse > _highWaterMark)
+      _highWaterMark = _segmentsInUse;
+   _bytesInUse += segment.size();
+   if (_bytesInUse > _peakBytesInUse)
+      _peakBytesInUse = _bytesInUse;
    }
 
 void
 TR::SegmentPool::release(TR::MemorySegment &segment) throw()
    {
+   TR_ASSERT(_segmentsInUse > 0 && _bytesInUse >= segment.size(), "Releasing a segment which is not in use");
+   --_segmentsInUse;
+   _bytesInUse -= segment.size();
+
    if (
       segment.size() == _defaultSegmentSize
       && _storedSegments < _poolSize
@@ -82,3 +108,16 @@ TR::SegmentPool::release(TR::MemorySegment &segment) throw()
       _backingProvider.release(segment);
       }
    }
+
+void
+TR::SegmentPool::trim() throw()
+   {
+   while (_storedSegments > _highWaterMark)
+      {
+      TR::MemorySegment &topSegment = _segmentStack.top().get();
+      _segmentStack.pop();
+      --_storedSegments;
+      _backingProvider.release(topSegment);
+      }
+   _highWaterMark = _segmentsInUse;
+   }
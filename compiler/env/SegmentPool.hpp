@@ -32,22 +32,56 @@ namespace TR {
 
 /**
  * @brief The SegmentPool class maintains a pool of memory segments.
+ *
+ * Released segments of the default size are kept, up to poolSize of them, to
+ * satisfy later requests without going back to the backing provider. A pool
+ * which outlives a series of users (e.g. the compilations of one thread) can
+ * be trimmed between them so that it only keeps as many segments as the
+ * most recent user needed at its high water mark.
  */
 
 class SegmentPool : public TR::SegmentProvider
    {
 public:
-   SegmentPool(TR::SegmentProvider &backingProvider, size_t cacheSize, TR::RawAllocator rawAllocator);
+   SegmentPool(TR::SegmentProvider &backingProvider, size_t poolSize, TR::RawAllocator rawAllocator);
    ~SegmentPool() throw();
 
    virtual TR::MemorySegment &request(size_t requiredSize);
    virtual void release(TR::MemorySegment &) throw();
 
+   /**
+    * @brief Return pooled segments to the backing provider until no more
+    * remain than the largest number of segments in use since the last trim.
+    */
+   void trim() throw();
+
+   size_t bytesInUse() const throw() { return _bytesInUse; }
+   size_t bytesPooled() const throw() { return _storedSegments * _defaultSegmentSize; }
+
+   /**
+    * @brief The largest number of bytes in use since the last call to
+    * resetPeakBytesInUse().
+    */
+   size_t peakBytesInUse() const throw() { return _peakBytesInUse; }
+   void resetPeakBytesInUse() throw() { _peakBytesInUse = _bytesInUse; }
+
+   size_t segmentsRecycled() const throw() { return _segmentsRecycled; }
+   size_t segmentsRequested() const throw() { return _segmentsRequested; }
+
 private:
+   void noteInUse(TR::MemorySegment &segment) throw();
+
    size_t const _poolSize;
    size_t _storedSegments;
    TR::SegmentProvider &_backingProvider;
 
+   size_t _segmentsInUse;
+   size_t _highWaterMark;     // most segments in use since the last trim
+   size_t _bytesInUse;
+   size_t _peakBytesInUse;
+   size_t _segmentsRecycled;  // requests satisfied from the pool
+   size_t _segmentsRequested; // requests passed to the backing provider
+
    typedef TR::typed_allocator<
       TR::reference_wrapper<TR::MemorySegment>,
       TR::RawAllocator
@@ -22,6 +22,7 @@
 OMR::SystemSegmentProvider::SystemSegmentProvider(size_t segmentSize, TR::RawAllocator rawAllocator) :
    TR::SegmentProvider(segmentSize),
    _rawAllocator(rawAllocator),
+   _bytesAllocated(0),
    _segments(std::less< TR::MemorySegment >(), SegmentSetAllocator(rawAllocator))
    {
    }
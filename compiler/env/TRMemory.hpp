@@ -473,7 +473,7 @@ public:
    void * allocatePersistentMemory(size_t const size, ObjectType const ot = UnknownType) throw()
       {
       _totalPersistentAllocations[ot] += size;
-      void * persistentMemory = _persistentAllocator.get().allocate(size, std::nothrow);
+      void * persistentMemory = _persistentAllocator.get().allocate(size, ot, std::nothrow);
       return persistentMemory;
       }
 
@@ -484,6 +484,9 @@ public:
 
    TR::PersistentInfo * getPersistentInfo() { return &_persistentInfo; }
 
+   // Write the live persistent allocations of each ObjectType to the verbose log
+   void printMemoryUsage();
+
    uintptr_t _signature;        // eyecatcher
 
    friend class TR_Memory;
@@ -27,6 +27,7 @@
 #include "control/Options_inlines.hpp"  // for TR::Options, etc
 #include "env/PersistentAllocator.hpp"  // for PersistentAllocator
 #include "env/TRMemory.hpp"             // for TR_PersistentMemory, etc
+#include "env/VerboseLog.hpp"           // for TR_VerboseLog, etc
 #include "il/DataTypes.hpp"             // for pointer_cast
 #include "infra/Assert.hpp"             // for TR_ASSERT
 #include "infra/Monitor.hpp"            // for Monitor
@@ -36,6 +37,7 @@ namespace TR { class Compilation; }
 namespace TR { class PersistentInfo; }
 
 extern TR::Monitor *memoryAllocMonitor;
+extern const char * objectName[];
 
 namespace TR
    {
@@ -70,3 +72,36 @@ TR_PersistentMemory::TR_PersistentMemory(
    _totalPersistentAllocations()
    {
    }
+
+void
+TR_PersistentMemory::printMemoryUsage()
+   {
+   TR_ASSERT(TR_MemoryBase::NumObjectTypes <= TR::PersistentAllocator::UNCATEGORIZED, "Too many object types to categorize persistent allocations");
+
+   TR::PersistentAllocator &allocator = _persistentAllocator.get();
+   size_t totalAllocations = 0;
+   size_t totalBytes = 0;
+   TR_VerboseLog::vlogAcquire();
+   for (uint32_t category = 0; category < TR::PersistentAllocator::NUM_CATEGORIES; category++)
+      {
+      if (category >= TR_MemoryBase::NumObjectTypes && category != TR::PersistentAllocator::UNCATEGORIZED)
+         continue;
+
+      size_t liveAllocations, liveBytes;
+      allocator.getCategoryStatistics(category, liveAllocations, liveBytes);
+      if (liveAllocations == 0)
+         continue;
+
+      TR_VerboseLog::writeLine(TR_Vlog_MEMORY, "persistent %-32s live=%llu KB=%llu",
+         category < TR_MemoryBase::NumObjectTypes ? objectName[category] : "Untagged",
+         (unsigned long long)liveAllocations,
+         (unsigned long long)(liveBytes >> 10));
+      totalAllocations += liveAllocations;
+      totalBytes += liveBytes;
+      }
+   TR_VerboseLog::writeLine(TR_Vlog_MEMORY, "persistent total live=%llu KB=%llu; size class slabs KB=%llu",
+      (unsigned long long)totalAllocations,
+      (unsigned long long)(totalBytes >> 10),
+      (unsigned long long)(allocator.slabBytes() >> 10));
+   TR_VerboseLog::vlogRelease();
+   }
@@ -1714,6 +1714,9 @@ IlBuilder::ForLoop(bool countsUp,
    *loopCode = createBuilderIfNeeded(*loopCode);
 
    TraceIL("IlBuilder[ %p ]::ForLoop ind %s initial %d end %d increment %d loopCode %p countsUp %d\n", this, indVar, initial->getCPIndex(), end->getCPIndex(), increment->getCPIndex(), *loopCode, countsUp);
+   // Loop optimizations are only wanted, for their compile time, when vectorizing
+   if (comp()->getOption(TR_EnableAutoSIMD))
+      methodSymbol()->setMayHaveLoops(true);
 
    Store(indVar, initial);
 
@@ -1785,6 +1788,8 @@ IlBuilder::DoWhileLoop(const char *whileCondition, TR::IlBuilder **body, TR::IlB
 
    *body = createBuilderIfNeeded(*body);
    TraceIL("IlBuilder[ %p ]::DoWhileLoop do body B%d while %s\n", this, (*body)->getEntry()->getNumber(), whileCondition);
+   if (comp()->getOption(TR_EnableAutoSIMD))
+      methodSymbol()->setMayHaveLoops(true);
 
    AppendBuilder(*body);
    TR::IlBuilder *loopContinue = NULL;
@@ -1824,6 +1829,8 @@ IlBuilder::WhileDoLoop(const char *whileCondition, TR::IlBuilder **body, TR::IlB
 
    TR_ASSERT(body != NULL, "WhileDo needs to have a body");
    TraceIL("IlBuilder[ %p ]::WhileDoLoop while %s do body %p\n", this, whileCondition, *body);
+   if (comp()->getOption(TR_EnableAutoSIMD))
+      methodSymbol()->setMayHaveLoops(true);
 
    TR::IlBuilder *done = OrphanBuilder();
    if (breakBuilder)
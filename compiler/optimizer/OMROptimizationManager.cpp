@@ -169,6 +169,9 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
       case OMR::inductionVariableAnalysis:
          _flags.set(requiresStructure | checkStructure);
          break;
+      case OMR::SPMDKernelParallelization:
+         _flags.set(requiresStructure);
+         break;
       case OMR::reorderArrayIndexExpr:
          _flags.set(requiresStructure | checkStructure);
          break;
@@ -91,6 +91,7 @@
 #include "optimizer/RedundantAsyncCheckRemoval.hpp"
 #include "optimizer/ShrinkWrapping.hpp"
 #include "optimizer/Simplifier.hpp"
+#include "optimizer/SPMDParallelizer.hpp"
 #include "optimizer/VirtualGuardCoalescer.hpp"
 #include "optimizer/VirtualGuardHeadMerger.hpp"
 #include "optimizer/Inliner.hpp" // for OMR_InlinerPolicy
@@ -596,6 +597,8 @@ static const OptimizationStrategy omrHotStrategyOpts[] =
    { OMR::inductionVariableAnalysis,                         },
    { OMR::loopSpecializerGroup,                              },
    { OMR::inductionVariableAnalysis,                         },
+   { OMR::SPMDKernelParallelization,                         }, // vectorize unit stride loops
+   { OMR::inductionVariableAnalysis,                         },
    { OMR::generalLoopUnroller,                               }, // unroll Loops
    { OMR::blockSplitter,            OMR::MarkLastRun         },
    { OMR::blockManipulationGroup                             },
@@ -825,6 +828,8 @@ OMR::Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *metho
       new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopInverter::create, OMR::loopInversion, "O^O LOOP INVERTER: ");
    _opts[OMR::inductionVariableAnalysis] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_InductionVariableAnalysis::create, OMR::inductionVariableAnalysis, "O^O INDUCTION VARIABLE ANALYSIS: ");
+   _opts[OMR::SPMDKernelParallelization] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR_SPMDKernelParallelizer::create, OMR::SPMDKernelParallelization, "O^O SPMD KERNEL PARALLELIZER: ");
    _opts[OMR::osrExceptionEdgeRemoval] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_OSRExceptionEdgeRemoval::create, OMR::osrExceptionEdgeRemoval, "O^O OSR EXCEPTION EDGE REMOVAL: ");
    _opts[OMR::regDepCopyRemoval] =
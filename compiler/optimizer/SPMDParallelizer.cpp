@@ -0,0 +1,910 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2000, 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "optimizer/SPMDParallelizer.hpp"
+
+#include <stddef.h>                              // for NULL
+#include <stdint.h>                              // for int32_t, int64_t
+#include "codegen/CodeGenerator.hpp"             // for CodeGenerator
+#include "compile/Compilation.hpp"               // for Compilation
+#include "compile/SymbolReferenceTable.hpp"      // for SymbolReferenceTable
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"           // for TR::Options, etc
+#include "env/CompilerEnv.hpp"                   // for TR::Compiler->target
+#include "env/StackMemoryRegion.hpp"
+#include "il/Block.hpp"                          // for Block, toBlock
+#include "il/DataTypes.hpp"                      // for DataType, etc
+#include "il/ILOpCodes.hpp"                      // for ILOpCodes
+#include "il/ILOps.hpp"                          // for ILOpCode
+#include "il/Node.hpp"                           // for Node
+#include "il/Node_inlines.hpp"                   // for Node::getFirstChild, etc
+#include "il/Symbol.hpp"                         // for Symbol
+#include "il/SymbolReference.hpp"                // for SymbolReference
+#include "il/TreeTop.hpp"                        // for TreeTop
+#include "il/TreeTop_inlines.hpp"                // for TreeTop::getNode, etc
+#include "infra/BitVector.hpp"                   // for TR_BitVector
+#include "infra/Cfg.hpp"                         // for CFG
+#include "infra/Checklist.hpp"                   // for NodeChecklist, etc
+#include "infra/List.hpp"                        // for List, ListIterator, etc
+#include "infra/TRCfgEdge.hpp"                   // for CFGEdge
+#include "optimizer/InductionVariable.hpp"       // for TR_PrimaryInductionVariable
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"               // for Optimizer
+#include "optimizer/Structure.hpp"               // for TR_RegionStructure, etc
+#include "ras/Debug.hpp"                         // for TR_DebugBase
+
+#define OPT_DETAILS "O^O SPMD KERNEL PARALLELIZER: "
+
+// Width of the vector registers the generated IL is sized for
+//
+#define VECTOR_SIZE_IN_BYTES 16
+
+// Upper bound on the number of runtime overlap tests emitted for one loop
+//
+#define MAX_OVERLAP_TESTS 8
+
+TR_SPMDKernelParallelizer::TR_SPMDKernelParallelizer(TR::OptimizationManager *manager)
+   : TR::Optimization(manager)
+   {}
+
+int32_t
+TR_SPMDKernelParallelizer::perform()
+   {
+   if (!cg()->getSupportsAutoSIMD() ||
+       comp()->getOption(TR_DisableAutoSIMD) ||
+       optimizer()->optsThatCanCreateLoopsDisabled())
+      return 0;
+
+   TR_Structure *rootStructure = comp()->getFlowGraph()->getStructure();
+   if (!rootStructure || !rootStructure->asRegion())
+      return 0;
+
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+
+   List<TR_RegionStructure> innerLoops(trMemory());
+   collectInnerLoops(rootStructure->asRegion(), innerLoops);
+
+   int32_t numVectorizedLoops = 0;
+   ListIterator<TR_RegionStructure> it(&innerLoops);
+   for (TR_RegionStructure *loop = it.getFirst(); loop; loop = it.getNext())
+      {
+      if (!analyzeLoop(loop))
+         continue;
+
+      if (!performTransformation(comp(), "%sVectorizing loop %d with %d %s elements per vector\n", OPT_DETAILS,
+                                 loop->getNumber(), _vectorLength, _elementType.toString()))
+         continue;
+
+      // New blocks and a new loop are added, so structure is rebuilt by the
+      // next optimization that requires it. The regions of the remaining
+      // loops are untouched and can still be used to analyze them.
+      //
+      comp()->getFlowGraph()->setStructure(NULL);
+      transformLoop(loop);
+      numVectorizedLoops++;
+      }
+
+   if (numVectorizedLoops > 0)
+      {
+      optimizer()->setUseDefInfo(NULL);
+      optimizer()->setValueNumberInfo(NULL);
+      optimizer()->setAliasSetsAreValid(false);
+
+      if (trace())
+         comp()->dumpMethodTrees("Trees after auto-vectorization");
+      }
+
+   return numVectorizedLoops;
+   }
+
+void
+TR_SPMDKernelParallelizer::collectInnerLoops(TR_RegionStructure *region, List<TR_RegionStructure> &innerLoops)
+   {
+   if (region->getEntryBlock()->isCold())
+      return;
+
+   TR_RegionStructure::Cursor it(*region);
+   List<TR_RegionStructure> myInnerLoops(trMemory());
+   for (TR_StructureSubGraphNode *node = it.getFirst(); node; node = it.getNext())
+      {
+      if (node->getStructure()->asRegion())
+         collectInnerLoops(node->getStructure()->asRegion(), myInnerLoops);
+      }
+
+   if (region->isNaturalLoop() && myInnerLoops.isEmpty())
+      innerLoops.add(region);
+   else
+      innerLoops.add(myInnerLoops);
+   }
+
+// Decide whether the loop can be vectorized, filling in the per loop state
+// used by transformLoop
+//
+bool
+TR_SPMDKernelParallelizer::analyzeLoop(TR_RegionStructure *loop)
+   {
+   _piv = loop->getPrimaryInductionVariable();
+   _elementType = TR::NoType;
+   _vectorLength = 0;
+   _ivStoreTree = NULL;
+   _limit = NULL;
+   _currentTreeIndex = 0;
+
+   if (!_piv ||
+       _piv->getSymRef()->getSymbol()->getDataType() != TR::Int32 ||
+       _piv->getDeltaOnBackEdge() != 1 ||
+       _piv->usesUnchangedValueInLoopTest() ||
+       _piv->isUnsigned())
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d has no suitable primary induction variable\n", loop->getNumber());
+      return false;
+      }
+
+   int32_t numSymRefs = comp()->getSymRefTab()->getNumSymRefs();
+   _bodyTrees = new (trStackMemory()) TR_ScratchList<TR::TreeTop>(trMemory());
+   _accesses = new (trStackMemory()) TR_ScratchList<ArrayAccess>(trMemory());
+   _storedSymRefs = new (trStackMemory()) TR_BitVector(numSymRefs, trMemory(), stackAlloc);
+   _vectorTemps = new (trStackMemory()) TR_BitVector(numSymRefs, trMemory(), stackAlloc);
+   _vectorizableNodes = new (trStackMemory()) TR::NodeChecklist(comp());
+
+   if (!collectLoopBody(loop))
+      return false;
+
+   if (!setElementType(_elementType))
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d has no array store of a vectorizable type\n", loop->getNumber());
+      return false;
+      }
+
+   TR::SymbolReference *ivSymRef = _piv->getSymRef();
+   TR::TreeTop *branchTree = _piv->getBranchBlock()->getLastRealTreeTop();
+   TR_BitVector scalarTemps(numSymRefs, trMemory(), stackAlloc);
+
+   ListIterator<TR::TreeTop> it(_bodyTrees);
+   for (TR::TreeTop *tt = it.getFirst(); tt; tt = it.getNext(), _currentTreeIndex++)
+      {
+      TR::Node *node = tt->getNode();
+      if (node->getOpCode().isGoto() || tt == branchTree)
+         continue;
+
+      if (node->getOpCode().isStoreDirect())
+         {
+         TR::SymbolReference *symRef = node->getSymbolReference();
+         TR::Node *value = node->getFirstChild();
+
+         if (symRef == ivSymRef)
+            {
+            if (_ivStoreTree ||
+                (value->getOpCodeValue() != TR::iadd && value->getOpCodeValue() != TR::isub) ||
+                !value->getFirstChild()->getOpCode().isLoadVarDirect() ||
+                value->getFirstChild()->getSymbolReference() != ivSymRef)
+               {
+               if (trace())
+                  traceMsg(comp(), "Loop %d: unexpected update of the induction variable in node %p\n", loop->getNumber(), node);
+               return false;
+               }
+            _ivStoreTree = tt;
+            }
+         else if (!_ivStoreTree &&
+                  node->getDataType() == _elementType &&
+                  !scalarTemps.isSet(symRef->getReferenceNumber()) &&
+                  isVectorizable(value))
+            {
+            _vectorTemps->set(symRef->getReferenceNumber());
+            }
+         else if (!_vectorTemps->isSet(symRef->getReferenceNumber()) &&
+                  isScalarExpression(value))
+            {
+            scalarTemps.set(symRef->getReferenceNumber());
+            }
+         else
+            {
+            if (trace())
+               traceMsg(comp(), "Loop %d: cannot vectorize store node %p\n", loop->getNumber(), node);
+            return false;
+            }
+         }
+      else if (node->getOpCode().isStoreIndirect() &&
+               node->getSymbol()->isArrayShadowSymbol() &&
+               node->getDataType() == _elementType &&
+               !_ivStoreTree)
+         {
+         if (!isUnitStrideAddress(node->getFirstChild()) ||
+             !isVectorizable(node->getSecondChild()))
+            {
+            if (trace())
+               traceMsg(comp(), "Loop %d: cannot vectorize array store node %p\n", loop->getNumber(), node);
+            return false;
+            }
+         _accesses->add(new (trStackMemory()) ArrayAccess(node->getFirstChild(), true, _currentTreeIndex));
+         }
+      else
+         {
+         if (trace())
+            traceMsg(comp(), "Loop %d: unsupported tree node %p\n", loop->getNumber(), node);
+         return false;
+         }
+      }
+
+   if (!_ivStoreTree)
+      return false;
+
+   // The loop test has to compare the updated induction variable against a
+   // loop invariant limit
+   //
+   TR::Node *branchNode = branchTree->getNode();
+   TR::Node *ivValue = branchNode->getFirstChild();
+   if (!(ivValue == _ivStoreTree->getNode()->getFirstChild() ||
+         (ivValue->getOpCode().isLoadVarDirect() && ivValue->getSymbolReference() == ivSymRef)) ||
+       !isLoopInvariant(branchNode->getSecondChild()) ||
+       (_continueOp != TR::ificmplt && _continueOp != TR::ificmple))
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: unsupported loop test node %p\n", loop->getNumber(), branchNode);
+      return false;
+      }
+   _limit = branchNode->getSecondChild();
+
+   // Values computed in the loop are not reproduced exactly by the vector
+   // loop, so nothing but the induction variable may be used after it
+   //
+   TR_BitVector tempsToCheck(numSymRefs, trMemory(), stackAlloc);
+   tempsToCheck = *_storedSymRefs;
+   tempsToCheck.reset(ivSymRef->getReferenceNumber());
+   if (isUsedOutsideLoop(loop, &tempsToCheck))
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d: a value computed in the loop is used after it\n", loop->getNumber());
+      return false;
+      }
+
+   // Count the overlap tests needed between stores and the other accesses
+   //
+   int32_t numTests = 0;
+   ListIterator<ArrayAccess> storeIt(_accesses);
+   for (ArrayAccess *store = storeIt.getFirst(); store; store = storeIt.getNext())
+      {
+      if (!store->_isStore)
+         continue;
+
+      ListIterator<ArrayAccess> otherIt(_accesses);
+      for (ArrayAccess *other = otherIt.getFirst(); other; other = otherIt.getNext())
+         {
+         if (other == store ||
+             (other->_isStore && other->_treeIndex < store->_treeIndex) ||
+             areSameTrees(store->_address, other->_address))
+            continue;
+         numTests++;
+         }
+      }
+
+   if (numTests > MAX_OVERLAP_TESTS)
+      {
+      if (trace())
+         traceMsg(comp(), "Loop %d would need %d overlap tests\n", loop->getNumber(), numTests);
+      return false;
+      }
+
+   return true;
+   }
+
+// Walk the loop from its entry to the block holding the loop test. The loop
+// must be a single chain of blocks entered from a preheader laid out right
+// before it.
+//
+bool
+TR_SPMDKernelParallelizer::collectLoopBody(TR_RegionStructure *loop)
+   {
+   TR::Block *entryBlock = loop->getEntryBlock();
+   TR::Block *branchBlock = _piv->getBranchBlock();
+
+   TR_ScratchList<TR::Block> blocksInLoop(trMemory());
+   loop->getBlocks(&blocksInLoop);
+   TR::BlockChecklist loopBlocks(comp());
+   ListIterator<TR::Block> blockIt(&blocksInLoop);
+   for (TR::Block *block = blockIt.getFirst(); block; block = blockIt.getNext())
+      loopBlocks.add(block);
+
+   ListAppender<TR::TreeTop> appender(_bodyTrees);
+   int32_t numBlocks = 0;
+   for (TR::Block *block = entryBlock; ; )
+      {
+      if (!block->getExceptionSuccessors().empty())
+         return false;
+
+      numBlocks++;
+      for (TR::TreeTop *tt = block->getFirstRealTreeTop(); tt != block->getExit(); tt = tt->getNextTreeTop())
+         {
+         TR::Node *node = tt->getNode();
+         appender.add(tt);
+         if (node->getOpCode().isStoreDirect())
+            {
+            if (!node->getSymbol()->isAutoOrParm())
+               return false;
+            _storedSymRefs->set(node->getSymbolReference()->getReferenceNumber());
+            }
+         else if (node->getOpCode().isStoreIndirect() && _elementType == TR::NoType)
+            {
+            _elementType = node->getDataType();
+            }
+         }
+
+      if (block == branchBlock)
+         break;
+
+      if (block->getSuccessors().size() != 1)
+         return false;
+
+      TR::Block *next = toBlock(block->getSuccessors().front()->getTo());
+      if (next == entryBlock ||
+          !loopBlocks.contains(next) ||
+          next->getPredecessors().size() != 1)
+         return false;
+
+      block = next;
+      }
+
+   if (numBlocks != blocksInLoop.getSize())
+      return false;
+
+   // Work out which way the loop test goes
+   //
+   TR::Node *branchNode = branchBlock->getLastRealTreeTop()->getNode();
+   if (!branchNode->getOpCode().isIf() ||
+       branchBlock->getSuccessors().size() != 2 ||
+       !branchBlock->getNextBlock())
+      return false;
+
+   TR::Block *destination = branchNode->getBranchDestination()->getNode()->getBlock();
+   TR::Block *fallThrough = branchBlock->getNextBlock();
+   if (destination == entryBlock)
+      {
+      _continueOp = branchNode->getOpCodeValue();
+      _exitBlock = fallThrough;
+      }
+   else if (fallThrough == entryBlock)
+      {
+      _continueOp = branchNode->getOpCode().getOpCodeForReverseBranch();
+      _exitBlock = destination;
+      }
+   else
+      return false;
+
+   if (loopBlocks.contains(_exitBlock))
+      return false;
+
+   // The preheader must fall into (or jump to) the loop entry so that the
+   // vector loop can be placed between the two
+   //
+   if (entryBlock->getPredecessors().size() != 2)
+      return false;
+
+   _preheader = entryBlock->getPrevBlock();
+   if (!_preheader ||
+       loopBlocks.contains(_preheader) ||
+       !_preheader->hasSuccessor(entryBlock) ||
+       _preheader->getLastRealTreeTop()->getNode()->getOpCode().isSwitch() ||
+       _preheader->getLastRealTreeTop()->getNode()->getOpCode().isReturn())
+      return false;
+
+   return true;
+   }
+
+bool
+TR_SPMDKernelParallelizer::isUsedOutsideLoop(TR_RegionStructure *loop, TR_BitVector *symRefs)
+   {
+   if (symRefs->isEmpty())
+      return false;
+
+   TR_ScratchList<TR::Block> blocksInLoop(trMemory());
+   loop->getBlocks(&blocksInLoop);
+   TR::BlockChecklist loopBlocks(comp());
+   ListIterator<TR::Block> blockIt(&blocksInLoop);
+   for (TR::Block *block = blockIt.getFirst(); block; block = blockIt.getNext())
+      loopBlocks.add(block);
+
+   TR::NodeChecklist visited(comp());
+   TR_ScratchList<TR::Node> stack(trMemory());
+   for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (node->getOpCodeValue() == TR::BBStart &&
+          loopBlocks.contains(node->getBlock()))
+         {
+         tt = node->getBlock()->getExit();
+         continue;
+         }
+
+      stack.add(node);
+      while (!stack.isEmpty())
+         {
+         TR::Node *current = stack.popHead();
+         if (visited.contains(current))
+            continue;
+         visited.add(current);
+
+         if (current->getOpCode().isLoadVarDirect() &&
+             symRefs->isSet(current->getSymbolReference()->getReferenceNumber()))
+            return true;
+
+         for (int32_t i = 0; i < current->getNumChildren(); i++)
+            stack.add(current->getChild(i));
+         }
+      }
+
+   return false;
+   }
+
+bool
+TR_SPMDKernelParallelizer::setElementType(TR::DataType type)
+   {
+   if (type != TR::Int32 && type != TR::Int64 && type != TR::Float && type != TR::Double)
+      return false;
+
+   if (!cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(TR::vloadi), type) ||
+       !cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(TR::vstorei), type))
+      return false;
+
+   _elementType = type;
+   _vectorLength = VECTOR_SIZE_IN_BYTES / TR::DataType::getSize(type);
+   return true;
+   }
+
+bool
+TR_SPMDKernelParallelizer::isLoopInvariant(TR::Node *node)
+   {
+   TR::ILOpCode &op = node->getOpCode();
+   if (op.isLoadConst())
+      return true;
+
+   if (op.isLoadVarDirect())
+      return node->getSymbol()->isAutoOrParm() &&
+             !_storedSymRefs->isSet(node->getSymbolReference()->getReferenceNumber());
+
+   if (op.hasSymbolReference() || node->getNumChildren() == 0 ||
+       !(op.isArithmetic() || op.isConversion()))
+      return false;
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      if (!isLoopInvariant(node->getChild(i)))
+         return false;
+      }
+
+   return true;
+   }
+
+// A scalar expression has no side effect and does not read memory other than
+// autos and parms
+//
+bool
+TR_SPMDKernelParallelizer::isScalarExpression(TR::Node *node)
+   {
+   TR::ILOpCode &op = node->getOpCode();
+   if (op.isLoadConst())
+      return true;
+
+   if (op.isLoadVarDirect())
+      return node->getSymbol()->isAutoOrParm();
+
+   if (op.hasSymbolReference() || node->getNumChildren() == 0 ||
+       !(op.isArithmetic() || op.isConversion()) ||
+       op.isDiv() || op.isRem())
+      return false;
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      if (!isScalarExpression(node->getChild(i)))
+         return false;
+      }
+
+   return true;
+   }
+
+bool
+TR_SPMDKernelParallelizer::isVectorizable(TR::Node *node)
+   {
+   if (_vectorizableNodes->contains(node))
+      return true;
+
+   if (node->getDataType() != _elementType)
+      return false;
+
+   TR::ILOpCode &op = node->getOpCode();
+   if (op.isLoadIndirect())
+      {
+      if (!node->getSymbol()->isArrayShadowSymbol() ||
+          !isUnitStrideAddress(node->getFirstChild()))
+         return false;
+      _accesses->add(new (trStackMemory()) ArrayAccess(node->getFirstChild(), false, _currentTreeIndex));
+      }
+   else if (op.isLoadVarDirect() &&
+            _vectorTemps->isSet(node->getSymbolReference()->getReferenceNumber()))
+      {
+      // a temp already holding a vector value in this iteration
+      }
+   else if (op.isLoadVarDirect() || op.isLoadConst())
+      {
+      if (!isLoopInvariant(node) ||
+          !cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(TR::vsplats), _elementType))
+         return false;
+      }
+   else
+      {
+      TR::ILOpCodes vectorOp = TR::ILOpCode::convertScalarToVector(node->getOpCodeValue());
+      switch (vectorOp)
+         {
+         case TR::vadd:
+         case TR::vsub:
+         case TR::vmul:
+         case TR::vdiv:
+         case TR::vand:
+         case TR::vor:
+         case TR::vxor:
+            break;
+         default:
+            return false;
+         }
+
+      if ((vectorOp == TR::vdiv && !_elementType.isFloatingPoint()) ||
+          !cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(vectorOp), _elementType) ||
+          !isVectorizable(node->getFirstChild()) ||
+          !isVectorizable(node->getSecondChild()))
+         return false;
+      }
+
+   _vectorizableNodes->add(node);
+   return true;
+   }
+
+// Matches base + index * elementSize (+ constant), where the base is loop
+// invariant and the index advances by one with the induction variable
+//
+bool
+TR_SPMDKernelParallelizer::isUnitStrideAddress(TR::Node *address)
+   {
+   if (address->getOpCodeValue() != TR::aladd && address->getOpCodeValue() != TR::aiadd)
+      return false;
+
+   if (!isLoopInvariant(address->getFirstChild()))
+      return false;
+
+   TR::Node *offset = address->getSecondChild();
+   if ((offset->getOpCode().isAdd() || offset->getOpCode().isSub()) &&
+       offset->getSecondChild()->getOpCode().isLoadConst())
+      offset = offset->getFirstChild();
+
+   if (!offset->getSecondChild() ||
+       !offset->getSecondChild()->getOpCode().isLoadConst())
+      return false;
+
+   int64_t elementSize = TR::DataType::getSize(_elementType);
+   int64_t scale = offset->getSecondChild()->get64bitIntegralValue();
+   if (offset->getOpCode().isMul())
+      {
+      if (scale != elementSize)
+         return false;
+      }
+   else if (offset->getOpCode().isLeftShift())
+      {
+      if (scale < 0 || scale > 3 || ((int64_t)1 << scale) != elementSize)
+         return false;
+      }
+   else
+      return false;
+
+   TR::Node *index = offset->getFirstChild();
+   if (index->getOpCodeValue() == TR::i2l)
+      index = index->getFirstChild();
+
+   return index->getDataType() == TR::Int32 && isUnitStrideIndex(index);
+   }
+
+bool
+TR_SPMDKernelParallelizer::isUnitStrideIndex(TR::Node *index)
+   {
+   if (index->getOpCode().isLoadVarDirect())
+      return index->getSymbolReference() == _piv->getSymRef();
+
+   if (index->getOpCodeValue() == TR::iadd)
+      return (isUnitStrideIndex(index->getFirstChild()) && isLoopInvariant(index->getSecondChild())) ||
+             (isLoopInvariant(index->getFirstChild()) && isUnitStrideIndex(index->getSecondChild()));
+
+   if (index->getOpCodeValue() == TR::isub)
+      return isUnitStrideIndex(index->getFirstChild()) && isLoopInvariant(index->getSecondChild());
+
+   return false;
+   }
+
+bool
+TR_SPMDKernelParallelizer::areSameTrees(TR::Node *a, TR::Node *b)
+   {
+   if (a == b)
+      return true;
+
+   if (a->getOpCodeValue() != b->getOpCodeValue() ||
+       a->getNumChildren() != b->getNumChildren())
+      return false;
+
+   if (a->getOpCode().hasSymbolReference() &&
+       a->getSymbolReference() != b->getSymbolReference())
+      return false;
+
+   if (a->getOpCode().isLoadConst() &&
+       (!a->getDataType().isIntegral() || a->get64bitIntegralValue() != b->get64bitIntegralValue()))
+      return false;
+
+   for (int32_t i = 0; i < a->getNumChildren(); i++)
+      {
+      if (!areSameTrees(a->getChild(i), b->getChild(i)))
+         return false;
+      }
+
+   return true;
+   }
+
+// Place the guards and the vector loop between the preheader and the loop
+// entry; the original loop is left untouched and runs the remaining
+// iterations
+//
+void
+TR_SPMDKernelParallelizer::transformLoop(TR_RegionStructure *loop)
+   {
+   TR::CFG *cfg = comp()->getFlowGraph();
+   TR::Block *entryBlock = loop->getEntryBlock();
+   TR::SymbolReference *ivSymRef = _piv->getSymRef();
+   TR::Node *ivStoreNode = _ivStoreTree->getNode();
+   bool continueIfEqual = (_continueOp == TR::ificmple);
+
+   auto mapAlloc = getTypedAllocator<std::pair<const ncount_t, TR::Node*> >(comp()->allocator());
+   NodeMap vectorNodes(std::less<ncount_t>(), mapAlloc);
+   NodeMap tempValues(std::less<ncount_t>(), mapAlloc);
+   _vectorNodes = &vectorNodes;
+   _tempValues = &tempValues;
+
+   // Enter the vector loop only when at least one full vector of iterations
+   // remains
+   //
+   TR::Block *firstGuard = appendBlock(_preheader,
+                              createFitsInVectorTest(continueIfEqual ? TR::iflcmpgt : TR::iflcmpge, entryBlock),
+                              NULL);
+   TR::Block *lastGuard = firstGuard;
+
+   // Fall back to the scalar loop when a store overlaps another access within
+   // the span of one vector
+   //
+   ListIterator<ArrayAccess> storeIt(_accesses);
+   for (ArrayAccess *store = storeIt.getFirst(); store; store = storeIt.getNext())
+      {
+      if (!store->_isStore)
+         continue;
+
+      ListIterator<ArrayAccess> otherIt(_accesses);
+      for (ArrayAccess *other = otherIt.getFirst(); other; other = otherIt.getNext())
+         {
+         if (other == store ||
+             (other->_isStore && other->_treeIndex < store->_treeIndex) ||
+             areSameTrees(store->_address, other->_address))
+            continue;
+
+         // A load that precedes the store must not read an element written
+         // by an earlier lane; a later load or store must not have its lane
+         // overwritten by a store of an earlier iteration
+         //
+         TR::Node *test;
+         if (!other->_isStore && other->_treeIndex <= store->_treeIndex)
+            test = createOverlapTest(store->_address, other->_address, entryBlock);
+         else
+            test = createOverlapTest(other->_address, store->_address, entryBlock);
+         lastGuard = appendBlock(lastGuard, test, NULL);
+         }
+      }
+
+   // Build the vector loop body from the trees of the original loop
+   //
+   TR::TreeTop *firstVectorTree = NULL;
+   TR::TreeTop *lastVectorTree = NULL;
+   ListIterator<TR::TreeTop> it(_bodyTrees);
+   for (TR::TreeTop *tt = it.getFirst(); tt != _ivStoreTree; tt = it.getNext())
+      {
+      TR::Node *node = tt->getNode();
+      TR::Node *vectorTreeNode = NULL;
+
+      if (node->getOpCode().isStoreIndirect())
+         {
+         TR::Node *address = node->getFirstChild()->duplicateTree();
+         TR::Node *value = createVectorNode(node->getSecondChild());
+         TR::SymbolReference *vectorShadow =
+            comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(_elementType.scalarToVector(), address);
+         vectorTreeNode = TR::Node::createWithSymRef(TR::vstorei, 2, 2, address, value, vectorShadow);
+         }
+      else if (node->getOpCode().isStoreDirect() &&
+               _vectorTemps->isSet(node->getSymbolReference()->getReferenceNumber()))
+         {
+         // Vector temps only live within one iteration of the single block
+         // vector loop, so the vector value is anchored and commoned instead
+         //
+         TR::Node *value = createVectorNode(node->getFirstChild());
+         (*_tempValues)[node->getSymbolReference()->getReferenceNumber()] = value;
+         vectorTreeNode = TR::Node::create(TR::treetop, 1, value);
+         }
+
+      if (vectorTreeNode)
+         {
+         TR::TreeTop *vectorTree = TR::TreeTop::create(comp(), vectorTreeNode);
+         if (lastVectorTree)
+            lastVectorTree->join(vectorTree);
+         else
+            firstVectorTree = vectorTree;
+         lastVectorTree = vectorTree;
+         }
+      }
+
+   TR::Node *ivIncrement = TR::Node::create(TR::iadd, 2,
+                              TR::Node::createLoad(ivStoreNode, ivSymRef),
+                              TR::Node::iconst(ivStoreNode, _vectorLength));
+   TR::TreeTop *ivTree = TR::TreeTop::create(comp(), TR::Node::createStore(ivSymRef, ivIncrement));
+   lastVectorTree->join(ivTree);
+
+   TR::Block *vectorBlock = appendBlock(lastGuard, NULL, firstVectorTree);
+   TR::Node *backEdgeTest = createFitsInVectorTest(continueIfEqual ? TR::iflcmple : TR::iflcmplt, vectorBlock);
+   vectorBlock->append(TR::TreeTop::create(comp(), backEdgeTest));
+   cfg->addEdge(TR::CFGEdge::createEdge(vectorBlock, vectorBlock, trMemory()));
+
+   // Skip the scalar loop when the vector loop has run all the iterations
+   //
+   TR::Node *exitTest = TR::Node::createif(continueIfEqual ? TR::ificmpgt : TR::ificmpge,
+                           TR::Node::createLoad(ivStoreNode, ivSymRef),
+                           _limit->duplicateTree(),
+                           _exitBlock->getEntry());
+   TR::Block *exitTestBlock = appendBlock(vectorBlock, exitTest, NULL);
+   cfg->addEdge(TR::CFGEdge::createEdge(exitTestBlock, entryBlock, trMemory()));
+
+   // Finally route the preheader to the first guard
+   //
+   TR::Node *preheaderLastNode = _preheader->getLastRealTreeTop()->getNode();
+   if (preheaderLastNode->getOpCode().isBranch() &&
+       preheaderLastNode->getBranchDestination() == entryBlock->getEntry())
+      preheaderLastNode->setBranchDestination(firstGuard->getEntry());
+   cfg->addEdge(TR::CFGEdge::createEdge(_preheader, firstGuard, trMemory()));
+   cfg->removeEdge(_preheader, entryBlock);
+
+   if (trace())
+      traceMsg(comp(), "Vector loop block_%d added in front of loop %d, guards block_%d to block_%d\n",
+               vectorBlock->getNumber(), loop->getNumber(), firstGuard->getNumber(), lastGuard->getNumber());
+   }
+
+TR::Node *
+TR_SPMDKernelParallelizer::createVectorNode(TR::Node *node)
+   {
+   NodeMap::iterator existing = _vectorNodes->find(node->getGlobalIndex());
+   if (existing != _vectorNodes->end())
+      return existing->second;
+
+   TR::Node *vectorNode;
+   TR::ILOpCode &op = node->getOpCode();
+   if (op.isLoadIndirect())
+      {
+      TR::Node *address = node->getFirstChild()->duplicateTree();
+      TR::SymbolReference *vectorShadow =
+         comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(_elementType.scalarToVector(), address);
+      vectorNode = TR::Node::createWithSymRef(TR::vloadi, 1, 1, address, vectorShadow);
+      }
+   else if (op.isLoadVarDirect() &&
+            _vectorTemps->isSet(node->getSymbolReference()->getReferenceNumber()))
+      {
+      // the temp was stored earlier in the body, so its vector value is known
+      //
+      vectorNode = (*_tempValues)[node->getSymbolReference()->getReferenceNumber()];
+      }
+   else if (op.isLoadVarDirect() || op.isLoadConst())
+      {
+      vectorNode = TR::Node::create(TR::vsplats, 1, node->duplicateTree());
+      }
+   else
+      {
+      TR::Node *firstChild = createVectorNode(node->getFirstChild());
+      TR::Node *secondChild = createVectorNode(node->getSecondChild());
+      vectorNode = TR::Node::create(TR::ILOpCode::convertScalarToVector(node->getOpCodeValue()), 2,
+                                    firstChild, secondChild);
+      }
+
+   (*_vectorNodes)[node->getGlobalIndex()] = vectorNode;
+   return vectorNode;
+   }
+
+// Branch to the destination when 0 < laterAddress - earlierAddress < vector size,
+// compared unsigned as (distance - 1) < (vector size - 1)
+//
+TR::Node *
+TR_SPMDKernelParallelizer::createOverlapTest(TR::Node *laterAddress, TR::Node *earlierAddress, TR::Block *destination)
+   {
+   TR::Node *test;
+   if (TR::Compiler->target.is64Bit())
+      {
+      TR::Node *distance = TR::Node::create(TR::lsub, 2,
+                              TR::Node::create(TR::a2l, 1, laterAddress->duplicateTree()),
+                              TR::Node::create(TR::a2l, 1, earlierAddress->duplicateTree()));
+      distance = TR::Node::create(TR::lsub, 2, distance, TR::Node::lconst(laterAddress, 1));
+      test = TR::Node::createif(TR::iflucmplt, distance,
+                                TR::Node::lconst(laterAddress, VECTOR_SIZE_IN_BYTES - 1),
+                                destination->getEntry());
+      }
+   else
+      {
+      TR::Node *distance = TR::Node::create(TR::isub, 2,
+                              TR::Node::create(TR::a2i, 1, laterAddress->duplicateTree()),
+                              TR::Node::create(TR::a2i, 1, earlierAddress->duplicateTree()));
+      distance = TR::Node::create(TR::isub, 2, distance, TR::Node::iconst(laterAddress, 1));
+      test = TR::Node::createif(TR::ifiucmplt, distance,
+                                TR::Node::iconst(laterAddress, VECTOR_SIZE_IN_BYTES - 1),
+                                destination->getEntry());
+      }
+   return test;
+   }
+
+// Compare i + VL - 1 against the loop limit in 64 bits so that the test
+// cannot overflow near the end of the int range
+//
+TR::Node *
+TR_SPMDKernelParallelizer::createFitsInVectorTest(TR::ILOpCodes longCompareOp, TR::Block *destination)
+   {
+   TR::Node *ivStoreNode = _ivStoreTree->getNode();
+   TR::Node *lastIndex = TR::Node::create(TR::ladd, 2,
+                            TR::Node::create(TR::i2l, 1, TR::Node::createLoad(ivStoreNode, _piv->getSymRef())),
+                            TR::Node::lconst(ivStoreNode, _vectorLength - 1));
+   return TR::Node::createif(longCompareOp, lastIndex,
+                             TR::Node::create(TR::i2l, 1, _limit->duplicateTree()),
+                             destination->getEntry());
+   }
+
+// Create a block ending in the given branch (if any) and lay it out right
+// after prevBlock. The branch edge and the fall through edge are added to
+// the CFG.
+//
+TR::Block *
+TR_SPMDKernelParallelizer::appendBlock(TR::Block *prevBlock, TR::Node *branchNode, TR::TreeTop *firstTree)
+   {
+   TR::CFG *cfg = comp()->getFlowGraph();
+   TR::Block *nextBlock = prevBlock->getNextBlock();
+   TR::Node *originNode = branchNode ? branchNode : firstTree->getNode();
+
+   TR::Block *block = TR::Block::createEmptyBlock(originNode, comp(), nextBlock->getFrequency(), nextBlock);
+   if (firstTree)
+      {
+      TR::TreeTop *lastTree = firstTree;
+      while (lastTree->getNextTreeTop())
+         lastTree = lastTree->getNextTreeTop();
+      block->getEntry()->join(firstTree);
+      lastTree->join(block->getExit());
+      }
+   if (branchNode)
+      block->append(TR::TreeTop::create(comp(), branchNode));
+
+   prevBlock->getExit()->join(block->getEntry());
+   block->getExit()->join(nextBlock->getEntry());
+
+   cfg->addNode(block);
+   if (prevBlock != _preheader)
+      cfg->addEdge(TR::CFGEdge::createEdge(prevBlock, block, trMemory()));
+   if (branchNode)
+      cfg->addEdge(TR::CFGEdge::createEdge(block, branchNode->getBranchDestination()->getNode()->getBlock(), trMemory()));
+   return block;
+   }
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2000, 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#ifndef SPMDPARALLELIZER_INCL
+#define SPMDPARALLELIZER_INCL
+
+#include <stdint.h>                           // for int32_t
+#include <map>                                // for std::map
+#include <utility>                            // for std::pair
+#include "env/TRMemory.hpp"                   // for TR_Memory, etc
+#include "env/TypedAllocator.hpp"             // for TR::typed_allocator
+#include "il/DataTypes.hpp"                   // for DataTypes
+#include "il/ILOpCodes.hpp"                   // for ILOpCodes
+#include "il/Node.hpp"                        // for Node, ncount_t
+#include "infra/List.hpp"                     // for List
+#include "optimizer/Optimization.hpp"         // for Optimization
+#include "optimizer/OptimizationManager.hpp"  // for OptimizationManager
+
+class TR_BitVector;
+class TR_PrimaryInductionVariable;
+class TR_RegionStructure;
+namespace TR { class Block; }
+namespace TR { class Node; }
+namespace TR { class NodeChecklist; }
+namespace TR { class SymbolReference; }
+namespace TR { class TreeTop; }
+
+/*
+ * Class TR_SPMDKernelParallelizer
+ * ===============================
+ *
+ * Auto-vectorizes innermost counted loops that walk arrays with unit stride.
+ * Induction variable analysis must have run immediately before so that the
+ * loops carry their primary induction variable. A loop such as
+ *
+ * for (i = lo; i < N; i++)
+ *    c[i] = a[i] * b[i] + k;
+ *
+ * is rewritten as
+ *
+ * if (i + VL - 1 < N && c does not overlap a or b within one vector)
+ *    {
+ *    do
+ *       {
+ *       c[i:VL] = a[i:VL] * b[i:VL] + splat(k);
+ *       i += VL;
+ *       }
+ *    while (i + VL - 1 < N);
+ *    if (i >= N) goto exit;
+ *    }
+ * original scalar loop, which now only runs the remaining iterations
+ *
+ * where VL is the number of elements held in one vector register. Array
+ * shadows of the same type give no static aliasing information, so every
+ * store that may overlap another access of the loop at a distance smaller
+ * than one vector is guarded by a runtime check that falls back to the
+ * scalar loop.
+ *
+ * The loop body must be straight line code consisting only of array stores,
+ * stores to temps that are not used outside the loop, the induction variable
+ * increment and the loop test. The stored values may be built from array
+ * loads at the same unit stride, loop invariant values and the arithmetic
+ * operations the code generator reports as supported for auto-SIMD.
+ */
+class TR_SPMDKernelParallelizer : public TR::Optimization
+   {
+   public:
+   TR_SPMDKernelParallelizer(TR::OptimizationManager *manager);
+   static TR::Optimization *create(TR::OptimizationManager *manager)
+      {
+      return new (manager->allocator()) TR_SPMDKernelParallelizer(manager);
+      }
+
+   virtual int32_t perform();
+
+   private:
+
+   struct ArrayAccess
+      {
+      TR_ALLOC(TR_Memory::LoopTransformer)
+      ArrayAccess(TR::Node *address, bool isStore, int32_t treeIndex)
+         : _address(address), _isStore(isStore), _treeIndex(treeIndex) {}
+
+      TR::Node *_address;
+      bool      _isStore;
+      int32_t   _treeIndex;   // position of the enclosing tree in the loop body
+      };
+
+   void collectInnerLoops(TR_RegionStructure *region, List<TR_RegionStructure> &innerLoops);
+
+   bool analyzeLoop(TR_RegionStructure *loop);
+   bool collectLoopBody(TR_RegionStructure *loop);
+   bool isUsedOutsideLoop(TR_RegionStructure *loop, TR_BitVector *symRefs);
+   bool setElementType(TR::DataType type);
+
+   bool isLoopInvariant(TR::Node *node);
+   bool isScalarExpression(TR::Node *node);
+   bool isVectorizable(TR::Node *node);
+   bool isUnitStrideAddress(TR::Node *address);
+   bool isUnitStrideIndex(TR::Node *index);
+   bool areSameTrees(TR::Node *a, TR::Node *b);
+
+   void transformLoop(TR_RegionStructure *loop);
+   TR::Node *createVectorNode(TR::Node *node);
+   TR::Node *createOverlapTest(TR::Node *laterAddress, TR::Node *earlierAddress, TR::Block *destination);
+   TR::Node *createFitsInVectorTest(TR::ILOpCodes longCompareOp, TR::Block *destination);
+   TR::Block *appendBlock(TR::Block *prevBlock, TR::Node *branchNode, TR::TreeTop *firstTree);
+
+   // State describing the loop currently being analyzed
+   //
+   TR_PrimaryInductionVariable *_piv;
+   TR::DataType                 _elementType;
+   int32_t                      _vectorLength;
+   List<TR::TreeTop>           *_bodyTrees;
+   List<ArrayAccess>           *_accesses;
+   TR_BitVector                *_storedSymRefs;
+   TR_BitVector                *_vectorTemps;
+   TR::NodeChecklist           *_vectorizableNodes;
+   TR::TreeTop                 *_ivStoreTree;
+   TR::Node                    *_limit;
+   TR::ILOpCodes                _continueOp;
+   TR::Block                   *_preheader;
+   TR::Block                   *_exitBlock;
+   int32_t                      _currentTreeIndex;
+
+   // Vector nodes created for the scalar nodes of the loop being transformed,
+   // keyed by the global index of the scalar node
+   //
+   typedef TR::typed_allocator<std::pair<const ncount_t, TR::Node*>, TR::Allocator> NodeMapAllocator;
+   typedef std::map<ncount_t, TR::Node*, std::less<ncount_t>, NodeMapAllocator> NodeMap;
+   NodeMap                     *_vectorNodes;
+   NodeMap                     *_tempValues;
+   };
+
+#endif
@@ -2374,3 +2374,183 @@ TR::Register *OMR::X86::TreeEvaluator::compareDoubleEvaluator(TR::Node *node, TR
                                                            useFCOMIInstructions, cg);
    return generateFPCompareResult(node, accRegister, cg);
    }
+
+// also handles TR::vloadi
+TR::Register *OMR::X86::TreeEvaluator::vloadEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   TR_ASSERT(node->getDataType().isVector(), "unrecognized vector type %s\n", node->getDataType().toString());
+
+   TR::MemoryReference  *sourceMR = generateX86MemoryReference(node, cg);
+   TR::Register *targetRegister = cg->allocateRegister(TR_FPR);
+   targetRegister->setIsVector();
+
+   TR::Instruction *instr = generateRegMemInstruction(MOVDQURegMem, node, targetRegister, sourceMR, cg);
+   if (node->getOpCode().isIndirect())
+      cg->setImplicitExceptionPoint(instr);
+
+   sourceMR->decNodeReferenceCounts(cg);
+   node->setRegister(targetRegister);
+   return targetRegister;
+   }
+
+// also handles TR::vstorei
+TR::Register *OMR::X86::TreeEvaluator::vstoreEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   TR::Node *valueChild = node->getOpCode().isIndirect() ? node->getSecondChild() : node->getFirstChild();
+   TR_ASSERT(valueChild->getDataType().isVector(), "unrecognized vector type %s\n", valueChild->getDataType().toString());
+
+   TR::Register *valueRegister = cg->evaluate(valueChild);
+   TR::MemoryReference  *targetMR = generateX86MemoryReference(node, cg);
+
+   TR::Instruction *instr = generateMemRegInstruction(MOVDQUMemReg, node, targetMR, valueRegister, cg);
+   if (node->getOpCode().isIndirect())
+      cg->setImplicitExceptionPoint(instr);
+
+   targetMR->decNodeReferenceCounts(cg);
+   cg->decReferenceCount(valueChild);
+   return NULL;
+   }
+
+TR::Register *OMR::X86::TreeEvaluator::vsplatsEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   TR::Node     *child          = node->getFirstChild();
+   TR::Register *childRegister  = cg->evaluate(child);
+   TR::Register *targetRegister = cg->allocateRegister(TR_FPR);
+   targetRegister->setIsVector();
+
+   // Move the scalar into the low element of the target, then replicate it
+   // with a doubleword shuffle: 0x00 copies doubleword 0 into every lane and
+   // 0x44 copies the low quadword into both halves.
+   //
+   switch (node->getDataType())
+      {
+      case TR::VectorInt32:
+         generateRegRegInstruction(MOVDRegReg4, node, targetRegister, childRegister, cg);
+         generateRegRegImmInstruction(PSHUFDRegRegImm1, node, targetRegister, targetRegister, 0x00, cg);
+         break;
+      case TR::VectorInt64:
+         TR_ASSERT(TR::Compiler->target.is64Bit(), "VectorInt64 vsplats is only supported on AMD64\n");
+         generateRegRegInstruction(MOVQRegReg8, node, targetRegister, childRegister, cg);
+         generateRegRegImmInstruction(PSHUFDRegRegImm1, node, targetRegister, targetRegister, 0x44, cg);
+         break;
+      case TR::VectorFloat:
+         TR_ASSERT(childRegister->getKind() == TR_FPR, "vsplats requires an XMM float operand\n");
+         generateRegRegImmInstruction(PSHUFDRegRegImm1, node, targetRegister, childRegister, 0x00, cg);
+         break;
+      case TR::VectorDouble:
+         TR_ASSERT(childRegister->getKind() == TR_FPR, "vsplats requires an XMM double operand\n");
+         generateRegRegImmInstruction(PSHUFDRegRegImm1, node, targetRegister, childRegister, 0x44, cg);
+         break;
+      default:
+         TR_ASSERT(false, "unrecognized vector type %s\n", node->getDataType().toString());
+         return NULL;
+      }
+
+   node->setRegister(targetRegister);
+   cg->decReferenceCount(child);
+   return targetRegister;
+   }
+
+// When AVX is available the three operand VEX form writes a fresh register and
+// leaves both sources intact; otherwise the first operand is clobbered in
+// place, after copying it if its value is still needed.
+//
+TR::Register *OMR::X86::TreeEvaluator::vectorBinaryArithmeticEvaluator(TR::Node *node,
+                                                                    TR_X86OpCodes sseOpCode,
+                                                                    TR_X86OpCodes avxOpCode,
+                                                                    TR::CodeGenerator *cg)
+   {
+   TR::Node     *firstChild     = node->getFirstChild();
+   TR::Node     *secondChild    = node->getSecondChild();
+   TR::Register *firstRegister  = cg->evaluate(firstChild);
+   TR::Register *secondRegister = cg->evaluate(secondChild);
+   TR::Register *targetRegister;
+
+   if (cg->getX86ProcessorInfo().supportsAVX())
+      {
+      targetRegister = cg->allocateRegister(TR_FPR);
+      targetRegister->setIsVector();
+      generateRegRegRegInstruction(avxOpCode, node, targetRegister, firstRegister, secondRegister, cg);
+      }
+   else
+      {
+      if (cg->canClobberNodesRegister(firstChild))
+         {
+         targetRegister = firstRegister;
+         }
+      else
+         {
+         targetRegister = cg->allocateRegister(TR_FPR);
+         targetRegister->setIsVector();
+         generateRegRegInstruction(MOVDQURegReg, node, targetRegister, firstRegister, cg);
+         }
+      generateRegRegInstruction(sseOpCode, node, targetRegister, secondRegister, cg);
+      }
+
+   node->setRegister(targetRegister);
+   cg->decReferenceCount(firstChild);
+   cg->decReferenceCount(secondChild);
+   return targetRegister;
+   }
+
+TR::Register *OMR::X86::TreeEvaluator::vaddEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   switch (node->getDataType())
+      {
+      case TR::VectorInt32:  return vectorBinaryArithmeticEvaluator(node, PADDD, VPADDDRegRegReg, cg);
+      case TR::VectorInt64:  return vectorBinaryArithmeticEvaluator(node, PADDQRegReg, VPADDQRegRegReg, cg);
+      case TR::VectorFloat:  return vectorBinaryArithmeticEvaluator(node, ADDPSRegReg, VADDPSRegRegReg, cg);
+      case TR::VectorDouble: return vectorBinaryArithmeticEvaluator(node, ADDPDRegReg, VADDPDRegRegReg, cg);
+      default: TR_ASSERT(false, "unrecognized vector type %s\n", node->getDataType().toString()); return NULL;
+      }
+   }
+
+TR::Register *OMR::X86::TreeEvaluator::vsubEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   switch (node->getDataType())
+      {
+      case TR::VectorInt32:  return vectorBinaryArithmeticEvaluator(node, PSUBDRegReg, VPSUBDRegRegReg, cg);
+      case TR::VectorInt64:  return vectorBinaryArithmeticEvaluator(node, PSUBQRegReg, VPSUBQRegRegReg, cg);
+      case TR::VectorFloat:  return vectorBinaryArithmeticEvaluator(node, SUBPSRegReg, VSUBPSRegRegReg, cg);
+      case TR::VectorDouble: return vectorBinaryArithmeticEvaluator(node, SUBPDRegReg, VSUBPDRegRegReg, cg);
+      default: TR_ASSERT(false, "unrecognized vector type %s\n", node->getDataType().toString()); return NULL;
+      }
+   }
+
+TR::Register *OMR::X86::TreeEvaluator::vmulEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   switch (node->getDataType())
+      {
+      case TR::VectorInt32:
+         TR_ASSERT(cg->getX86ProcessorInfo().supportsAVX() || cg->getX86ProcessorInfo().supportsSSE4_1(), "VectorInt32 vmul requires SSE4.1\n");
+         return vectorBinaryArithmeticEvaluator(node, PMULLD, VPMULLDRegRegReg, cg);
+      case TR::VectorFloat:  return vectorBinaryArithmeticEvaluator(node, MULPSRegReg, VMULPSRegRegReg, cg);
+      case TR::VectorDouble: return vectorBinaryArithmeticEvaluator(node, MULPDRegReg, VMULPDRegRegReg, cg);
+      default: TR_ASSERT(false, "unrecognized vector type %s\n", node->getDataType().toString()); return NULL;
+      }
+   }
+
+TR::Register *OMR::X86::TreeEvaluator::vdivEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   switch (node->getDataType())
+      {
+      case TR::VectorFloat:  return vectorBinaryArithmeticEvaluator(node, DIVPSRegReg, VDIVPSRegRegReg, cg);
+      case TR::VectorDouble: return vectorBinaryArithmeticEvaluator(node, DIVPDRegReg, VDIVPDRegRegReg, cg);
+      default: TR_ASSERT(false, "unrecognized vector type %s\n", node->getDataType().toString()); return NULL;
+      }
+   }
+
+TR::Register *OMR::X86::TreeEvaluator::vandEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   return vectorBinaryArithmeticEvaluator(node, PANDRegReg, VPANDRegRegReg, cg);
+   }
+
+TR::Register *OMR::X86::TreeEvaluator::vorEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   return vectorBinaryArithmeticEvaluator(node, PORRegReg, VPORRegRegReg, cg);
+   }
+
+TR::Register *OMR::X86::TreeEvaluator::vxorEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   return vectorBinaryArithmeticEvaluator(node, PXORRegReg, VPXORRegRegReg, cg);
+   }
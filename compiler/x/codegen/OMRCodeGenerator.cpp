@@ -124,6 +124,7 @@ void TR_X86ProcessorInfo::initialize(TR::Compilation *comp)
    //
    _featureFlags.set(TR::Compiler->target.cpu.getX86ProcessorFeatureFlags(comp));
    _featureFlags2.set(TR::Compiler->target.cpu.getX86ProcessorFeatureFlags2(comp));
+   _featureFlags8.set(TR::Compiler->target.cpu.getX86ProcessorFeatureFlags8(comp));
 
    // Determine the processor vendor.
    //
@@ -418,6 +419,11 @@ OMR::X86::CodeGenerator::initialize(TR::Compilation *comp)
       self()->setSupportsArrayTranslateTROTNoBreak();
       }
 
+   // 128-bit vector IL is evaluated into XMM registers
+   //
+   if (self()->useSSEForDoublePrecision())
+      self()->setSupportsAutoSIMD();
+
    if (!comp->getOption(TR_DisableRegisterPressureSimulation))
       {
       for (int32_t i = 0; i < TR_numSpillKinds; i++)
@@ -974,6 +980,46 @@ OMR::X86::CodeGenerator::getSupportsEncodeUtf16LittleWithSurrogateTest()
           !self()->comp()->getOptions()->getOption(TR_DisableSIMDUTF16LEEncoder);
    }
 
+bool
+OMR::X86::CodeGenerator::getSupportsOpCodeForAutoSIMD(TR::ILOpCode opcode, TR::DataType dt)
+   {
+   // implemented vector opcodes
+   switch (opcode.getOpCodeValue())
+      {
+      case TR::vadd:
+      case TR::vsub:
+         if (dt == TR::Int32 || dt == TR::Int64 || dt == TR::Float || dt == TR::Double)
+            return true;
+         break;
+      case TR::vmul:
+         if (dt == TR::Float || dt == TR::Double)
+            return true;
+         if (dt == TR::Int32)
+            return self()->getX86ProcessorInfo().supportsSSE4_1() || self()->getX86ProcessorInfo().supportsAVX();
+         break;
+      case TR::vdiv:
+         if (dt == TR::Float || dt == TR::Double)
+            return true;
+         break;
+      case TR::vload:
+      case TR::vloadi:
+      case TR::vstore:
+      case TR::vstorei:
+      case TR::vxor:
+      case TR::vor:
+      case TR::vand:
+         return true;
+      case TR::vsplats:
+         if (dt == TR::Int64)
+            return TR::Compiler->target.is64Bit();
+         return true;
+      default:
+         return false;
+      }
+
+   return false;
+   }
+
 bool
 OMR::X86::CodeGenerator::getSupportsEncodeUtf16BigWithSurrogateTest()
    {
@@ -166,11 +166,19 @@ struct TR_X86ProcessorInfo
       TR_SSE3                          = 0x00000001,
       TR_Monitor                       = 0x00000008,
       TR_SpeedStep                     = 0x00000080,
+      TR_FMA                           = 0x00001000,
       TR_CMPXCHG16BInstruction         = 0x00002000,
       TR_SSE4_1                        = 0x00080000,
       TR_SSE4_2                        = 0x00100000,
       TR_POPCNT                        = 0x00800000,
-      TR_AESNI                         = 0x02000000
+      TR_AESNI                         = 0x02000000,
+      TR_OSXSAVE                       = 0x08000000,
+      TR_AVX                           = 0x10000000  // cleared by jitGetCPUID unless the OS saves the YMM state
+      };
+
+   enum TR_X86ProcessorFeatures8
+      {
+      TR_AVX2                          = 0x00000020
       };
 
 
@@ -228,6 +236,9 @@ struct TR_X86ProcessorInfo
    bool supportsSSE4_2()                   {return _featureFlags2.testAny(TR_SSE4_2);}
    bool supportsAESNI()                    {return _featureFlags2.testAny(TR_AESNI);}
    bool supportsPOPCNT()                   {return _featureFlags2.testAny(TR_POPCNT);}
+   bool supportsAVX()                      {return _featureFlags2.testAll(TR_AVX | TR_OSXSAVE);}
+   bool supportsAVX2()                     {return supportsAVX() && _featureFlags8.testAny(TR_AVX2);}
+   bool supportsFMA()                      {return supportsAVX() && _featureFlags2.testAny(TR_FMA);}
    bool supportsSelfSnoop()                {return _featureFlags.testAny(TR_SelfSnoop);}
    bool supportsHyperThreading()           {return _featureFlags.testAny(TR_HyperThreading);}
    bool hasThermalMonitor()                {return _featureFlags.testAny(TR_ThermalMonitor);}
@@ -273,6 +284,7 @@ private:
    flags8_t   _vendorFlags;
    flags32_t  _featureFlags;  // cache feature flags for re-use
    flags32_t  _featureFlags2;  // cache feature flags 2 for re-use
+   flags32_t  _featureFlags8;  // cache feature flags 8 for re-use
 
    uint32_t _processorDescription;
 
@@ -351,6 +363,8 @@ class OMR_EXTENSIBLE CodeGenerator : public OMR::CodeGenerator
    bool hasComplexAddressingMode() { return true; }
    bool getSupportsBitOpCodes() { return true; }
 
+   bool getSupportsOpCodeForAutoSIMD(TR::ILOpCode, TR::DataType);
+
    bool getSupportsEncodeUtf16LittleWithSurrogateTest();
    bool getSupportsEncodeUtf16BigWithSurrogateTest();
 
@@ -916,7 +916,7 @@ TR::RealRegister *OMR::X86::Machine::freeBestGPRegister(TR::Instruction
             }
          else
             {
-            location = self()->cg()->allocateSpill(bestRegister->isSinglePrecision()? 4 : 8, false, &offset);
+            location = self()->cg()->allocateSpill(bestRegister->isVector()? 16 : bestRegister->isSinglePrecision()? 4 : 8, false, &offset);
             }
          }
       else
@@ -981,7 +981,10 @@ TR::RealRegister *OMR::X86::Machine::freeBestGPRegister(TR::Instruction
       TR_X86OpCodes op;
       if (bestRegister->getKind() == TR_FPR)
          {
-         op = (bestRegister->isSinglePrecision()) ? MOVSSRegMem : (self()->cg()->getXMMDoubleLoadOpCode());
+         if (bestRegister->isVector())
+            op = MOVDQURegMem;
+         else
+            op = (bestRegister->isSinglePrecision()) ? MOVSSRegMem : (self()->cg()->getXMMDoubleLoadOpCode());
          }
       else
          {
@@ -1083,7 +1086,7 @@ TR::RealRegister *OMR::X86::Machine::reverseGPRSpillState(TR::Instruction     *c
          instr = new (self()->cg()->trHeapMemory())
             TR::X86MemRegInstruction(
                currentInstruction,
-               spilledRegister->isSinglePrecision() ? MOVSSMemReg : MOVSDMemReg,
+               spilledRegister->isVector() ? MOVDQUMemReg : spilledRegister->isSinglePrecision() ? MOVSSMemReg : MOVSDMemReg,
                tempMR,
                targetRegister, self()->cg());
 
@@ -1091,7 +1094,7 @@ TR::RealRegister *OMR::X86::Machine::reverseGPRSpillState(TR::Instruction     *c
          // This is to enforce re-use of the same spill slot for a virtual register
          // while assigning non-linear control flow regions.
          //
-         self()->cg()->freeSpill(location, spilledRegister->isSinglePrecision()? 4:8, spilledRegister->isSpilledToSecondHalf()? 4:0);
+         self()->cg()->freeSpill(location, spilledRegister->isVector()? 16 : spilledRegister->isSinglePrecision()? 4:8, spilledRegister->isSpilledToSecondHalf()? 4:0);
          if (!self()->cg()->isFreeSpillListLocked())
             {
             spilledRegister->setBackingStorage(NULL);
@@ -2278,7 +2281,7 @@ void OMR::X86::Machine::disassociateUnspilledBackingStorage()
 
          if (location)
             {
-            int32_t size = (virtReg->getKind() == TR_FPR) ? (virtReg->isSinglePrecision() ? 4:8) : TR::Compiler->om.sizeofReferenceAddress();
+            int32_t size = (virtReg->getKind() == TR_FPR) ? (virtReg->isVector() ? 16 : virtReg->isSinglePrecision() ? 4:8) : TR::Compiler->om.sizeofReferenceAddress();
             self()->cg()->freeSpill(location, size, virtReg->isSpilledToSecondHalf()? 4:0);
             virtReg->setBackingStorage(NULL);
 
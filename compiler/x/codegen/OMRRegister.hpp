@@ -102,6 +102,9 @@ class OMR_EXTENSIBLE Register: public OMR::Register
    bool isSpilledToSecondHalf()                 {return _flags.testAny(SpilledToSecondHalf);}
    void setIsSpilledToSecondHalf(bool b = true) {_flags.set(SpilledToSecondHalf, b);}
 
+   bool isVector()                          {return _flags.testAny(IsVector);}
+   void setIsVector(bool b = true)          {_flags.set(IsVector, b);}
+
 
    private:
 
@@ -121,6 +124,7 @@ class OMR_EXTENSIBLE Register: public OMR::Register
       SpilledToSecondHalf           = 0x4000, // Spilled at an offset starting at the middle of the spill slot
       IsDiscardable                 = 0x0020, // Register is currently discardable
       ByteRegisterAssigned          = 0x0200,
+      IsVector                      = 0x1000, // XMM register holding a whole 128-bit vector, which must be spilled and reloaded in full
       };
 
    //Both x and z have this field, but power has own specialization, may move to base
@@ -779,7 +779,10 @@ void TR_X86RegisterDependencyGroup::assignRegisters(TR::Instruction   *currentIn
                TR_X86OpCodes op;
                if (assignedReg->getKind() == TR_FPR)
                   {
-                  op = (assignedReg->isSinglePrecision()) ? MOVSSRegMem : (cg->getXMMDoubleLoadOpCode());
+                  if (virtReg->isVector())
+                     op = MOVDQURegMem;
+                  else
+                     op = (assignedReg->isSinglePrecision()) ? MOVSSRegMem : (cg->getXMMDoubleLoadOpCode());
                   }
                else
                   {
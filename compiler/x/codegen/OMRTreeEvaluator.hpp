@@ -283,6 +283,18 @@ class TreeEvaluator: public OMR::TreeEvaluator
    // routines for floating point values that can fit in one GPR
    static TR::Register *floatingPointStoreEvaluator(TR::Node *node, TR::CodeGenerator *cg);
 
+   // routines for 128-bit vectors held in XMM registers
+   static TR::Register *vloadEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *vstoreEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *vsplatsEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *vaddEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *vsubEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *vmulEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *vdivEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *vandEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *vorEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+   static TR::Register *vxorEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+
    static TR::Register *icmpsetEvaluator(TR::Node *node, TR::CodeGenerator *cg);
    static TR::Register *bztestnsetEvaluator(TR::Node *node, TR::CodeGenerator *cg);
 
@@ -360,6 +372,7 @@ class TreeEvaluator: public OMR::TreeEvaluator
    static TR::Register *negEvaluatorHelper(TR::Node *node, TR_X86OpCodes RegInstr, TR::CodeGenerator *cg);
    static TR::Register *logicalEvaluator(TR::Node *node, TR_X86OpCodes package[], TR::CodeGenerator *cg);
    static TR::Register *fpBinaryArithmeticEvaluator(TR::Node *node, bool isFloat, TR::CodeGenerator *cg);
+   static TR::Register *vectorBinaryArithmeticEvaluator(TR::Node *node, TR_X86OpCodes sseOpCode, TR_X86OpCodes avxOpCode, TR::CodeGenerator *cg);
    static TR::Register *bcmpEvaluator(TR::Node *node, TR_X86OpCodes setOp, TR::CodeGenerator *cg);
    static TR::Register *cmp2BytesEvaluator(TR::Node *node, TR_X86OpCodes setOp, TR::CodeGenerator *cg);
 
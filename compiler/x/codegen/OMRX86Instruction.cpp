@@ -1491,10 +1491,19 @@ void TR::X86RegRegRegInstruction::assignRegisters(TR_RegisterKinds kindsToBeAssi
          {
          firstRequestedRegSize = TR_ByteReg;
          }
+      else if (getOpCode().hasXMMTarget())
+         {
+         firstRequestedRegSize = TR_QuadWordReg;
+         }
       if (getOpCode().hasByteSource())
          {
          secondRequestedRegSize = TR_ByteReg;
          }
+      else if (getOpCode().hasXMMSource())
+         {
+         secondRequestedRegSize = TR_QuadWordReg;
+         thirdRequestedRegSize  = TR_QuadWordReg;
+         }
 
       secondRegister->block();
       thirdRegister->block();
@@ -4907,6 +4916,12 @@ generateRegRegImmInstruction(TR_X86OpCodes op, TR::Node * node, TR::Register * t
    return new (cg->trHeapMemory()) TR::X86RegRegImmInstruction(op, node, treg, sreg, imm, cg);
    }
 
+TR::X86RegRegRegInstruction  *
+generateRegRegRegInstruction(TR_X86OpCodes op, TR::Node * node, TR::Register * treg, TR::Register * slreg, TR::Register * srreg, TR::CodeGenerator *cg)
+   {
+   return new (cg->trHeapMemory()) TR::X86RegRegRegInstruction(op, node, treg, slreg, srreg, cg);
+   }
+
 TR::X86CallMemInstruction  *
 generateCallMemInstruction(TR_X86OpCodes                       op,
                            TR::Node                             *node,
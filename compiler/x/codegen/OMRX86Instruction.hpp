@@ -1340,6 +1340,25 @@ class X86RegRegRegInstruction : public TR::X86RegRegInstruction
    virtual bool defsRegister(TR::Register *reg);
    virtual bool usesRegister(TR::Register *reg);
 
+   virtual uint8_t *generateBinaryEncoding();
+   virtual int32_t estimateBinaryLength(int32_t currentEstimate);
+   virtual uint8_t  getBinaryLengthLowerBound();
+   virtual OMR::X86::EnlargementResult  enlarge(int32_t requestedEnlargementSize, int32_t maxEnlargementSize, bool allowPartialEnlargement);
+
+#if defined(TR_TARGET_64BIT)
+   // The R and B bits are carried by the VEX prefix: the target is in the reg
+   // field of the ModRM byte and the right source in its RM field.
+   //
+   virtual uint8_t rexBits()
+      {
+      return
+           operandSizeRexBits()
+         | toRealRegister(getTargetRegister())->rexBits(TR::RealRegister::REX_R, false)
+         | toRealRegister(getSourceRightRegister())->rexBits(TR::RealRegister::REX_B, false)
+         ;
+      }
+#endif
+
 #ifdef DEBUG
    virtual uint32_t getNumOperandReferencedGPRegisters() { return 3; }
 #endif
@@ -2417,7 +2436,7 @@ class X86FPRegRegInstruction : public TR::X86RegRegInstruction
 
    virtual char *description() { return "X86FPRegReg"; }
 
-   virtual Kind getKind() { return IsRegRegReg; }
+   virtual Kind getKind() { return IsFPRegReg; }
 
    enum EassignmentResults
       {
@@ -3066,6 +3085,8 @@ TR::X86RegMemImmInstruction  * generateRegMemImmInstruction(TR_X86OpCodes op, TR
 
 TR::X86RegRegImmInstruction  * generateRegRegImmInstruction(TR_X86OpCodes op, TR::Node *, TR::Register * reg1, TR::Register * reg2, int32_t imm, TR::CodeGenerator *cg);
 
+TR::X86RegRegRegInstruction  * generateRegRegRegInstruction(TR_X86OpCodes op, TR::Node *, TR::Register * treg, TR::Register * slreg, TR::Register * srreg, TR::CodeGenerator *cg);
+
 TR::X86CallMemInstruction  * generateCallMemInstruction(TR_X86OpCodes op, TR::Node *, TR::MemoryReference  * mr, TR::RegisterDependencyConditions  *, TR::CodeGenerator *cg);
 
 TR::X86CallMemInstruction  * generateCallMemInstruction(TR_X86OpCodes op, TR::Node *, TR::MemoryReference  * mr, TR::CodeGenerator *cg);
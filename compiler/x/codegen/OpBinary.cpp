@@ -877,6 +877,32 @@ const TR_X86OpCode::TR_OpCodeBinaryEntry TR_X86OpCode::_binaryEncodings[IA32NumO
       {0x0f, 0x55, 0xc0, 3},    // ANDNPDRegReg
       {0x73, 0xf0, 0x00, 2},    // PSLLQRegImm1
       {0x73, 0xd0, 0x00, 2},    // PSRLQRegImm1
+      {0x0f, 0x5c, 0xc0, 3},    // SUBPSRegReg
+      {0x0f, 0x5c, 0xc0, 3},    // SUBPDRegReg
+      {0x0f, 0x5e, 0xc0, 3},    // DIVPSRegReg
+      {0x0f, 0x5e, 0xc0, 3},    // DIVPDRegReg
+      {0x0f, 0xd4, 0xc0, 3},    // PADDQRegReg
+      {0x0f, 0xfa, 0xc0, 3},    // PSUBDRegReg
+      {0x0f, 0xfb, 0xc0, 3},    // PSUBQRegReg
+      {0x0f, 0xdb, 0xc0, 3},    // PANDRegReg
+      {0x0f, 0xeb, 0xc0, 3},    // PORRegReg
+      {0x0f, 0xef, 0xc0, 3},    // PXORRegReg
+      {0x0f, 0x58, 0xc0, 3},    // VADDPSRegRegReg
+      {0x0f, 0x58, 0xc0, 3},    // VADDPDRegRegReg
+      {0x0f, 0x5c, 0xc0, 3},    // VSUBPSRegRegReg
+      {0x0f, 0x5c, 0xc0, 3},    // VSUBPDRegRegReg
+      {0x0f, 0x59, 0xc0, 3},    // VMULPSRegRegReg
+      {0x0f, 0x59, 0xc0, 3},    // VMULPDRegRegReg
+      {0x0f, 0x5e, 0xc0, 3},    // VDIVPSRegRegReg
+      {0x0f, 0x5e, 0xc0, 3},    // VDIVPDRegRegReg
+      {0x0f, 0xfe, 0xc0, 3},    // VPADDDRegRegReg
+      {0x0f, 0xd4, 0xc0, 3},    // VPADDQRegRegReg
+      {0x0f, 0xfa, 0xc0, 3},    // VPSUBDRegRegReg
+      {0x0f, 0xfb, 0xc0, 3},    // VPSUBQRegRegReg
+      {0x38, 0x40, 0xc0, 3},    // VPMULLDRegRegReg
+      {0x0f, 0xdb, 0xc0, 3},    // VPANDRegRegReg
+      {0x0f, 0xeb, 0xc0, 3},    // VPORRegRegReg
+      {0x0f, 0xef, 0xc0, 3},    // VPXORRegRegReg
       {0x00, 0x00, 0x00, 0},    // FENCE
       {0x00, 0x00, 0x00, 0},    // VGFENCE
       {0x00, 0x00, 0x00, 0},    // PROCENTRY
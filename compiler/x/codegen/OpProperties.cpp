@@ -3842,9 +3842,13 @@ const uint32_t TR_X86OpCode::_properties[IA32NumOpCodes] =
 
    IA32OpProp_SourceRegisterInModRM,           // PMOVZXWD
 
-   IA32OpProp_SourceRegisterInModRM,           // PMULLD
+   IA32OpProp_ModifiesTarget                 | // PMULLD
+   IA32OpProp_SourceRegisterInModRM          |
+   IA32OpProp_UsesTarget,
 
-   IA32OpProp_SourceRegisterInModRM,           // PADDD
+   IA32OpProp_ModifiesTarget                 | // PADDD
+   IA32OpProp_SourceRegisterInModRM          |
+   IA32OpProp_UsesTarget,
 
    IA32OpProp_ModifiesTarget                 | // PSHUFDRegRegImm1
    IA32OpProp_ByteImmediate                  |
@@ -6161,6 +6165,125 @@ const uint32_t TR_X86OpCode::_properties[IA32NumOpCodes] =
    IA32OpProp_TargetRegisterInModRM          |
    IA32OpProp_UsesTarget,
 
+   IA32OpProp_ModifiesTarget                 | // SUBPSRegReg
+   IA32OpProp_SingleFP                       |
+   IA32OpProp_SourceRegisterInModRM          |
+   IA32OpProp_UsesTarget,
+
+   IA32OpProp_ModifiesTarget                 | // SUBPDRegReg
+   IA32OpProp_DoubleFP                       |
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM          |
+   IA32OpProp_UsesTarget,
+
+   IA32OpProp_ModifiesTarget                 | // DIVPSRegReg
+   IA32OpProp_SingleFP                       |
+   IA32OpProp_SourceRegisterInModRM          |
+   IA32OpProp_UsesTarget,
+
+   IA32OpProp_ModifiesTarget                 | // DIVPDRegReg
+   IA32OpProp_DoubleFP                       |
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM          |
+   IA32OpProp_UsesTarget,
+
+   IA32OpProp_ModifiesTarget                 | // PADDQRegReg
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM          |
+   IA32OpProp_UsesTarget,
+
+   IA32OpProp_ModifiesTarget                 | // PSUBDRegReg
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM          |
+   IA32OpProp_UsesTarget,
+
+   IA32OpProp_ModifiesTarget                 | // PSUBQRegReg
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM          |
+   IA32OpProp_UsesTarget,
+
+   IA32OpProp_ModifiesTarget                 | // PANDRegReg
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM          |
+   IA32OpProp_UsesTarget,
+
+   IA32OpProp_ModifiesTarget                 | // PORRegReg
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM          |
+   IA32OpProp_UsesTarget,
+
+   IA32OpProp_ModifiesTarget                 | // PXORRegReg
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM          |
+   IA32OpProp_UsesTarget,
+
+   IA32OpProp_ModifiesTarget                 | // VADDPSRegRegReg
+   IA32OpProp_SingleFP                       |
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VADDPDRegRegReg
+   IA32OpProp_DoubleFP                       |
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VSUBPSRegRegReg
+   IA32OpProp_SingleFP                       |
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VSUBPDRegRegReg
+   IA32OpProp_DoubleFP                       |
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VMULPSRegRegReg
+   IA32OpProp_SingleFP                       |
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VMULPDRegRegReg
+   IA32OpProp_DoubleFP                       |
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VDIVPSRegRegReg
+   IA32OpProp_SingleFP                       |
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VDIVPDRegRegReg
+   IA32OpProp_DoubleFP                       |
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VPADDDRegRegReg
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VPADDQRegRegReg
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VPSUBDRegRegReg
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VPSUBQRegRegReg
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VPMULLDRegRegReg
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VPANDRegRegReg
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VPORRegRegReg
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM,
+
+   IA32OpProp_ModifiesTarget                 | // VPXORRegRegReg
+   IA32OpProp_Needs16BitOperandPrefix        |
+   IA32OpProp_SourceRegisterInModRM,
+
    0,                                          // FENCE
 
    0,                                          // VGFENCE
@@ -8599,6 +8722,101 @@ const uint32_t TR_X86OpCode::_properties2[IA32NumOpCodes] =
    IA32OpProp2_XMMTarget                     |
    IA32OpProp2_NeedsSSE42OpcodePrefix,
 
+   IA32OpProp2_XMMSource                     | // SUBPSRegReg
+   IA32OpProp2_XMMTarget,
+
+   IA32OpProp2_XMMSource                     | // SUBPDRegReg
+   IA32OpProp2_XMMTarget,
+
+   IA32OpProp2_XMMSource                     | // DIVPSRegReg
+   IA32OpProp2_XMMTarget,
+
+   IA32OpProp2_XMMSource                     | // DIVPDRegReg
+   IA32OpProp2_XMMTarget,
+
+   IA32OpProp2_XMMSource                     | // PADDQRegReg
+   IA32OpProp2_XMMTarget,
+
+   IA32OpProp2_XMMSource                     | // PSUBDRegReg
+   IA32OpProp2_XMMTarget,
+
+   IA32OpProp2_XMMSource                     | // PSUBQRegReg
+   IA32OpProp2_XMMTarget,
+
+   IA32OpProp2_XMMSource                     | // PANDRegReg
+   IA32OpProp2_XMMTarget,
+
+   IA32OpProp2_XMMSource                     | // PORRegReg
+   IA32OpProp2_XMMTarget,
+
+   IA32OpProp2_XMMSource                     | // PXORRegReg
+   IA32OpProp2_XMMTarget,
+
+   IA32OpProp2_XMMSource                     | // VADDPSRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VADDPDRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VSUBPSRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VSUBPDRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VMULPSRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VMULPDRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VDIVPSRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VDIVPDRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VPADDDRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VPADDQRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VPSUBDRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VPSUBQRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VPMULLDRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsSSE42OpcodePrefix        |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VPANDRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VPORRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
+   IA32OpProp2_XMMSource                     | // VPXORRegRegReg
+   IA32OpProp2_XMMTarget                     |
+   IA32OpProp2_NeedsVEXPrefix,
+
    IA32OpProp2_CannotBeAssembled,              // FENCE
    IA32OpProp2_CannotBeAssembled,              // VGFENCE
    IA32OpProp2_CannotBeAssembled,              // PROCENTRY
@@ -2021,6 +2021,106 @@ int32_t TR::X86RegRegImmInstruction::estimateBinaryLength(int32_t currentEstimat
    }
 
 
+// -----------------------------------------------------------------------------
+// TR::X86RegRegRegInstruction:: member functions
+
+// Three operand instructions are AVX instructions.  Their opcode table entries
+// hold the encoding of the equivalent SSE instruction, and the VEX prefix takes
+// the place of its 66/F2/F3 prefix, its REX prefix and its 0F, 0F38 or 0F3A
+// escape bytes.  The left source register goes in the vvvv field of the prefix.
+//
+uint8_t *TR::X86RegRegRegInstruction::generateBinaryEncoding()
+   {
+   // *this    swipeable for debugging purposes
+   TR_ASSERT(getOpCode().needsVEXPrefix(), "generateBinaryEncoding() ==> three operand instruction needs a VEX prefix\n");
+
+   uint8_t *instructionStart = cg()->getBinaryBufferCursor();
+   uint8_t *cursor           = instructionStart;
+
+   uint8_t legacyEncoding[4];
+   getOpCode().copyBinaryToBuffer(legacyEncoding);
+   uint8_t *opCode = legacyEncoding;
+   if (!getOpCode().needsSSE42OpcodePrefix())
+      {
+      TR_ASSERT(*opCode == 0x0f, "generateBinaryEncoding() ==> VEX instruction must have a 0F escape byte\n");
+      opCode++;
+      }
+
+   uint8_t opCodeMap = 1;
+   if (*opCode == 0x38)
+      {
+      opCodeMap = 2;
+      opCode++;
+      }
+   else if (*opCode == 0x3a)
+      {
+      opCodeMap = 3;
+      opCode++;
+      }
+
+   uint8_t impliedPrefix = 0;
+   if (getOpCode().needs16BitOperandPrefix() || getOpCode().needsSSE42OpcodePrefix())
+      {
+      impliedPrefix = 1;
+      }
+   else if (getOpCode().needsScalarPrefix())
+      {
+      impliedPrefix = getOpCode().singleFPOp() ? 2 : 3;
+      }
+
+   uint8_t rex = rexBits();
+   if (opCodeMap == 1 &&
+       !(rex & (TR::RealRegister::REX_W | TR::RealRegister::REX_X | TR::RealRegister::REX_B)))
+      {
+      *cursor++ = IA32VEX2BytePrefix;
+      *cursor = (rex & TR::RealRegister::REX_R) ? 0x00 : 0x80;
+      }
+   else
+      {
+      *cursor++ = IA32VEX3BytePrefix;
+      *cursor++ = ((~rex & (TR::RealRegister::REX_R | TR::RealRegister::REX_X | TR::RealRegister::REX_B)) << 5) | opCodeMap;
+      *cursor = (rex & TR::RealRegister::REX_W) ? 0x80 : 0x00;
+      }
+   toRealRegister(getSourceRegister())->setVEXRegisterField(cursor);
+   *cursor++ |= impliedPrefix; // 128-bit vector length
+
+   *cursor++ = *opCode++;
+   uint8_t *modRM = cursor;
+   *cursor++ = *opCode;
+   toRealRegister(getTargetRegister())->setRegisterFieldInModRM(modRM);
+   toRealRegister(getSourceRightRegister())->setRMRegisterFieldInModRM(modRM);
+
+   setBinaryLength(cursor - instructionStart);
+   setBinaryEncoding(instructionStart);
+   cg()->addAccumulatedInstructionLengthError(getEstimatedBinaryLength() - getBinaryLength());
+   return cursor;
+   }
+
+uint8_t TR::X86RegRegRegInstruction::getBinaryLengthLowerBound()
+   {
+   // Two byte VEX prefix, opcode and ModRM
+   //
+   return 4;
+   }
+
+int32_t TR::X86RegRegRegInstruction::estimateBinaryLength(int32_t currentEstimate)
+   {
+   // *this    swipeable for debugging purposes
+   // Three byte VEX prefix, opcode and ModRM
+   //
+   setEstimatedBinaryLength(5);
+   return currentEstimate + getEstimatedBinaryLength();
+   }
+
+OMR::X86::EnlargementResult
+TR::X86RegRegRegInstruction::enlarge(int32_t requestedEnlargementSize, int32_t maxEnlargementSize, bool allowPartialEnlargement)
+   {
+   // A REX prefix cannot precede a VEX prefix
+   //
+   return OMR::X86::EnlargementResult(0, 0);
+   }
+
+
 // -----------------------------------------------------------------------------
 // TR::X86MemInstruction:: member functions
 
@@ -121,6 +121,9 @@ TR_Debug::printx(TR::FILE *pOutFile, TR::Instruction  * instr)
       case TR::Instruction::IsRegRegImm:
          print(pOutFile, (TR::X86RegRegImmInstruction  *)instr);
          break;
+      case TR::Instruction::IsRegRegReg:
+         print(pOutFile, (TR::X86RegRegRegInstruction  *)instr);
+         break;
       case TR::Instruction::IsFPRegReg:
       case TR::Instruction::IsFPST0ST1RegReg:
       case TR::Instruction::IsFPST0STiRegReg:
@@ -1151,7 +1154,7 @@ TR_Debug::print(TR::FILE *pOutFile, TR::X86RegRegRegInstruction  * instr)
       trfprintf(pOutFile, ", ");
       }
 
-   if (instr->getOpCodeValue() == SHLD4RegRegCL || instr->getOpCodeValue() <= SHRD4RegRegCL)
+   if (instr->getOpCodeValue() == SHLD4RegRegCL || instr->getOpCodeValue() == SHRD4RegRegCL)
       trfprintf(pOutFile, "cl");
    else
       print(pOutFile, instr->getSourceRightRegister(), sourceSize);
@@ -3584,6 +3587,32 @@ static const char * opCodeToNameMap[IA32NumOpCodes] =
    "ANDNPDRegReg",
    "PSLLQRegImm1",
    "PSRLQRegImm1",
+   "SUBPSRegReg",
+   "SUBPDRegReg",
+   "DIVPSRegReg",
+   "DIVPDRegReg",
+   "PADDQRegReg",
+   "PSUBDRegReg",
+   "PSUBQRegReg",
+   "PANDRegReg",
+   "PORRegReg",
+   "PXORRegReg",
+   "VADDPSRegRegReg",
+   "VADDPDRegRegReg",
+   "VSUBPSRegRegReg",
+   "VSUBPDRegRegReg",
+   "VMULPSRegRegReg",
+   "VMULPDRegRegReg",
+   "VDIVPSRegRegReg",
+   "VDIVPDRegRegReg",
+   "VPADDDRegRegReg",
+   "VPADDQRegRegReg",
+   "VPSUBDRegRegReg",
+   "VPSUBQRegRegReg",
+   "VPMULLDRegRegReg",
+   "VPANDRegRegReg",
+   "VPORRegRegReg",
+   "VPXORRegRegReg",
    "FENCE",
    "VGFENCE",
    "PROCENTRY",
@@ -4467,6 +4496,32 @@ static const char * opCodeToMnemonicMap[IA32NumOpCodes] =
    "andnpd",         // ANDNPDRegReg
    "psllq",          // PSLLQRegImm1
    "psrlq",          // PSRLQRegImm1
+   "subps",          // SUBPSRegReg
+   "subpd",          // SUBPDRegReg
+   "divps",          // DIVPSRegReg
+   "divpd",          // DIVPDRegReg
+   "paddq",          // PADDQRegReg
+   "psubd",          // PSUBDRegReg
+   "psubq",          // PSUBQRegReg
+   "pand",           // PANDRegReg
+   "por",            // PORRegReg
+   "pxor",           // PXORRegReg
+   "vaddps",         // VADDPSRegRegReg
+   "vaddpd",         // VADDPDRegRegReg
+   "vsubps",         // VSUBPSRegRegReg
+   "vsubpd",         // VSUBPDRegRegReg
+   "vmulps",         // VMULPSRegRegReg
+   "vmulpd",         // VMULPDRegRegReg
+   "vdivps",         // VDIVPSRegRegReg
+   "vdivpd",         // VDIVPDRegRegReg
+   "vpaddd",         // VPADDDRegRegReg
+   "vpaddq",         // VPADDQRegRegReg
+   "vpsubd",         // VPSUBDRegRegReg
+   "vpsubq",         // VPSUBQRegRegReg
+   "vpmulld",        // VPMULLDRegRegReg
+   "vpand",          // VPANDRegRegReg
+   "vpor",           // VPORRegRegReg
+   "vpxor",          // VPXORRegRegReg
    "Fence",          // FENCE
    "VGFence",        // VGFENCE
    "ProcEntry",      // PROCENTRY
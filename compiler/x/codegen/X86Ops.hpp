@@ -881,6 +881,32 @@ typedef enum {
    ANDNPDRegReg,    // And not Packed Double-FP Register, Register
    PSLLQRegImm1,    // Shift left XMM register by number of bits
    PSRLQRegImm1,    // Shift right XMM register by number of bits
+   SUBPSRegReg,     // Subtract Packed Single-FP Register, Register
+   SUBPDRegReg,     // Subtract Packed Double-FP Register, Register
+   DIVPSRegReg,     // Divide Packed Single-FP Register, Register
+   DIVPDRegReg,     // Divide Packed Double-FP Register, Register
+   PADDQRegReg,     // Add Packed Quadwords Register, Register
+   PSUBDRegReg,     // Subtract Packed Doublewords Register, Register
+   PSUBQRegReg,     // Subtract Packed Quadwords Register, Register
+   PANDRegReg,      // And Packed Integers Register, Register
+   PORRegReg,       // Or Packed Integers Register, Register
+   PXORRegReg,      // Exclusive Or Packed Integers Register, Register
+   VADDPSRegRegReg, // Add Packed Single-FP Register, Register, Register (VEX)
+   VADDPDRegRegReg, // Add Packed Double-FP Register, Register, Register (VEX)
+   VSUBPSRegRegReg, // Subtract Packed Single-FP Register, Register, Register (VEX)
+   VSUBPDRegRegReg, // Subtract Packed Double-FP Register, Register, Register (VEX)
+   VMULPSRegRegReg, // Multiply Packed Single-FP Register, Register, Register (VEX)
+   VMULPDRegRegReg, // Multiply Packed Double-FP Register, Register, Register (VEX)
+   VDIVPSRegRegReg, // Divide Packed Single-FP Register, Register, Register (VEX)
+   VDIVPDRegRegReg, // Divide Packed Double-FP Register, Register, Register (VEX)
+   VPADDDRegRegReg, // Add Packed Doublewords Register, Register, Register (VEX)
+   VPADDQRegRegReg, // Add Packed Quadwords Register, Register, Register (VEX)
+   VPSUBDRegRegReg, // Subtract Packed Doublewords Register, Register, Register (VEX)
+   VPSUBQRegRegReg, // Subtract Packed Quadwords Register, Register, Register (VEX)
+   VPMULLDRegRegReg,// Multiply Packed Doublewords Register, Register, Register (VEX)
+   VPANDRegRegReg,  // And Packed Integers Register, Register, Register (VEX)
+   VPORRegRegReg,   // Or Packed Integers Register, Register, Register (VEX)
+   VPXORRegRegReg,  // Exclusive Or Packed Integers Register, Register, Register (VEX)
    FENCE,           // Address of binary is to be written to specified data address
                     // SymbolReference controls code motion across fence
    VGFENCE,         // Special Fence used for patching virtual guards
@@ -913,6 +939,8 @@ typedef enum {
 #define IA32RepPrefix                         0xf3
 #define IA32XacquirePrefix                    0xf2
 #define IA32XreleasePrefix                    0xf3
+#define IA32VEX2BytePrefix                    0xc5
+#define IA32VEX3BytePrefix                    0xc4
 const uint8_t SSE42OpcodePrefix[] = { 0x66, 0x0f };
 
 // Size-parameterized opcodes
@@ -1164,6 +1192,7 @@ extern TR_X86OpCodes XORRegImm4();
 #define IA32OpProp2_NeedsSSE42OpcodePrefix    0x00200000
 #define IA32OpProp2_NeedsXacquirePrefix       0x00400000
 #define IA32OpProp2_NeedsXreleasePrefix       0x00800000
+#define IA32OpProp2_NeedsVEXPrefix            0x01000000
 ////////////////////
 //
 // AMD64 flags
@@ -1325,6 +1354,8 @@ class TR_X86OpCode
 
    uint32_t needsSSE42OpcodePrefix() {return _properties2[_opCode] & IA32OpProp2_NeedsSSE42OpcodePrefix;}
 
+   uint32_t needsVEXPrefix() {return _properties2[_opCode] & IA32OpProp2_NeedsVEXPrefix;}
+
    uint32_t clearsUpperBits() {return hasIntTarget() && modifiesTarget();}
 
    uint32_t setsUpperBits() {return hasLongTarget() && modifiesTarget();}
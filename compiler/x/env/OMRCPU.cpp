@@ -64,6 +64,8 @@ OMR::X86::CPU::queryX86TargetCPUID(TR::Compilation *comp)
             buf->_processorSignature = 0;
             buf->_brandIdEtc = 0;
             buf->_featureFlags = 0x00000000;
+            buf->_featureFlags2 = 0x00000000;
+            buf->_featureFlags8 = 0x00000000;
             buf->_cacheDescription.l1instr = 0;
             buf->_cacheDescription.l1data  = 0;
             buf->_cacheDescription.l2      = 0;
@@ -108,6 +110,12 @@ OMR::X86::CPU::getX86ProcessorFeatureFlags2(TR::Compilation *comp)
    return self()->queryX86TargetCPUID(comp)->_featureFlags2;
    }
 
+uint32_t
+OMR::X86::CPU::getX86ProcessorFeatureFlags8(TR::Compilation *comp)
+   {
+   return self()->queryX86TargetCPUID(comp)->_featureFlags8;
+   }
+
 bool
 OMR::X86::CPU::testOSForSSESupport(TR::Compilation *comp)
    {
@@ -254,6 +254,13 @@ class OMR_EXTENSIBLE RealRegister : public OMR::X86::RealRegister
       *SIBByte |= _fullRegisterBinaryEncodings[_registerNumber].id << 3; // index register field is in bits 3-5 SIB byte
       }
 
+   void setVEXRegisterField(uint8_t *VEXByte)
+      {
+      TR_RegisterBinaryEncoding be = _fullRegisterBinaryEncodings[_registerNumber];
+      uint8_t number = be.id | (be.needsRexPlusRXB << 3);
+      *VEXByte |= (~number & 0xf) << 3; // inverted vvvv field is in bits 3-6 of the last VEX prefix byte
+      }
+
    uint8_t rexBits(uint8_t rxbBits, bool isByteOperand) { return 0; }
 
    // (AMD64: see x86-64 Architecture Programmer's Manual, Volume 3, section 1.7.2.
@@ -423,7 +423,7 @@
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vnot
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vselect
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vperm
-   TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vsplats
+   TR::TreeEvaluator::vsplatsEvaluator,                    // TR::vsplats
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vdmergel
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vdmergeh
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vdsetelem
@@ -460,14 +460,14 @@
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vdec
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vneg
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vcom
-   TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vadd
-   TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vsub
-   TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vmul
-   TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vdiv
+   TR::TreeEvaluator::vaddEvaluator,                       // TR::vadd
+   TR::TreeEvaluator::vsubEvaluator,                       // TR::vsub
+   TR::TreeEvaluator::vmulEvaluator,                       // TR::vmul
+   TR::TreeEvaluator::vdivEvaluator,                       // TR::vdiv
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vrem
-   TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vand
-   TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vor
-   TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vxor
+   TR::TreeEvaluator::vandEvaluator,                       // TR::vand
+   TR::TreeEvaluator::vorEvaluator,                        // TR::vor
+   TR::TreeEvaluator::vxorEvaluator,                       // TR::vxor
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vshl
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vushr
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vshr
@@ -481,10 +481,10 @@
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vucmple
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vcmpge
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vucmpge
-   TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vload
-   TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vloadi
-   TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vstore
-   TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vstorei
+   TR::TreeEvaluator::vloadEvaluator,                      // TR::vload
+   TR::TreeEvaluator::vloadEvaluator,                      // TR::vloadi
+   TR::TreeEvaluator::vstoreEvaluator,                     // TR::vstore
+   TR::TreeEvaluator::vstoreEvaluator,                     // TR::vstorei
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vrand
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vreturn
    TR::TreeEvaluator::unImpOpEvaluator,                    // TR::vcall
@@ -46,6 +46,7 @@
 #include "Scavenger.hpp"
 #include "SlotObject.hpp"
 #include "SublistFragment.hpp"
+#include "Task.hpp"
 
 /* This enum extends ConcurrentStatus with values > CONCURRENT_ROOT_TRACING. Values from this
  * and from ConcurrentStatus are treated as uintptr_t values everywhere except when used as
@@ -61,6 +62,82 @@ enum {
 	CONCURRENT_ROOT_TRACING1 = ((uintptr_t)((uintptr_t)CONCURRENT_ROOT_TRACING + 1))
 };
 
+/* Number of threads of the thread list a GC thread claims at once when scanning roots */
+#define ROOT_RANGE_THREADS_PER_SLICE 8
+
+static void
+markRootTable(MM_EnvironmentBase *env, void *userData, uintptr_t startIndex, uintptr_t endIndex)
+{
+	MM_MarkingScheme *markingScheme = (MM_MarkingScheme *)userData;
+	OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+	J9HashTableState state;
+	RootEntry *rEntry = NULL;
+	rEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
+	while (rEntry != NULL) {
+		markingScheme->markObject(env, rEntry->rootPtr);
+		rEntry = (RootEntry *)hashTableNextDo(&state);
+	}
+}
+
+static void
+markThreads(MM_EnvironmentBase *env, void *userData, uintptr_t startIndex, uintptr_t endIndex)
+{
+	MM_MarkingScheme *markingScheme = (MM_MarkingScheme *)userData;
+	OMR_VMThread *walkThread;
+	uintptr_t threadIndex = 0;
+	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+	while(((walkThread = threadListIterator.nextOMRVMThread()) != NULL) && (threadIndex < endIndex)) {
+		if (threadIndex >= startIndex) {
+			if (NULL != walkThread->_savedObject1) {
+				markingScheme->markObject(env, (omrobjectptr_t)walkThread->_savedObject1);
+			}
+			if (NULL != walkThread->_savedObject2) {
+				markingScheme->markObject(env, (omrobjectptr_t)walkThread->_savedObject2);
+			}
+		}
+		threadIndex += 1;
+	}
+}
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+static void
+scavengeRootTable(MM_EnvironmentBase *env, void *userData, uintptr_t startIndex, uintptr_t endIndex)
+{
+	MM_Scavenger *scavenger = (MM_Scavenger *)userData;
+	MM_EnvironmentStandard *envStd = MM_EnvironmentStandard::getEnvironment(env);
+	OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+	J9HashTableState state;
+	RootEntry *rootEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
+	while (NULL != rootEntry) {
+		if (NULL != rootEntry->rootPtr) {
+			scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t *) &rootEntry->rootPtr);
+		}
+		rootEntry = (RootEntry *)hashTableNextDo(&state);
+	}
+}
+
+static void
+scavengeThreads(MM_EnvironmentBase *env, void *userData, uintptr_t startIndex, uintptr_t endIndex)
+{
+	MM_Scavenger *scavenger = (MM_Scavenger *)userData;
+	MM_EnvironmentStandard *envStd = MM_EnvironmentStandard::getEnvironment(env);
+	OMR_VMThread *walkThread;
+	uintptr_t threadIndex = 0;
+	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+	while(((walkThread = threadListIterator.nextOMRVMThread()) != NULL) && (threadIndex < endIndex)) {
+		if (threadIndex >= startIndex) {
+			if (NULL != walkThread->_savedObject1) {
+				scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t *) &walkThread->_savedObject1);
+			}
+			if (NULL != walkThread->_savedObject2) {
+				scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t *) &walkThread->_savedObject2);
+			}
+		}
+		threadIndex += 1;
+	}
+}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 /**
  * Initialization
  */
@@ -107,8 +184,11 @@ void
 MM_CollectorLanguageInterfaceImpl::flushNonAllocationCaches(MM_EnvironmentBase *env)
 {
 #if defined(OMR_GC_MODRON_SCAVENGER)
-	MM_EnvironmentStandard *envStd = MM_EnvironmentStandard::getEnvironment(env);
-	MM_SublistFragment::flush((J9VMGC_SublistFragment*)&envStd->_scavengerRememberedSet);
+	/* the environments of a segregated heap are not MM_EnvironmentStandard */
+	if (!env->getExtensions()->isSegregatedHeap()) {
+		MM_EnvironmentStandard *envStd = MM_EnvironmentStandard::getEnvironment(env);
+		MM_SublistFragment::flush((J9VMGC_SublistFragment*)&envStd->_scavengerRememberedSet);
+	}
 #endif /* defined(OMR_GC_MODRON_STANDARD) */
 }
 
@@ -133,32 +213,35 @@ MM_CollectorLanguageInterfaceImpl::detachVMThread(OMR_VM *omrVM, OMR_VMThread *o
 	}
 }
 
+void
+MM_CollectorLanguageInterfaceImpl::registerRootRanges(MM_EnvironmentBase *env, MM_RootRangeSet *rootRanges, MM_RootRangeScanFunction rootTableScanFunction, MM_RootRangeScanFunction threadsScanFunction, void *userData)
+{
+	OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+	rootRanges->clear();
+
+	/* The root table can only be walked from the start, so it is scanned by a single thread */
+	if (NULL != omrVM->rootTable) {
+		rootRanges->addRange(RootScannerEntity_GlobalReferences, rootTableScanFunction, userData, 1, 1);
+	}
+
+	uintptr_t threadCount = 0;
+	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+	while (NULL != threadListIterator.nextOMRVMThread()) {
+		threadCount += 1;
+	}
+	rootRanges->addRange(RootScannerEntity_Threads, threadsScanFunction, userData, threadCount, ROOT_RANGE_THREADS_PER_SLICE);
+}
+
 void
 MM_CollectorLanguageInterfaceImpl::markingScheme_masterSetupForGC(MM_EnvironmentBase *env)
 {
+	registerRootRanges(env, &_markingRootRanges, markRootTable, markThreads, _markingScheme);
 }
 
 void
 MM_CollectorLanguageInterfaceImpl::markingScheme_scanRoots(MM_EnvironmentBase *env)
 {
-	OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
-	J9HashTableState state;
-	RootEntry *rEntry = NULL;
-	rEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
-	while (rEntry != NULL) {
-		_markingScheme->markObject(env, rEntry->rootPtr);
-		rEntry = (RootEntry *)hashTableNextDo(&state);
-	}
-	OMR_VMThread *walkThread;
-	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
-	while((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
-		if (NULL != walkThread->_savedObject1) {
-			_markingScheme->markObject(env, (omrobjectptr_t)walkThread->_savedObject1);
-		}
-		if (NULL != walkThread->_savedObject2) {
-			_markingScheme->markObject(env, (omrobjectptr_t)walkThread->_savedObject2);
-		}
-	}
+	_markingRootRanges.scan(env);
 }
 
 void
@@ -174,6 +257,7 @@ MM_CollectorLanguageInterfaceImpl::markingScheme_markLiveObjectsComplete(MM_Envi
 void
 MM_CollectorLanguageInterfaceImpl::markingScheme_masterSetupForWalk(MM_EnvironmentBase *env)
 {
+	registerRootRanges(env, &_markingRootRanges, markRootTable, markThreads, _markingScheme);
 }
 
 void
@@ -194,6 +278,11 @@ MM_CollectorLanguageInterfaceImpl::markingScheme_masterCleanupAfterGC(MM_Environ
 uintptr_t
 MM_CollectorLanguageInterfaceImpl::markingScheme_scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, MarkingSchemeScanReason reason)
 {
+#if defined(OMR_GC_MODRON_COMPACTION)
+	if (_markingScheme->isPartialCompactArmed()) {
+		return markingScheme_scanObjectForPartialCompact(env, objectPtr, reason);
+	}
+#endif /* OMR_GC_MODRON_COMPACTION */
 	GC_ObjectIterator objectIterator(_omrVM, objectPtr);
 	GC_SlotObject *slotObject = NULL;
 	while (NULL != (slotObject = objectIterator.nextSlot())) {
@@ -205,6 +294,31 @@ MM_CollectorLanguageInterfaceImpl::markingScheme_scanObject(MM_EnvironmentBase *
 	return env->getExtensions()->objectModel.getSizeInBytesWithHeader(objectPtr);
 }
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+uintptr_t
+MM_CollectorLanguageInterfaceImpl::markingScheme_scanObjectForPartialCompact(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, MarkingSchemeScanReason reason)
+{
+	GC_ObjectIterator objectIterator(_omrVM, objectPtr);
+	GC_SlotObject *slotObject = NULL;
+	bool refersToPartialCompactArea = false;
+	while (NULL != (slotObject = objectIterator.nextSlot())) {
+		omrobjectptr_t slot = slotObject->readReferenceFromSlot();
+		if (_markingScheme->isHeapObject(slot)) {
+			_markingScheme->markObject(env, slot);
+			refersToPartialCompactArea = refersToPartialCompactArea || _markingScheme->isPartialCompactAreaObject(slot);
+		}
+	}
+	/* Every marked object is scanned exactly once for one of these two reasons in a stop-the-world mark */
+	if (refersToPartialCompactArea
+		&& ((SCAN_REASON_PACKET == reason) || (SCAN_REASON_OVERFLOWED_OBJECT == reason))
+		&& !_markingScheme->isPartialCompactAreaObject(objectPtr)
+	) {
+		_markingScheme->rememberObjectForPartialCompact(env, objectPtr);
+	}
+	return env->getExtensions()->objectModel.getSizeInBytesWithHeader(objectPtr);
+}
+#endif /* OMR_GC_MODRON_COMPACTION */
+
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 uintptr_t
 MM_CollectorLanguageInterfaceImpl::markingScheme_scanObjectWithSize(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, MarkingSchemeScanReason reason, uintptr_t sizeToDo)
@@ -229,7 +343,7 @@ MM_CollectorLanguageInterfaceImpl::scavenger_reportObjectEvents(MM_EnvironmentBa
 void
 MM_CollectorLanguageInterfaceImpl::scavenger_masterSetupForGC(MM_EnvironmentBase *env)
 {
-	/* Do nothing for now */
+	registerRootRanges(env, &_scavengerRootRanges, scavengeRootTable, scavengeThreads, _extensions->scavenger);
 }
 
 void
@@ -391,25 +505,53 @@ MM_CollectorLanguageInterfaceImpl::scavenger_fixupDestroyedSlot(MM_EnvironmentBa
 void
 MM_CollectorLanguageInterfaceImpl::compactScheme_verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap)
 {
-	Assert_MM_unimplemented();
 }
 
 void
 MM_CollectorLanguageInterfaceImpl::compactScheme_fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme)
 {
-	Assert_MM_unimplemented();
+	/* the example has few roots, so a single thread fixes them all */
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
+		OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+		J9HashTableState state;
+
+		RootEntry *rootEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
+		while (NULL != rootEntry) {
+			if (NULL != rootEntry->rootPtr) {
+				rootEntry->rootPtr = compactScheme->getForwardingPtr(rootEntry->rootPtr);
+			}
+			rootEntry = (RootEntry *)hashTableNextDo(&state);
+		}
+
+		OMR_VMThread *walkThread = NULL;
+		GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+		while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+			if (NULL != walkThread->_savedObject1) {
+				walkThread->_savedObject1 = compactScheme->getForwardingPtr((omrobjectptr_t)walkThread->_savedObject1);
+			}
+			if (NULL != walkThread->_savedObject2) {
+				walkThread->_savedObject2 = compactScheme->getForwardingPtr((omrobjectptr_t)walkThread->_savedObject2);
+			}
+		}
+
+		/* dead objects were removed from the object table when marking completed */
+		ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
+		while (NULL != objectEntry) {
+			objectEntry->objPtr = compactScheme->getForwardingPtr(objectEntry->objPtr);
+			objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+		}
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
 }
 
 void
 MM_CollectorLanguageInterfaceImpl::compactScheme_workerCleanupAfterGC(MM_EnvironmentBase *env)
 {
-	Assert_MM_unimplemented();
 }
 
 void
 MM_CollectorLanguageInterfaceImpl::compactScheme_languageMasterSetupForGC(MM_EnvironmentBase *env)
 {
-	Assert_MM_unimplemented();
 }
 #endif /* OMR_GC_MODRON_COMPACTION */
 
@@ -448,6 +590,8 @@ MM_CollectorLanguageInterfaceImpl::concurrentGC_collectRoots(MM_EnvironmentStand
 
 	switch (concurrentStatus) {
 	case CONCURRENT_ROOT_TRACING1:
+		/* roots are traced by this thread alone, outside of any task */
+		registerRootRanges(env, &_markingRootRanges, markRootTable, markThreads, _markingScheme);
 		markingScheme_scanRoots(env);
 		break;
 	default:
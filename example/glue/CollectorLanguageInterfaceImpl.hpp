@@ -25,6 +25,7 @@
 #include "CollectorLanguageInterface.hpp"
 #include "GCExtensionsBase.hpp"
 #include "ParallelSweepScheme.hpp"
+#include "RootRangeSet.hpp"
 #include "WorkPackets.hpp"
 
 class GC_ObjectScanner;
@@ -44,6 +45,10 @@ protected:
 	OMR_VM *_omrVM;
 	MM_GCExtensionsBase *_extensions;
 	MM_MarkingScheme *_markingScheme;
+	MM_RootRangeSet _markingRootRanges; /**< roots marked by all the threads of a mark task */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	MM_RootRangeSet _scavengerRootRanges; /**< roots copied by all the threads of a scavenge task */
+#endif /* OMR_GC_MODRON_SCAVENGER */
 public:
 	enum AttachVMThreadReason {
 		ATTACH_THREAD = 0x0,
@@ -57,10 +62,34 @@ protected:
 	bool initialize(OMR_VM *omrVM);
 	void tearDown(OMR_VM *omrVM);
 
+	/**
+	 * Register the roots of the example VM (the root table and the thread list) as ranges to be scanned
+	 * by all the threads of the next task.
+	 * @param[in] rootRanges the range set to register the roots in
+	 * @param[in] rootTableScanFunction scans the root table
+	 * @param[in] threadsScanFunction scans a range of threads of the thread list
+	 * @param[in] userData passed to the scan functions
+	 */
+	void registerRootRanges(MM_EnvironmentBase *env, MM_RootRangeSet *rootRanges, MM_RootRangeScanFunction rootTableScanFunction, MM_RootRangeScanFunction threadsScanFunction, void *userData);
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/**
+	 * Scan an object while a partial compaction is armed, remembering it if it refers into one of the
+	 * areas to be evacuated. Kept apart from markingScheme_scanObject() so that marking does not test
+	 * every slot when no partial compaction is planned.
+	 */
+	uintptr_t markingScheme_scanObjectForPartialCompact(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, MarkingSchemeScanReason reason);
+#endif /* OMR_GC_MODRON_COMPACTION */
+
 	MM_CollectorLanguageInterfaceImpl(OMR_VM *omrVM)
 		: MM_CollectorLanguageInterface()
 		,_omrVM(omrVM)
 		,_extensions(MM_GCExtensionsBase::getExtensions(omrVM))
+		,_markingScheme(NULL)
+		,_markingRootRanges()
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		,_scavengerRootRanges()
+#endif /* OMR_GC_MODRON_SCAVENGER */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -148,6 +177,10 @@ public:
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	virtual void scavenger_reportObjectEvents(MM_EnvironmentBase *env);
 	virtual void scavenger_masterSetupForGC(MM_EnvironmentBase *env);
+	/**
+	 * Copy the roots registered by scavenger_masterSetupForGC().  Called by all the threads of the scavenge task.
+	 */
+	void scavenger_scanRoots(MM_EnvironmentBase *env) { _scavengerRootRanges.scan(env); }
 	virtual void scavenger_workerSetupForGC_clearEnvironmentLangStats(MM_EnvironmentBase *env);
 	virtual void scavenger_reportScavengeEnd(MM_EnvironmentBase * envBase, bool scavengeSuccessful);
 	virtual void scavenger_mergeGCStats_mergeLangStats(MM_EnvironmentBase *envBase);
@@ -171,6 +204,7 @@ public:
 	virtual void compactScheme_fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme);
 	virtual void compactScheme_workerCleanupAfterGC(MM_EnvironmentBase *env);
 	virtual void compactScheme_verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap);
+	virtual bool compactScheme_supportsPartialCompaction() { return true; }
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	virtual omrobjectptr_t heapWalker_heapWalkerObjectSlotDo(omrobjectptr_t object);
@@ -104,6 +104,16 @@ MM_ConfigurationLanguageInterfaceImpl::initializeArrayletLeafSize(MM_Environment
 	return true;
 }
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+bool
+MM_ConfigurationLanguageInterfaceImpl::initializeSizeClasses(MM_EnvironmentBase* env)
+{
+	/* the cell sizes are copied in when the segregated configuration initializes MM_SizeClasses */
+	env->getOmrVM()->_sizeClasses = &_sizeClasses;
+	return true;
+}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+
 void
 MM_ConfigurationLanguageInterfaceImpl::initializeWriteBarrierType(MM_EnvironmentBase* env, uintptr_t configWriteBarrierType)
 {
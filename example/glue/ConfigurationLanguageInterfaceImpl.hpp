@@ -20,6 +20,7 @@
 #define CONFIGURATIONLANGUAGEINTERFACEIMPL_HPP_
 
 #include "omr.h"
+#include "sizeclasses.h"
 
 #include "ConfigurationLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
@@ -31,6 +32,9 @@
  */
 class MM_ConfigurationLanguageInterfaceImpl : public MM_ConfigurationLanguageInterface {
 private:
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	OMR_SizeClasses _sizeClasses; /**< Size classes of the segregated heap, filled in by MM_SizeClasses */
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 protected:
 	bool initialize(MM_EnvironmentBase *env);
 	void tearDown(MM_EnvironmentBase *env);
@@ -52,6 +56,9 @@ public:
 	virtual MM_EnvironmentLanguageInterface *createEnvironmentLanguageInterface(MM_EnvironmentBase *env);
 
 	virtual bool initializeArrayletLeafSize(MM_EnvironmentBase* env);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	virtual bool initializeSizeClasses(MM_EnvironmentBase* env);
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 	virtual void initializeWriteBarrierType(MM_EnvironmentBase* env, uintptr_t configWriteBarrierType);
 	virtual void initializeAllocationType(MM_EnvironmentBase* env, uintptr_t configGcAllocationType);
 
@@ -25,6 +25,7 @@
 #include "omrhashtable.h"
 
 #include "Base.hpp"
+#include "CollectorLanguageInterfaceImpl.hpp"
 #include "EnvironmentStandard.hpp"
 #include "ForwardedHeader.hpp"
 #include "Scavenger.hpp"
@@ -71,31 +72,9 @@ public:
 	void
 	scanRoots(MM_EnvironmentBase *env)
 	{
-		OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
-		if (env->_currentTask->synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
-			J9HashTableState state;
-			MM_EnvironmentStandard *envStd = MM_EnvironmentStandard::getEnvironment(env);
-			if (NULL != omrVM->rootTable) {
-				RootEntry *rootEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
-				while (NULL != rootEntry) {
-					if (NULL != rootEntry->rootPtr) {
-						_scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t *) &rootEntry->rootPtr);
-					}
-					rootEntry = (RootEntry *)hashTableNextDo(&state);
-				}
-			}
-			OMR_VMThread *walkThread;
-			GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
-			while((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
-				if (NULL != walkThread->_savedObject1) {
-					_scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t *) &walkThread->_savedObject1);
-				}
-				if (NULL != walkThread->_savedObject2) {
-					_scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t *) &walkThread->_savedObject2);
-				}
-			}
-			env->_currentTask->releaseSynchronizedGCThreads(env);
-		}
+		/* roots were registered by the collector language interface in scavenger_masterSetupForGC() */
+		MM_CollectorLanguageInterfaceImpl *cli = (MM_CollectorLanguageInterfaceImpl *)env->getExtensions()->collectorLanguageInterface;
+		cli->scavenger_scanRoots(env);
 	}
 	
 #if !defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -120,8 +99,8 @@ public:
 					}
 					objectEntry = (ObjectEntry *)hashTableNextDo(&state);
 				}
+				env->_currentTask->releaseSynchronizedGCThreads(env);
 			}
-			env->_currentTask->releaseSynchronizedGCThreads(env);
 		}
 	}
 
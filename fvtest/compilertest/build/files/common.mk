@@ -48,6 +48,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/env/OMRDebugEnv.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/OMRVMEnv.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/SegmentProvider.cpp \
+    $(JIT_OMR_DIRTY_DIR)/env/SegmentPool.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/SystemSegmentProvider.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/Region.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/StackMemoryRegion.cpp \
@@ -89,6 +90,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/optimizer/ExpressionsSimplification.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/FieldPrivatizer.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/GeneralLoopUnroller.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/SPMDParallelizer.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/GlobalAnticipatability.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/GlobalRegisterAllocator.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/Inliner.cpp \
@@ -20,10 +20,13 @@
 #include "EnvironmentBase.hpp"
 #include "EnvironmentLanguageInterface.hpp"
 #include "GCConfigTest.hpp"
+#include "Heap.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
+#include "PauseTimeStats.hpp"
 #include "SlotObject.hpp"
+#include "VerboseBinaryConverter.hpp"
 #include "VerboseWriterChain.hpp"
 
 //#define OMRGCTEST_PRINTFILE
@@ -773,6 +776,44 @@ printFile(const char *name)
 }
 #endif
 
+pugi::xml_parse_result
+GCConfigTest::loadVerboseFile(pugi::xml_document *verboseDoc, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+	if (!extensions->binaryLogging) {
+		return verboseDoc->load_file(fileName);
+	}
+
+	/* convert the binary log to the XML it stands for */
+	pugi::xml_parse_result result;
+	result.status = pugi::status_file_not_found;
+	FILE *input = fopen(fileName, "rb");
+	if (NULL != input) {
+		result.status = pugi::status_io_error;
+		FILE *xml = tmpfile();
+		if (NULL != xml) {
+			const char *error = convertVerboseBinaryLog(input, xml);
+			long size = ftell(xml);
+			if (NULL != error) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to convert binary verbose log %s: %s.\n", __FILE__, __LINE__, fileName, error);
+			} else if (0 < size) {
+				char *buffer = (char *)omrmem_allocate_memory(size, OMRMEM_CATEGORY_MM);
+				if (NULL != buffer) {
+					rewind(xml);
+					if (1 == fread(buffer, size, 1, xml)) {
+						result = verboseDoc->load_buffer(buffer, size);
+					}
+					omrmem_free_memory(buffer);
+				}
+			}
+			fclose(xml);
+		}
+		fclose(input);
+	}
+	return result;
+}
+
 int32_t
 GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
@@ -794,7 +835,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 	do {
 		pugi::xml_document verboseDoc;
 		if (0 == numOfFiles) {
-			verboseDoc.load_file(verboseFile);
+			loadVerboseFile(&verboseDoc, verboseFile);
 			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
 			printFile(verboseFile);
@@ -802,7 +843,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		} else {
 			char currentVerboseFile[MAX_NAME_LENGTH];
 			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
-			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+			pugi::xml_parse_result result = loadVerboseFile(&verboseDoc, currentVerboseFile);
 			if (pugi::status_file_not_found == result.status) {
 				break;
 			}
@@ -870,6 +911,41 @@ done:
 	return rt;
 }
 
+int32_t
+GCConfigTest::verifyPauseTimes(pugi::xpath_node_set pauseTimes)
+{
+	int32_t rt = 0;
+	for (pugi::xpath_node_set::const_iterator it = pauseTimes.begin(); it != pauseTimes.end(); ++it) {
+		const char *typeStr = it->node().attribute("type").value();
+		uint64_t minimumCount = (uint64_t)it->node().attribute("minimumCount").as_uint();
+		uintptr_t pauseType = 0;
+		for (; pauseType < OMR_GC_PAUSE_TYPE_COUNT; pauseType++) {
+			if (0 == strcmp(typeStr, MM_PauseTimeStats::getPauseTypeName(pauseType))) {
+				break;
+			}
+		}
+
+		OMR_GC_PauseTimeStats stats;
+		if (OMR_ERROR_NONE != OMR_GC_GetPauseTimeStats(exampleVM->_omrVMThread, pauseType, &stats)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid pause type \"%s\" specified in configuration file.\n", __FILE__, __LINE__, typeStr);
+			break;
+		}
+
+		gcTestEnv->log("Verifying %s pauses: count=%llu p50=%lluus p90=%lluus p99=%lluus p99.9=%lluus max=%lluus\n",
+			typeStr, stats.count, stats.p50Micros, stats.p90Micros, stats.p99Micros, stats.p999Micros, stats.maximumMicros);
+		bool ordered = (stats.p50Micros <= stats.p90Micros) && (stats.p90Micros <= stats.p99Micros)
+			&& (stats.p99Micros <= stats.p999Micros) && (stats.p999Micros <= stats.maximumMicros) && (stats.maximumMicros <= stats.totalMicros);
+		if ((stats.count < minimumCount) || !ordered) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "\t*FAILED* expected at least %llu pauses with ordered percentiles\n", minimumCount);
+		} else {
+			gcTestEnv->log("*PASSED*\n");
+		}
+	}
+	return rt;
+}
+
 int32_t
 GCConfigTest::parseGarbagePolicy(pugi::xml_node node)
 {
@@ -921,6 +997,8 @@ int32_t
 GCConfigTest::triggerOperation(pugi::xml_node node)
 {
 	int32_t rt = 0;
+	/* collections never change what is reachable, so every traversal of an operation must agree */
+	uintptr_t traversedObjectCount = 0;
 	for (; node; node = node.next_sibling()) {
 		if (0 == strcmp(node.name(), "systemCollect")) {
 			const char *gcCodeStr = node.attribute("gcCode").value();
@@ -929,20 +1007,188 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 				gcCodeStr = "0";
 			}
 			uint32_t gcCode = (uint32_t)atoi(gcCodeStr);
+#if defined(OMR_GC_MODRON_COMPACTION)
+			/* compact="true" forces this collection, and only this one, to compact */
+			MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+			uintptr_t noCompactOnGlobalGC = extensions->noCompactOnGlobalGC;
+			uintptr_t compactOnGlobalGC = extensions->compactOnGlobalGC;
+			if (node.attribute("compact").as_bool()) {
+				extensions->noCompactOnGlobalGC = 0;
+				extensions->compactOnGlobalGC = 1;
+			}
+#endif /* OMR_GC_MODRON_COMPACTION */
 			gcTestEnv->log("Invoking gc system collect with gcCode %d...\n", gcCode);
 			rt = (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, gcCode);
+#if defined(OMR_GC_MODRON_COMPACTION)
+			extensions->noCompactOnGlobalGC = noCompactOnGlobalGC;
+			extensions->compactOnGlobalGC = compactOnGlobalGC;
+#endif /* OMR_GC_MODRON_COMPACTION */
 			if (OMR_ERROR_NONE != rt) {
 				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_SystemCollect with error code %d.\n", __FILE__, __LINE__, rt);
 				goto done;
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		} else if (0 == strcmp(node.name(), "scavenge")) {
+			/* allocate objects nothing refers to until the nursery fills up and is scavenged */
+			MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+			if (NULL == extensions->scavenger) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d The scavenge operation requires the gencon GC policy.\n", __FILE__, __LINE__);
+				rt = 1;
+				goto done;
+			}
+			OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+			char namePrefix[MAX_NAME_LENGTH];
+			omrstr_printf(namePrefix, sizeof(namePrefix), "SCAVENGE_%d", gp.garbageSeq++);
+			gcTestEnv->log("Allocating %s objects until a scavenge...\n", namePrefix);
+			uintptr_t scavengeCount = extensions->scavengerStats._gcCount;
+			for (int32_t i = 0; scavengeCount == extensions->scavengerStats._gcCount; i++) {
+				if (NULL == createObject(namePrefix, GARBAGE_ROOT, 0, i, 1024)) {
+					rt = 1;
+					goto done;
+				}
+			}
+			verboseManager->getWriterChain()->endOfCycle(env);
+#endif /* OMR_GC_MODRON_SCAVENGER */
+		} else if (0 == strcmp(node.name(), "traverse")) {
+			/* time a walk of every object reachable from the roots, to measure the locality the collector left behind */
+			OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+			int32_t repeat = node.attribute("repeat").as_int();
+			if (repeat <= 0) {
+				repeat = 1;
+			}
+			uintptr_t objectCount = 0;
+			uint64_t startTime = omrtime_hires_clock();
+			for (int32_t i = 0; i < repeat; i++) {
+				rt = traverseRoots(&objectCount, false);
+				OMRGCTEST_CHECK_RT(rt);
+			}
+			uint64_t elapsedMicros = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			gcTestEnv->log("Traversed %zu objects %d times in %llu us.\n", objectCount, repeat, elapsedMicros);
+			/* check the objects reached against the object table once, outside of the timed walks */
+			rt = traverseRoots(&objectCount, true);
+			OMRGCTEST_CHECK_RT(rt);
+			if ((0 != traversedObjectCount) && (traversedObjectCount != objectCount)) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Traversed %zu objects, but %zu before the last collection.\n", __FILE__, __LINE__, objectCount, traversedObjectCount);
+				rt = 1;
+				goto done;
+			}
+			traversedObjectCount = objectCount;
 		}
 	}
 done:
 	return rt;
 }
 
+/* set in the address table of traverseRoots() once an object has been reached; objects are aligned, so it does not change the order */
+#define VISITED_OBJECT_TAG ((uintptr_t)1)
+
+static int
+compareObjectAddresses(const void *left, const void *right)
+{
+	uintptr_t leftAddress = (uintptr_t)*(const omrobjectptr_t *)left & ~VISITED_OBJECT_TAG;
+	uintptr_t rightAddress = (uintptr_t)*(const omrobjectptr_t *)right & ~VISITED_OBJECT_TAG;
+	return (leftAddress < rightAddress) ? -1 : ((leftAddress > rightAddress) ? 1 : 0);
+}
+
+int32_t
+GCConfigTest::traverseRoots(uintptr_t *objectCount, bool validate)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+	int32_t rt = 0;
+	uintptr_t stackSize = 1024;
+	uintptr_t stackTop = 0;
+	uintptr_t count = 0;
+	omrobjectptr_t *stack = (omrobjectptr_t *)omrmem_allocate_memory(stackSize * sizeof(omrobjectptr_t), OMRMEM_CATEGORY_MM);
+	if (NULL == stack) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate traversal stack.\n", __FILE__, __LINE__);
+		return 1;
+	}
+
+	/* when validating, every reachable object must be one the test allocated, at the address the collector last moved it to */
+	uintptr_t knownObjectCount = 0;
+	omrobjectptr_t *knownObjects = NULL;
+	omrobjectptr_t heapTop = (omrobjectptr_t)extensions->heap->getHeapTop();
+	J9HashTableState state;
+	if (validate) {
+		knownObjects = (omrobjectptr_t *)omrmem_allocate_memory((hashTableGetCount(exampleVM->objectTable) + 1) * sizeof(omrobjectptr_t), OMRMEM_CATEGORY_MM);
+		if (NULL == knownObjects) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate object address table.\n", __FILE__, __LINE__);
+			omrmem_free_memory(stack);
+			return 1;
+		}
+		ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(exampleVM->objectTable, &state);
+		while (NULL != objectEntry) {
+			knownObjects[knownObjectCount++] = objectEntry->objPtr;
+			objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+		}
+		qsort(knownObjects, knownObjectCount, sizeof(omrobjectptr_t), compareObjectAddresses);
+	}
+
+	RootEntry *rootEntry = (RootEntry *)hashTableStartDo(exampleVM->rootTable, &state);
+	while (NULL != rootEntry) {
+		if (NULL != rootEntry->rootPtr) {
+			stack[stackTop++] = rootEntry->rootPtr;
+		}
+		/* the objects created by the test form trees, so every object is reached exactly once */
+		while (0 < stackTop) {
+			omrobjectptr_t objPtr = stack[--stackTop];
+			uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(objPtr);
+			fomrobject_t *slot = (fomrobject_t *)objPtr + 1;
+			fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)objPtr + size);
+			if (validate) {
+				omrobjectptr_t *knownObject = (omrobjectptr_t *)bsearch(&objPtr, knownObjects, knownObjectCount, sizeof(omrobjectptr_t), compareObjectAddresses);
+				if (NULL == knownObject) {
+					gcTestEnv->log(LEVEL_ERROR, "%s:%d Reachable object %p is not an object allocated by the test.\n", __FILE__, __LINE__, objPtr);
+					rt = 1;
+					goto done;
+				}
+				if (0 != ((uintptr_t)*knownObject & VISITED_OBJECT_TAG)) {
+					gcTestEnv->log(LEVEL_ERROR, "%s:%d Reachable object %p is referred to twice.\n", __FILE__, __LINE__, objPtr);
+					rt = 1;
+					goto done;
+				}
+				*knownObject = (omrobjectptr_t)((uintptr_t)*knownObject | VISITED_OBJECT_TAG);
+				if ((0 == size) || ((omrobjectptr_t)endSlot > heapTop)) {
+					gcTestEnv->log(LEVEL_ERROR, "%s:%d Reachable object %p has an invalid size %zu.\n", __FILE__, __LINE__, objPtr, size);
+					rt = 1;
+					goto done;
+				}
+			}
+			count += 1;
+			for (; slot < endSlot; slot++) {
+				GC_SlotObject slotObject(exampleVM->_omrVM, slot);
+				omrobjectptr_t childPtr = slotObject.readReferenceFromSlot();
+				if (NULL != childPtr) {
+					if (stackTop == stackSize) {
+						omrobjectptr_t *newStack = (omrobjectptr_t *)omrmem_allocate_memory(2 * stackSize * sizeof(omrobjectptr_t), OMRMEM_CATEGORY_MM);
+						if (NULL == newStack) {
+							gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to grow traversal stack.\n", __FILE__, __LINE__);
+							rt = 1;
+							goto done;
+						}
+						memcpy(newStack, stack, stackSize * sizeof(omrobjectptr_t));
+						omrmem_free_memory(stack);
+						stack = newStack;
+						stackSize *= 2;
+					}
+					stack[stackTop++] = childPtr;
+				}
+			}
+		}
+		rootEntry = (RootEntry *)hashTableNextDo(&state);
+	}
+	*objectCount = count;
+done:
+	if (NULL != knownObjects) {
+		omrmem_free_memory(knownObjects);
+	}
+	omrmem_free_memory(stack);
+	return rt;
+}
+
 int32_t
 GCConfigTest::iniXMLStr(const char *configStyle)
 {
@@ -1003,6 +1249,8 @@ TEST_P(GCConfigTest, test)
 			gcTestEnv->log("Time elapsed in allocation: %lld ms\n", (omrtime_current_time_millis() - startTime));
 		} else if (0 == strcmp(configChild.name(), "verification")) {
 			gcTestEnv->log("\n++++++++++++++++++++++++++Verification++++++++++++++++++++++++++\n");
+			/* the verbose log may still be being written by a background thread */
+			verboseManager->flushStreams(env);
 			/* verboseGC verification */
 			char verboseNodeSet[MAX_NAME_LENGTH];
 			/* select verboseGC nodes with right spec info */
@@ -1010,6 +1258,9 @@ TEST_P(GCConfigTest, test)
 			pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
 			rt = verifyVerboseGC(verboseGCs);
 			ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
+			/* pause time histogram verification */
+			rt = verifyPauseTimes(configChild.select_nodes("pauseTime"));
+			ASSERT_EQ(0, rt) << "Failed in pause time verification.";
 			gcTestEnv->log("[ Verification Successful ]\n\n");
 		} else if (0 == strcmp(configChild.name(), "operation")) {
 			gcTestEnv->log("\n++++++++++++++++++++++++++++Operation+++++++++++++++++++++++++++\n");
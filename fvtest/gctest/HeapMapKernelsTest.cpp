@@ -0,0 +1,170 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrport.h"
+
+#include "Bits.hpp"
+#include "HeapMapKernels.hpp"
+
+#include "gcTestHelpers.hpp"
+
+/* a 32MB (64 bit) heap map covers a 2GB heap, large enough to be cleared with non-temporal stores */
+#define HEAPMAPKERNELS_TEST_WORDS ((uintptr_t)1 << 22)
+#define HEAPMAPKERNELS_TEST_REPEAT 4
+/* one mark bit in every 4KB of mark map, i.e. mostly empty words as in a sparse old space */
+#define HEAPMAPKERNELS_TEST_SPARSITY ((uintptr_t)512)
+
+class HeapMapKernelsTest : public ::testing::Test
+{
+protected:
+	uintptr_t *_words;
+	MM_HeapMapKernels::KernelLevel _savedLevel;
+
+	virtual void
+	SetUp()
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		_savedLevel = MM_HeapMapKernels::getLevel();
+		/* one extra word so that ranges can start misaligned */
+		_words = (uintptr_t *)omrmem_allocate_memory((HEAPMAPKERNELS_TEST_WORDS + 1) * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+		ASSERT_TRUE(NULL != _words);
+	}
+
+	virtual void
+	TearDown()
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		omrmem_free_memory(_words);
+		MM_HeapMapKernels::selectLevel(_savedLevel);
+	}
+
+	void
+	fillSparse(uintptr_t *base, uintptr_t count)
+	{
+		for (uintptr_t i = 0; i < count; i++) {
+			base[i] = (0 == ((i + 1) % HEAPMAPKERNELS_TEST_SPARSITY)) ? ((uintptr_t)1 << (i % J9BITS_BITS_IN_SLOT)) : 0;
+		}
+	}
+};
+
+/**
+ * Every supported vector kernel must answer exactly what the scalar kernel does, for any alignment and length.
+ */
+TEST_F(HeapMapKernelsTest, matchesScalar)
+{
+	const uintptr_t lengths[] = { 0, 1, 3, 7, 8, 15, 16, 17, 31, 33, 64, 100, 1000, 4099 };
+	const uintptr_t lengthCount = sizeof(lengths) / sizeof(lengths[0]);
+
+	for (intptr_t level = MM_HeapMapKernels::KERNELS_SSE2; level < MM_HeapMapKernels::KERNELS_COUNT; level++) {
+		if (!MM_HeapMapKernels::isLevelSupported((MM_HeapMapKernels::KernelLevel)level)) {
+			gcTestEnv->log("HeapMapKernelsTest: %s kernels not supported, skipped\n", MM_HeapMapKernels::getLevelName((MM_HeapMapKernels::KernelLevel)level));
+			continue;
+		}
+		for (uintptr_t offset = 0; offset < 4; offset++) {
+			for (uintptr_t i = 0; i < lengthCount; i++) {
+				uintptr_t *base = _words + offset;
+				uintptr_t *top = base + lengths[i];
+
+				/* single bit at every position, plus the all zero case */
+				for (uintptr_t bit = 0; bit <= lengths[i]; bit++) {
+					memset(_words, 0, (lengths[i] + offset + 1) * sizeof(uintptr_t));
+					if (bit < lengths[i]) {
+						base[bit] = (uintptr_t)1 << (bit % J9BITS_BITS_IN_SLOT);
+					}
+					ASSERT_TRUE(MM_HeapMapKernels::selectLevel((MM_HeapMapKernels::KernelLevel)level));
+					ASSERT_EQ(base + bit, MM_HeapMapKernels::findNonZeroWord(base, top));
+				}
+
+				fillSparse(base, lengths[i]);
+				ASSERT_TRUE(MM_HeapMapKernels::selectLevel(MM_HeapMapKernels::KERNELS_SCALAR));
+				uintptr_t expectedCount = MM_HeapMapKernels::populationCount(base, top);
+				ASSERT_TRUE(MM_HeapMapKernels::selectLevel((MM_HeapMapKernels::KernelLevel)level));
+				ASSERT_EQ(expectedCount, MM_HeapMapKernels::populationCount(base, top));
+
+				/* the word above the range must not be written */
+				*top = 0;
+				MM_HeapMapKernels::fill(base, top, UDATA_MAX);
+				ASSERT_EQ(lengths[i] * J9BITS_BITS_IN_SLOT, MM_HeapMapKernels::populationCount(base, top));
+				ASSERT_EQ((uintptr_t)0, *top);
+				MM_HeapMapKernels::fill(base, top, 0);
+				ASSERT_EQ(top, MM_HeapMapKernels::findNonZeroWord(base, top));
+			}
+		}
+	}
+}
+
+/**
+ * Compare throughput of the word at a time kernels with the vector kernels over a sparse mark map.
+ */
+TEST_F(HeapMapKernelsTest, throughput)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	uintptr_t *base = _words;
+	uintptr_t *top = _words + HEAPMAPKERNELS_TEST_WORDS;
+	uintptr_t bytes = HEAPMAPKERNELS_TEST_WORDS * sizeof(uintptr_t) * HEAPMAPKERNELS_TEST_REPEAT;
+	uintptr_t scalarCount = 0;
+
+	for (intptr_t level = MM_HeapMapKernels::KERNELS_SCALAR; level < MM_HeapMapKernels::KERNELS_COUNT; level++) {
+		if (!MM_HeapMapKernels::selectLevel((MM_HeapMapKernels::KernelLevel)level)) {
+			continue;
+		}
+
+		/* find: walk every run of empty words, as sweep does */
+		fillSparse(base, HEAPMAPKERNELS_TEST_WORDS);
+		uintptr_t found = 0;
+		uint64_t start = omrtime_hires_clock();
+		for (uintptr_t repeat = 0; repeat < HEAPMAPKERNELS_TEST_REPEAT; repeat++) {
+			uintptr_t *current = MM_HeapMapKernels::findNonZeroWord(base, top);
+			while (current < top) {
+				found += 1;
+				current = MM_HeapMapKernels::findNonZeroWord(current + 1, top);
+			}
+		}
+		uint64_t findMicros = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		ASSERT_EQ((HEAPMAPKERNELS_TEST_WORDS / HEAPMAPKERNELS_TEST_SPARSITY) * HEAPMAPKERNELS_TEST_REPEAT, found);
+
+		/* count: over a densely marked map, where word at a time cannot skip empty words */
+		for (uintptr_t i = 0; i < HEAPMAPKERNELS_TEST_WORDS; i++) {
+			base[i] = (uintptr_t)0x0123456789ABCDEFULL * (i + 1);
+		}
+		uintptr_t count = 0;
+		start = omrtime_hires_clock();
+		for (uintptr_t repeat = 0; repeat < HEAPMAPKERNELS_TEST_REPEAT; repeat++) {
+			count += MM_HeapMapKernels::populationCount(base, top);
+		}
+		uint64_t countMicros = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (MM_HeapMapKernels::KERNELS_SCALAR == level) {
+			scalarCount = count;
+		}
+		ASSERT_EQ(scalarCount, count);
+
+		start = omrtime_hires_clock();
+		for (uintptr_t repeat = 0; repeat < HEAPMAPKERNELS_TEST_REPEAT; repeat++) {
+			MM_HeapMapKernels::fill(base, top, 0);
+		}
+		uint64_t fillMicros = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+		gcTestEnv->log("HeapMapKernelsTest: %-6s find %8llu MB/s, count %8llu MB/s, clear %8llu MB/s\n",
+			MM_HeapMapKernels::getLevelName((MM_HeapMapKernels::KernelLevel)level),
+			(unsigned long long)(bytes / OMR_MAX(findMicros, 1)),
+			(unsigned long long)(bytes / OMR_MAX(countMicros, 1)),
+			(unsigned long long)(bytes / OMR_MAX(fillMicros, 1)));
+	}
+}
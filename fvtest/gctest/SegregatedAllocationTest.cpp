@@ -0,0 +1,311 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "omrExampleVM.hpp"
+#include "omrgc.h"
+#include "GCExtensionsBase.hpp"
+#include "ObjectModel.hpp"
+#include "ConcurrentSweeperSegregated.hpp"
+#include "SegregatedGC.hpp"
+#include "SweepSchemeSegregated.hpp"
+
+#include "gcTestHelpers.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/* large enough for a round of allocations from every thread without a collection */
+static char segregatedAllocationTestOptions[] = "-Xgcpolicy:segregated -Xms192m -Xmx192m";
+
+/* too small for a round while the garbage of the previous round is still queued for sweeping */
+static char segregatedConcurrentSweepTestOptions[] = "-Xgcpolicy:segregated -Xms96m -Xmx96m -Xgc:concurrentSweepSegregated";
+
+#define SEGREGATEDALLOCATION_TEST_ALLOCATIONS ((uintptr_t)1 << 20)
+#define SEGREGATEDALLOCATION_TEST_MAX_THREADS 64
+
+/* a mix of small object sizes, so that every thread allocates from several size classes */
+static const uintptr_t segregatedAllocationTestSizes[] = { 16, 24, 32, 24, 48, 16, 64, 96, 32, 128, 24, 256 };
+#define SEGREGATEDALLOCATION_TEST_SIZE_COUNT (sizeof(segregatedAllocationTestSizes) / sizeof(segregatedAllocationTestSizes[0]))
+
+/* a size class none of the sizes above uses, and a third as many allocations to fill about as much of the heap */
+static const uintptr_t segregatedAllocationTestOtherSizes[] = { 240 };
+#define SEGREGATEDALLOCATION_TEST_OTHER_SIZE_COUNT (sizeof(segregatedAllocationTestOtherSizes) / sizeof(segregatedAllocationTestOtherSizes[0]))
+#define SEGREGATEDALLOCATION_TEST_OTHER_ALLOCATIONS (SEGREGATEDALLOCATION_TEST_ALLOCATIONS / 3)
+
+class MM_StartupManagerSegregatedTest : public MM_StartupManagerImpl
+{
+private:
+	char *_options;
+
+protected:
+	virtual char *
+	getOptions(void)
+	{
+		return _options;
+	}
+
+public:
+	MM_StartupManagerSegregatedTest(OMR_VM *omrVM, char *options)
+		: MM_StartupManagerImpl(omrVM)
+		, _options(options)
+	{
+	}
+};
+
+class SegregatedAllocationTest : public ::testing::Test
+{
+public:
+	OMR_VM_Example *exampleVM;
+	omrthread_monitor_t monitor; /**< Protects the fields below */
+	bool started;
+	uintptr_t threadsRunning;
+	uintptr_t allocationsPerThread;
+	const uintptr_t *allocationSizes;
+	uintptr_t allocationSizeCount;
+	uintptr_t failedAllocations;
+
+protected:
+	virtual char *
+	getOptions()
+	{
+		return segregatedAllocationTestOptions;
+	}
+
+	virtual void
+	SetUp()
+	{
+		exampleVM = &(gcTestEnv->exampleVM);
+		monitor = NULL;
+
+		MM_StartupManagerSegregatedTest startupManager(exampleVM->_omrVM, getOptions());
+		omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+
+		rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+
+		rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
+
+		exampleVM->rootTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+		exampleVM->objectTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+
+		ASSERT_EQ(0, omrthread_monitor_init_with_name(&monitor, 0, "SegregatedAllocationTest::monitor"));
+	}
+
+	virtual void
+	TearDown()
+	{
+		if (NULL != monitor) {
+			omrthread_monitor_destroy(monitor);
+			monitor = NULL;
+		}
+
+		if (NULL != exampleVM->rootTable) {
+			hashTableFree(exampleVM->rootTable);
+			exampleVM->rootTable = NULL;
+		}
+		if (NULL != exampleVM->objectTable) {
+			hashTableForEachDo(exampleVM->objectTable, objectTableFreeFn, exampleVM);
+			hashTableFree(exampleVM->objectTable);
+			exampleVM->objectTable = NULL;
+		}
+
+		omr_error_t rc = OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownDispatcherThreads failed, rc=" << rc;
+
+		rc = OMR_GC_ShutdownCollector(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownCollector failed, rc=" << rc;
+
+		rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+
+		rc = OMR_GC_ShutdownHeap(exampleVM->_omrVM);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownHeap failed, rc=" << rc;
+
+		exampleVM->_omrVMThread = NULL;
+	}
+
+	static int J9THREAD_PROC
+	allocatingThreadProc(void *info)
+	{
+		SegregatedAllocationTest *test = (SegregatedAllocationTest *)info;
+		OMR_VMThread *omrVMThread = NULL;
+		uintptr_t failed = 0;
+
+		if (OMR_ERROR_NONE != OMR_Thread_Init(test->exampleVM->_omrVM, NULL, &omrVMThread, "SegregatedAllocationTest")) {
+			failed = test->allocationsPerThread;
+		}
+
+		omrthread_monitor_enter(test->monitor);
+		while (!test->started) {
+			omrthread_monitor_wait(test->monitor);
+		}
+		omrthread_monitor_exit(test->monitor);
+
+		if (NULL != omrVMThread) {
+			/* the objects are unreachable, collections are only done between rounds so the heap must hold a round */
+			for (uintptr_t i = 0; i < test->allocationsPerThread; i++) {
+				uintptr_t size = test->allocationSizes[i % test->allocationSizeCount];
+				if (NULL == OMR_GC_AllocateNoGC(omrVMThread, OMR_EXAMPLE_ALLOCATION_CATEGORY, size, 0)) {
+					failed += 1;
+				}
+			}
+			OMR_Thread_Free(omrVMThread);
+		}
+
+		omrthread_monitor_enter(test->monitor);
+		test->failedAllocations += failed;
+		test->threadsRunning -= 1;
+		omrthread_monitor_notify_all(test->monitor);
+		omrthread_exit(test->monitor);
+		return 0;
+	}
+
+	/**
+	 * Allocate a number of objects split across the given number of threads, cycling through the given sizes.
+	 * @return the time taken in microseconds, from the start of the allocations until every thread is done
+	 */
+	uint64_t
+	allocateRound(uintptr_t threadCount, uintptr_t allocations, const uintptr_t *sizes, uintptr_t sizeCount)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+
+		started = false;
+		threadsRunning = threadCount;
+		allocationsPerThread = allocations / threadCount;
+		allocationSizes = sizes;
+		allocationSizeCount = sizeCount;
+		failedAllocations = 0;
+
+		for (uintptr_t i = 0; i < threadCount; i++) {
+			omrthread_t thread = NULL;
+			if (0 != omrthread_create(&thread, 256 * 1024, J9THREAD_PRIORITY_NORMAL, 0, allocatingThreadProc, this)) {
+				omrthread_monitor_enter(monitor);
+				failedAllocations += allocationsPerThread;
+				threadsRunning -= 1;
+				omrthread_monitor_exit(monitor);
+			}
+		}
+
+		/* the threads attach before waiting, so only the allocations are timed */
+		omrthread_monitor_enter(monitor);
+		uint64_t startTime = omrtime_hires_clock();
+		started = true;
+		omrthread_monitor_notify_all(monitor);
+		while (0 != threadsRunning) {
+			omrthread_monitor_wait(monitor);
+		}
+		uint64_t endTime = omrtime_hires_clock();
+		omrthread_monitor_exit(monitor);
+
+		return omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	}
+
+	uint64_t
+	allocateRound(uintptr_t threadCount)
+	{
+		return allocateRound(threadCount, SEGREGATEDALLOCATION_TEST_ALLOCATIONS, segregatedAllocationTestSizes, SEGREGATEDALLOCATION_TEST_SIZE_COUNT);
+	}
+};
+
+class SegregatedConcurrentSweepAllocationTest : public SegregatedAllocationTest
+{
+protected:
+	virtual char *
+	getOptions()
+	{
+		return segregatedConcurrentSweepTestOptions;
+	}
+
+public:
+	/**
+	 * Wait for the background sweep of the last collection to finish.
+	 * @return the number of regions it swept
+	 */
+	uintptr_t
+	waitForConcurrentSweep()
+	{
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+		MM_SegregatedGC *globalCollector = (MM_SegregatedGC *)env->getExtensions()->getGlobalCollector();
+		MM_ConcurrentSweeperSegregated *concurrentSweeper = globalCollector->getSweepScheme()->getConcurrentSweeper();
+		concurrentSweeper->waitForSweep(env, concurrentSweeper->getSweepsCompleted());
+		return concurrentSweeper->getRegionsSweptConcurrently();
+	}
+};
+
+/**
+ * Allocation throughput of the segregated heap as the number of allocating threads grows.  Each thread allocates
+ * from its own per size class caches, which are refilled a batch of cell runs at a time.
+ */
+TEST_F(SegregatedAllocationTest, throughput)
+{
+	for (uintptr_t threadCount = 1; threadCount <= SEGREGATEDALLOCATION_TEST_MAX_THREADS; threadCount *= 2) {
+		uint64_t micros = allocateRound(threadCount);
+		ASSERT_EQ((uintptr_t)0, failedAllocations) << "allocation failed with " << threadCount << " threads";
+
+		uintptr_t allocations = allocationsPerThread * threadCount;
+		gcTestEnv->log("SegregatedAllocationTest: %2zu threads %10zu allocations/s\n", threadCount,
+				(uintptr_t)(((uint64_t)allocations * 1000000) / OMR_MAX(micros, 1)));
+
+		/* nothing is rooted, so the collection empties the heap for the next round */
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	}
+}
+
+/**
+ * Allocation with the heap swept in the background after each collection.  Every round after the first starts
+ * while the garbage of the previous one is still queued for sweeping.  The rounds alternate between size classes,
+ * so there is nothing to sweep on demand: the threads take the free regions left in the pool and then have to wait
+ * for the background sweeper to return the rest.  No allocation may fail.
+ */
+TEST_F(SegregatedConcurrentSweepAllocationTest, throughput)
+{
+	bool otherSizes = false;
+	for (uintptr_t threadCount = 1; threadCount <= SEGREGATEDALLOCATION_TEST_MAX_THREADS; threadCount *= 2) {
+		uint64_t micros = 0;
+		if (otherSizes) {
+			micros = allocateRound(threadCount, SEGREGATEDALLOCATION_TEST_OTHER_ALLOCATIONS, segregatedAllocationTestOtherSizes, SEGREGATEDALLOCATION_TEST_OTHER_SIZE_COUNT);
+		} else {
+			micros = allocateRound(threadCount);
+		}
+		otherSizes = !otherSizes;
+		ASSERT_EQ((uintptr_t)0, failedAllocations) << "allocation failed with " << threadCount << " threads";
+
+		uintptr_t allocations = allocationsPerThread * threadCount;
+		uintptr_t regionsSwept = waitForConcurrentSweep();
+		gcTestEnv->log("SegregatedConcurrentSweepAllocationTest: %2zu threads %10zu allocations/s %6zu regions swept concurrently\n",
+				threadCount, (uintptr_t)(((uint64_t)allocations * 1000000) / OMR_MAX(micros, 1)), regionsSwept);
+		if (1 != threadCount) {
+			/* the first round starts on an empty heap, the others after a collection */
+			ASSERT_LT((uintptr_t)0, regionsSwept) << "nothing was swept concurrently with " << threadCount << " threads";
+		}
+
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	}
+}
+
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
@@ -99,6 +99,86 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentSlack")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->concurrentSlack = atoi(attr.value());
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentSlack ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "optimizeConcurrentWB")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->optimizeConcurrentWB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: optimizeConcurrentWB ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "cardBlockSummary")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->cardBlockSummary = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: cardBlockSummary=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "workPacketStealing")) {
+					extensions->workPacketStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "markingPrefetchDistance")) {
+					extensions->markingPrefetchDistance = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "vectorHeapMapKernels")) {
+					extensions->vectorHeapMapKernels = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "rootScannerStatsEnabled")) {
+					extensions->rootScannerStatsEnabled = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "backgroundMarkMapClear")) {
+					extensions->backgroundMarkMapClear = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#if defined(OMR_GC_MODRON_SCAVENGER)
+				} else if (0 == strcmp(attr.name(), "scavengerScanOrdering")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "breadthFirst")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "hierarchical")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "depthFirst")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DEPTH_FIRST;
+					} else {
+						result = false;
+						gcTestEnv->log(LEVEL_ERROR, "Unrecognized scavengerScanOrdering: %s.\n", attr.value());
+					}
+				} else if (0 == strcmp(attr.name(), "scavengerDepthFirstCopyLimit")) {
+					extensions->scavengerDepthFirstCopyLimit = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerCardRememberedSet")) {
+					extensions->scavengerCardRememberedSet = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+				} else if (0 == strcmp(attr.name(), "tlhRefillStashSize")) {
+					extensions->tlhRefillStashSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "freeListSizeIndex")) {
+					extensions->freeListSizeIndex = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "gcThreadCount")) {
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
+				} else if (0 == strcmp(attr.name(), "asynchronousLogging")) {
+					extensions->asynchronousLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "binaryLogging")) {
+					extensions->binaryLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "dumpPauseTimeStats")) {
+					extensions->dumpPauseTimeStats = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "gcThreadSpinCount")) {
+					extensions->gcThreadSpinCount = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreading")) {
+					extensions->adaptiveGCThreading = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreadingBytesPerThread")) {
+					extensions->adaptiveGCThreadingBytesPerThread = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "numaAwareGCWork")) {
+					extensions->numaAwareGCWork = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodes")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+					/* compaction is disabled by default, see MM_StartupManager::loadGcOptions() */
+					if (0 == j9_cmdla_stricmp(attr.value(), "true")) {
+						extensions->noCompactOnGlobalGC = 0;
+						extensions->compactOnGlobalGC = 1;
+					}
+				} else if (0 == strcmp(attr.name(), "slidingCompaction")) {
+					extensions->slidingCompaction = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "partialCompactAreaCount")) {
+					extensions->partialCompactAreaCount = atoi(attr.value());
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
@@ -0,0 +1,48 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "ModronAssertions.h"
+
+#include "AdaptiveThreadCount.hpp"
+
+#include "EnvironmentBase.hpp"
+
+/* Threads allowed for each thread busy on average in the previous cycle, so that the thread count can grow while threads scale */
+#define ADAPTIVE_THREAD_COUNT_GROWTH_FACTOR 1.25
+
+void
+MM_AdaptiveThreadCount::recordTask(MM_EnvironmentBase *env, uintptr_t threadCount, uintptr_t work, uint64_t startTime, uint64_t endTime, uint64_t stallTime)
+{
+	Assert_MM_true(0 < threadCount);
+
+	_lastEfficiency = 1.0;
+	if (endTime > startTime) {
+		double threadTime = (double)(endTime - startTime) * (double)threadCount;
+		if (stallTime < threadTime) {
+			_lastEfficiency = 1.0 - ((double)stallTime / threadTime);
+		} else {
+			_lastEfficiency = 0.0;
+		}
+	}
+
+	uintptr_t workLimit = OMR_MAX(1, (work + _workPerThread - 1) / _workPerThread);
+	uintptr_t scalingLimit = (uintptr_t)((double)threadCount * _lastEfficiency * ADAPTIVE_THREAD_COUNT_GROWTH_FACTOR) + 1;
+	_recommendedThreadCount = OMR_MIN(workLimit, scalingLimit);
+}
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(ADAPTIVETHREADCOUNT_HPP_)
+#define ADAPTIVETHREADCOUNT_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Recommends the number of threads a parallel task should be dispatched with (see MM_Task::getRecommendedWorkingThreads()),
+ * from the work done by the same task in the previous cycle and how well its threads were kept busy.
+ *
+ * Two limits are applied:
+ * - the work limit gives each thread at least _workPerThread units of work (bytes copied, bytes scanned, ...), so a small
+ *   collection does not pay for waking and synchronizing threads it cannot keep busy;
+ * - the scaling limit allows a little more than the number of threads which were busy on average (thread count times the
+ *   fraction of time not spent stalled), so the count grows by a few threads a cycle while the threads scale, and shrinks
+ *   when they spend most of their time stalled.
+ * @ingroup GC_Base
+ */
+class MM_AdaptiveThreadCount : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	uintptr_t _workPerThread; /**< least units of work worth dispatching a thread for */
+	double _lastEfficiency; /**< fraction of the previous task's thread time not spent stalled, from 0 to 1 */
+	uintptr_t _recommendedThreadCount; /**< thread count recommended for the next cycle, UDATA_MAX if there is no recommendation */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Record the result of a task.  Called by the master thread once the task has completed.
+	 * @param[in] threadCount threads the task was dispatched with
+	 * @param[in] work units of work done by all the threads of the task
+	 * @param[in] startTime hires clock time the task was dispatched
+	 * @param[in] endTime hires clock time the task completed
+	 * @param[in] stallTime hires clock time the threads of the task spent stalled, summed over all threads
+	 */
+	void recordTask(MM_EnvironmentBase *env, uintptr_t threadCount, uintptr_t work, uint64_t startTime, uint64_t endTime, uint64_t stallTime);
+
+	/**
+	 * @return the thread count recommended for the next cycle of the task, UDATA_MAX if there is no recommendation
+	 */
+	MMINLINE uintptr_t getRecommendedThreadCount() { return _recommendedThreadCount; }
+
+	/**
+	 * @return the fraction of the previous task's thread time not spent stalled, from 0 to 1
+	 */
+	MMINLINE double getLastEfficiency() { return _lastEfficiency; }
+
+	MM_AdaptiveThreadCount(uintptr_t workPerThread)
+		: MM_BaseNonVirtual()
+		, _workPerThread(workPerThread)
+		, _lastEfficiency(1.0)
+		, _recommendedThreadCount(UDATA_MAX)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* ADAPTIVETHREADCOUNT_HPP_ */
@@ -57,6 +57,19 @@ MM_CardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 	return initialized;
 }
 
+bool
+MM_CardTable::initializeCardBlockSummary(MM_EnvironmentBase *env)
+{
+	uintptr_t cardTableSize = calculateCardTableSize(env, env->getExtensions()->heap->getMaximumPhysicalRange());
+	_cardBlockSummarySize = MM_Math::roundToCeiling((uintptr_t)1 << CARD_BLOCK_SHIFT, cardTableSize) >> CARD_BLOCK_SHIFT;
+	_cardBlockSummary = (uint8_t *)env->getForge()->allocate(_cardBlockSummarySize, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != _cardBlockSummary) {
+		/* The card table starts out clean */
+		memset((void *)_cardBlockSummary, CARD_BLOCK_CLEAN, _cardBlockSummarySize);
+	}
+	return NULL != _cardBlockSummary;
+}
+
 /**
  * Destroy a card table object by invoking the kill method on the
  * card table, debug card table and TLH mark map objects.
@@ -69,6 +82,11 @@ MM_CardTable::tearDown(MM_EnvironmentBase *env)
 	MM_MemoryManager *memoryManager = extensions->memoryManager;
 	/* Get rid of the virtual memory allocated for card table */
 	memoryManager->destroyVirtualMemory(env, &_cardTableMemoryHandle);
+
+	if (NULL != _cardBlockSummary) {
+		env->getForge()->free(_cardBlockSummary);
+		_cardBlockSummary = NULL;
+	}
 }
 
 uintptr_t
@@ -254,6 +272,7 @@ MM_CardTable::dirtyCardWithValue(MM_EnvironmentBase *env, omrobjectptr_t objectR
 		if (newValue != oldValue) {
 			Assert_MM_true((CARD_DIRTY == newValue) || (CARD_CLEAN == oldValue));
 			*card = newValue;
+			dirtyCardBlock(card);
 		}
 	}
 }
@@ -268,6 +287,7 @@ MM_CardTable::dirtyCardRange(MM_EnvironmentBase *env, void *heapAddrFrom, void *
 		/* If card not already dirty then dirty it */
 		if ((Card)CARD_DIRTY != *card) {
 			*card = (Card)CARD_DIRTY;
+			dirtyCardBlock(card);
 		}
 	}
 }
@@ -376,6 +396,16 @@ MM_CardTable::clearCardsInRange(MM_EnvironmentBase *env, void* heapBase, void* h
 	Card *lastCard = heapAddrToCardAddr(env,heapTop);
 	uintptr_t sizeToClear = (uint8_t *)lastCard - (uint8_t *)firstCard;
 
+	if (NULL != _cardBlockSummary) {
+		/* Only blocks wholly inside the range become clean; clear their summary bytes before the cards themselves */
+		uintptr_t firstBlock = MM_Math::roundToCeiling((uintptr_t)1 << CARD_BLOCK_SHIFT, (uintptr_t)firstCard - (uintptr_t)_cardTableStart) >> CARD_BLOCK_SHIFT;
+		uintptr_t lastBlock = ((uintptr_t)lastCard - (uintptr_t)_cardTableStart) >> CARD_BLOCK_SHIFT;
+		if (firstBlock < lastBlock) {
+			memset((void *)(_cardBlockSummary + firstBlock), CARD_BLOCK_CLEAN, lastBlock - firstBlock);
+			MM_AtomicOperations::storeSync();
+		}
+	}
+
 	/* We can't use OMRZeroMemory() here as that requires the  area to
 	 * be cleared to be uintptr_t aligned
 	 */
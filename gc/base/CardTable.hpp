@@ -38,6 +38,20 @@ class MM_CardCleaner;
 class MM_Heap;
 class MM_HeapRegionDescriptor;
 
+/**
+ * @ingroup GC_Base
+ * @name Card block summary
+ * The optional card block summary keeps one byte for each block of (1 << CARD_BLOCK_SHIFT) cards, which is set
+ * whenever a card in the block is dirtied.  A clear summary byte means that every card in the block is clean.
+ * @{
+ */
+#define CARD_BLOCK_SHIFT 9
+#define CARD_BLOCK_CLEAN ((uint8_t)0)
+#define CARD_BLOCK_DIRTY ((uint8_t)1)
+/**
+ * @}
+ */
+
 /**
  * @todo Provide typedef documentation
  * @ingroup GC_Base
@@ -59,6 +73,8 @@ private:
 	Card *_cardTableStart;
 	Card *_cardTableVirtualStart;
 	void *_heapBase; 
+	uint8_t *_cardBlockSummary; /**< One byte per block of cards, set when any card in the block may be dirty (NULL if the summary is not maintained) */
+	uintptr_t _cardBlockSummarySize; /**< Size of _cardBlockSummary in bytes */
 
 
 public:
@@ -81,6 +97,49 @@ public:
 	 */
 	void *getHeapBase() { return _heapBase; };
 
+	/**
+	 * @return true if a card block summary is maintained for this card table
+	 */
+	MMINLINE bool hasCardBlockSummary() { return NULL != _cardBlockSummary; }
+
+	/**
+	 * Record in the card block summary that the block holding the given card may contain a dirty card.  The summary
+	 * byte is written only if it is not already set, so the shared cache line is not written on every card dirtied.
+	 * @param[in] card The card being dirtied
+	 */
+	MMINLINE void
+	dirtyCardBlock(Card *card)
+	{
+		if (NULL != _cardBlockSummary) {
+			uint8_t *block = _cardBlockSummary + (((uintptr_t)card - (uintptr_t)_cardTableStart) >> CARD_BLOCK_SHIFT);
+			if (CARD_BLOCK_CLEAN == *block) {
+				*block = CARD_BLOCK_DIRTY;
+			}
+		}
+	}
+
+	/**
+	 * @param[in] card A card in the card table
+	 * @return false if every card in the block holding the given card is known to be clean
+	 * @note Only valid if a card block summary is maintained
+	 */
+	MMINLINE bool
+	isCardBlockDirty(Card *card)
+	{
+		return CARD_BLOCK_CLEAN != _cardBlockSummary[((uintptr_t)card - (uintptr_t)_cardTableStart) >> CARD_BLOCK_SHIFT];
+	}
+
+	/**
+	 * @param[in] card A card in the card table
+	 * @return the first card of the block following the block holding the given card
+	 */
+	MMINLINE Card *
+	getCardBlockTop(Card *card)
+	{
+		uintptr_t blockIndex = ((uintptr_t)card - (uintptr_t)_cardTableStart) >> CARD_BLOCK_SHIFT;
+		return _cardTableStart + ((blockIndex + 1) << CARD_BLOCK_SHIFT);
+	}
+
 	/**
 	 * Checks if card is dirty or has a specific value
  	 * @param[in] env A GC thread
@@ -143,6 +202,7 @@ public:
 	/**
 	 * Clears (sets to 0 - "clean") the cards backing the given range of the heap.
 	 * The current implementation will not clear the heapTop card.
+	 * The card block summary is cleared for every block which lies entirely within the range.
 	 * @param[in] heapBase Base of heap range whoose cards to be cleaned
 	 * @param[in] heapTop Top (non-inclusive) of heap range whoose associated cards are to be cleared
 	 * @return The size, in bytes, of the card table fragment cleared
@@ -242,6 +302,14 @@ protected:
 	 */
 	bool initialize(MM_EnvironmentBase *env, MM_Heap *heap);
 	virtual void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Allocate the card block summary, covering the whole card table.  The summary is only meaningful if every
+	 * write barrier dirties cards through dirtyCard(), as cards dirtied directly will not be recorded in it.
+	 * @param env[in] The master GC thread
+	 * @return true if the summary was allocated
+	 */
+	bool initializeCardBlockSummary(MM_EnvironmentBase *env);
 	
 	/**
 	 * Commits the card table range between lowCard and highCard:  [lowCard, highCard)
@@ -265,6 +333,8 @@ protected:
 		, _cardTableStart(NULL)
 		, _cardTableVirtualStart(NULL)
 		, _heapBase(NULL)
+		, _cardBlockSummary(NULL)
+		, _cardBlockSummarySize(0)
 	{
 		_typeId = __FUNCTION__;
 	}
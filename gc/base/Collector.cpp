@@ -297,6 +297,11 @@ MM_Collector::garbageCollect(MM_EnvironmentBase* env, MM_MemorySubSpace* calling
 {
 	Assert_MM_mustHaveExclusiveVMAccess(env->getOmrVMThread());
 
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_PauseTimeStats *pauseTimeStats = &env->getExtensions()->pauseTimeStats;
+	uint64_t pauseStartTime = omrtime_hires_clock();
+	uint64_t collectionsBefore = pauseTimeStats->getCollectionCount();
+
 	Assert_MM_true(NULL == env->_cycleState);
 	preCollect(env, callingSubSpace, allocateDescription, gcCode);
 	Assert_MM_true(NULL != env->_cycleState);
@@ -333,6 +338,11 @@ MM_Collector::garbageCollect(MM_EnvironmentBase* env, MM_MemorySubSpace* calling
 	/* finally, run postCollect */
 	postCollect(env, callingSubSpace);
 	Assert_MM_true(NULL != env->_cycleState);
+
+	/* A collection which percolated is not recorded, the collection it percolated to recorded the pause */
+	if (collectionsBefore == pauseTimeStats->getCollectionCount()) {
+		pauseTimeStats->recordPause(env, getPauseType(env), pauseStartTime, omrtime_hires_clock());
+	}
 	env->_cycleState = NULL;
 
 	return postCollectAllocationResult;
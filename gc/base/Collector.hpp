@@ -151,6 +151,16 @@ protected:
 	{
 	}
 
+	/**
+	 * Return the type of pause the collection just completed is recorded as in MM_PauseTimeStats.
+	 * @param env Master GC thread.
+	 * @return an OMR_GC_PAUSE_TYPE_* collection type
+	 */
+	virtual uintptr_t getPauseType(MM_EnvironmentBase* env)
+	{
+		return _globalCollector ? OMR_GC_PAUSE_TYPE_GLOBAL : OMR_GC_PAUSE_TYPE_SCAVENGE;
+	}
+
 public:
 	/**
 	 * Return the uintptr_t corresponding to the VMState for this Collector.
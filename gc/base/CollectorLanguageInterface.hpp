@@ -146,6 +146,12 @@ public:
 	virtual void compactScheme_fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme) = 0;
 	virtual void compactScheme_workerCleanupAfterGC(MM_EnvironmentBase *env) = 0;
 	virtual void compactScheme_verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap) = 0;
+	/**
+	 * A partial compaction only fixes up references into the evacuated areas from the objects that
+	 * markingScheme_scanObject() passed to MM_MarkingScheme::rememberObjectForPartialCompact().
+	 * @return true if the language records those objects, false to ignore partialCompactAreaCount
+	 */
+	virtual bool compactScheme_supportsPartialCompaction() { return false; }
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
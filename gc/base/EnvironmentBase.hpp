@@ -21,6 +21,7 @@
 
 #include "omrcomp.h"
 #include "modronbase.h"
+#include "j9nongenerated.h"
 #include "omr.h"
 #include "thread_api.h"
 
@@ -155,6 +156,7 @@ public:
 	MM_SweepStats _sweepStats;
 #if defined(OMR_GC_MODRON_COMPACTION)
 	MM_CompactStats _compactStats;
+	J9VMGC_SublistFragment _partialCompactRememberedSet; /**< thread local fragment of the remembered set of a partial compaction */
 #endif /* OMR_GC_MODRON_COMPACTION */
 #endif /* OMR_GC_MODRON_STANDARD || OMR_GC_REALTIME */
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
@@ -0,0 +1,127 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+
+#include "FreeEntrySizeIndex.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+
+void
+MM_FreeEntrySizeIndex::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _entries) {
+		env->getForge()->free(_entries);
+		_entries = NULL;
+	}
+	if (NULL != _tree) {
+		env->getForge()->free(_tree);
+		_tree = NULL;
+	}
+	_capacity = 0;
+	_valid = false;
+}
+
+void
+MM_FreeEntrySizeIndex::rebuild(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeList)
+{
+	_valid = false;
+
+	uintptr_t count = 0;
+	for (MM_HeapLinkedFreeHeader *entry = freeList; NULL != entry; entry = entry->getNext()) {
+		count += 1;
+	}
+
+	uintptr_t leafBase = 1;
+	while (leafBase < count) {
+		leafBase <<= 1;
+	}
+
+	if (leafBase > _capacity) {
+		tearDown(env);
+		/* leave some room for the list to grow before the storage has to be reallocated */
+		uintptr_t capacity = leafBase * 2;
+		_entries = (MM_HeapLinkedFreeHeader **)env->getForge()->allocate(sizeof(MM_HeapLinkedFreeHeader *) * capacity, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		_tree = (uintptr_t *)env->getForge()->allocate(sizeof(uintptr_t) * capacity * 2, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if ((NULL == _entries) || (NULL == _tree)) {
+			tearDown(env);
+			return;
+		}
+		_capacity = capacity;
+	}
+
+	_leafBase = leafBase;
+	uintptr_t index = 0;
+	for (MM_HeapLinkedFreeHeader *entry = freeList; NULL != entry; entry = entry->getNext()) {
+		_entries[index] = entry;
+		_tree[_leafBase + index] = entry->getSize();
+		index += 1;
+	}
+	for (; index < _leafBase; index++) {
+		_entries[index] = NULL;
+		_tree[_leafBase + index] = 0;
+	}
+	/* with a single leaf the leaf is also the root */
+	for (uintptr_t node = _leafBase - 1; node > 0; node--) {
+		_tree[node] = OMR_MAX(_tree[2 * node], _tree[(2 * node) + 1]);
+	}
+
+	_valid = true;
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntrySizeIndex::getPreviousEntry(uintptr_t index)
+{
+	/* climb until there is a non-empty subtree to the left, then take its rightmost live leaf */
+	uintptr_t node = _leafBase + index;
+	while (node > 1) {
+		if ((0 != (node & 1)) && (0 != _tree[node - 1])) {
+			node -= 1;
+			while (node < _leafBase) {
+				node = (2 * node) + 1;
+				if (0 == _tree[node]) {
+					node -= 1;
+				}
+			}
+			return _entries[node - _leafBase];
+		}
+		node >>= 1;
+	}
+	return NULL;
+}
+
+void
+MM_FreeEntrySizeIndex::update(uintptr_t index, MM_HeapLinkedFreeHeader *entry, uintptr_t size)
+{
+	Assert_MM_true(_valid && (index < _leafBase));
+	_entries[index] = entry;
+	uintptr_t node = _leafBase + index;
+	_tree[node] = size;
+	while (node > 1) {
+		node >>= 1;
+		uintptr_t largest = OMR_MAX(_tree[2 * node], _tree[(2 * node) + 1]);
+		if (largest == _tree[node]) {
+			break;
+		}
+		_tree[node] = largest;
+	}
+}
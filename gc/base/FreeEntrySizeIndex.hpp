@@ -0,0 +1,130 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(FREEENTRYSIZEINDEX_HPP_)
+#define FREEENTRYSIZEINDEX_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_HeapLinkedFreeHeader;
+
+/**
+ * Size index over an address ordered free list.
+ *
+ * The entries of the list are kept in address order in an array.  A tree over the array holds the largest
+ * entry size in each subtree, so the lowest addressed entry that is large enough for a request (the entry
+ * a first fit walk of the list stops at) and the entry before it in the list are both found in O(log n).
+ * The index is built from the complete list, after which the owning pool must report every change to the
+ * entries it allocates from, and invalidate the index on any other change to the list.
+ * @ingroup GC_Base_Core
+ */
+class MM_FreeEntrySizeIndex : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_HeapLinkedFreeHeader **_entries; /**< Free entries in address order, a removed entry keeps its slot with size 0 in the tree */
+	uintptr_t *_tree; /**< Largest entry size per subtree, node 1 is the root and the leaves start at _leafBase */
+	uintptr_t _leafBase; /**< Number of leaves in the tree (a power of 2 no smaller than the number of entries) */
+	uintptr_t _capacity; /**< Number of leaves allocated */
+	bool _valid; /**< True if the index describes the free list of the owning pool */
+
+	/*
+	 * Function members
+	 */
+public:
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Build the index from a complete free list.  The index is left invalid if its storage can not be allocated.
+	 * @param freeList first entry of the address ordered free list
+	 */
+	void rebuild(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeList);
+
+	MMINLINE void invalidate() { _valid = false; }
+	MMINLINE bool isValid() { return _valid; }
+
+	/**
+	 * @return the size of the largest free entry (0 if the list is empty)
+	 */
+	MMINLINE uintptr_t getLargestSize() { return _tree[1]; }
+
+	/**
+	 * Find the lowest addressed free entry of at least the given size.
+	 * @param size[in] size required
+	 * @param index[out] index of the entry
+	 * @return true if an entry was found
+	 */
+	MMINLINE bool
+	findFirstFit(uintptr_t size, uintptr_t *index)
+	{
+		if (_tree[1] < size) {
+			return false;
+		}
+		uintptr_t node = 1;
+		while (node < _leafBase) {
+			node <<= 1;
+			if (_tree[node] < size) {
+				node += 1;
+			}
+		}
+		*index = node - _leafBase;
+		return true;
+	}
+
+	MMINLINE MM_HeapLinkedFreeHeader *getEntry(uintptr_t index) { return _entries[index]; }
+
+	/**
+	 * @return the free entry before the given one in the list, or NULL if it is the first
+	 */
+	MM_HeapLinkedFreeHeader *getPreviousEntry(uintptr_t index);
+
+	/**
+	 * Record that the entry at the given index has been replaced by a smaller one at the same place in the list.
+	 */
+	void update(uintptr_t index, MM_HeapLinkedFreeHeader *entry, uintptr_t size);
+
+	/**
+	 * Record that the entry at the given index has been removed from the list.
+	 */
+	MMINLINE void remove(uintptr_t index) { update(index, NULL, 0); }
+
+	MM_FreeEntrySizeIndex()
+		: MM_BaseNonVirtual()
+		, _entries(NULL)
+		, _tree(NULL)
+		, _leafBase(0)
+		, _capacity(0)
+		, _valid(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* FREEENTRYSIZEINDEX_HPP_ */
@@ -39,6 +39,7 @@
 #include "NUMAManager.hpp"
 #include "OMRVMThreadListIterator.hpp"
 #include "ObjectModel.hpp"
+#include "PauseTimeStats.hpp"
 #include "ScavengerCopyScanRatio.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 #include "ScavengerHotFieldStats.hpp"
@@ -67,6 +68,9 @@ class MM_ObjectMap;
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 class MM_ReferenceChainWalkerMarkMap;
 class MM_RememberedSetCardBucket;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+class MM_RememberedSetCardTable;
+#endif /* OMR_GC_MODRON_SCAVENGER */
 #if defined(OMR_GC_STACCATO)
 class MM_RememberedSetWorkPackets;
 #endif /* OMR_GC_STACCATO */
@@ -180,6 +184,7 @@ public:
 
 	J9Pool* environments;
 	MM_ExcessiveGCStats excessiveGCStats;
+	MM_PauseTimeStats pauseTimeStats; /**< histograms of the pause times of each type of collection and phase */
 #if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
 	MM_GlobalGCStats globalGCStats;
 #endif /* OMR_GC_MODRON_STANDARD || OMR_GC_REALTIME */
@@ -206,6 +211,7 @@ public:
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
+	MM_RememberedSetCardTable *rememberedSetCardTable; /**< replaces rememberedSet when scavengerCardRememberedSet is set, NULL otherwise */
 #endif /* OMR_GC_MODRON_SCAVENGER */
 #if defined(OMR_GC_STACCATO)
 	MM_RememberedSetWorkPackets* staccatoRememberedSet; /**< The Staccato remembered set used for the write barrier */
@@ -254,6 +260,8 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	uintptr_t tlhRefillStashSize; /**< number of TLHs carved ahead into a per-CPU stash whenever a mutator TLH refresh has to lock an address ordered memory pool, 0 to refresh every TLH under the lock (set by -XXgc:tlhRefillStashSize=) */
+	bool freeListSizeIndex; /**< if true, address ordered memory pools keep a size index of their free list after each sweep and compaction, so an allocation finds its first fit entry without walking the list (set by -XXgc:freeListSizeIndex) */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -303,6 +311,11 @@ public:
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool workPacketStealing; /**< if true, GC threads keep non-empty packets on a private lock-free deque and steal from each other when idle, using the shared packet lists only as overflow (set by -XXgc:enableWorkPacketStealing) */
+	uintptr_t workPacketDequeSize; /**< capacity (in packets, rounded up to a power of two) of each GC thread's work stealing deque */
+	uintptr_t markingPrefetchDistance; /**< number of objects popped ahead of scanning and prefetched during marking, 0 to scan each object as it is popped (set by -XXgc:markingPrefetchDistance=) */
+	bool vectorHeapMapKernels; /**< if true, SSE2/AVX2 kernels are used for bulk heap map scanning, counting and clearing when the processor supports them (set by -XXgc:vectorHeapMapKernels) */
+	bool backgroundMarkMapClear; /**< if true, the mark map is cleared by a background thread between global collections instead of at the start of marking (set by -XXgc:backgroundMarkMapClear) */
 	
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -352,13 +365,18 @@ public:
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
+	uintptr_t gcThreadSpinCount; /**< times a GC thread waiting at a synchronization point or for a task checks for its release, yielding the CPU between checks, before waiting on the monitor (0, the default, to wait at once) */
+	bool adaptiveGCThreading; /**< if true, scavenge and mark tasks are dispatched with a thread count sized from the work and thread efficiency of the previous cycle (set by -XXgc:adaptiveGCThreading) */
+	uintptr_t adaptiveGCThreadingBytesPerThread; /**< with adaptiveGCThreading, the least bytes copied or scanned worth dispatching a GC thread for */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
 		OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST = 0,
 		OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL,
+		OMR_GC_SCAVENGER_SCANORDERING_DEPTH_FIRST, /**< hierarchical scanning, and chains of hot fields are copied depth first */
 	};
 	ScavengerScanOrdering scavengerScanOrdering; /**< scan ordering in Scavenger */
+	uintptr_t scavengerDepthFirstCopyLimit; /**< maximum number of generations of hot descendants copied behind an object when scan ordering is depth first */
 	bool scavengerTraceHotFields; /**< whether tracing hot fields in Scavenger is enabled */
 	MM_ScavengerHotFieldStats scavengerHotFieldStats; /**< hot field stats accumulated over all GC threads */
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -373,6 +391,7 @@ public:
 	bool scvTenureStrategyHistory; /**< Flag for enabling the History scavenger tenure strategy. */
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
+	bool scavengerCardRememberedSet; /**< remember tenured objects in a card table rather than in rememberedSet (set by -XXgc:scavengerCardRememberedSet) */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool concurrentScavenger;
 #endif	
@@ -437,6 +456,8 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool slidingCompaction; /**< if true, compaction slides the live objects of each region down in address order using a per block live byte summary, so every GC thread computes forwarding addresses and moves blocks independently (set by -XXgc:slidingCompaction) */
+	uintptr_t partialCompactAreaCount; /**< if non-zero, a compaction only evacuates this many of the most fragmented heap areas and fixes up references to them from a remembered set built while marking, ignored unless MM_CollectorLanguageInterface::compactScheme_supportsPartialCompaction() (set by -XXgc:partialCompactAreas=) */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -453,6 +474,7 @@ public:
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	bool cardBlockSummary; /**< if true, the card table records which blocks of cards have been dirtied so final card cleaning skips clean blocks; requires every write barrier to dirty cards through MM_CardTable::dirtyCard() (set by -XXgc:cardBlockSummary) */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -550,6 +572,7 @@ public:
 	uintptr_t allocationCacheInitialSize;
 	uintptr_t allocationCacheIncrementSize;
 	bool nonDeterministicSweep;
+	bool concurrentSweepSegregated; /**< Sweep the segregated heap on demand and in the background after a global collection, instead of in the pause (set by -Xgc:concurrentSweepSegregated) */
 /* OMR_GC_REALTIME (in for all) */
 
 	MM_ConfigurationOptions configurationOptions; /**< holds the options struct, used during startup for selecting a Configuration */
@@ -561,6 +584,9 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asynchronousLogging; /**< Enabled by -Xgc:asynchronousLogging.  Write logs (e.g. verbose:gc) to a file from a background thread, outside of GC pauses */
+	bool binaryLogging; /**< Enabled by -Xgc:binaryLogging.  Write verbose:gc logs from a background thread in a binary format, which the vgcconvert tool turns into XML */
+	bool dumpPauseTimeStats; /**< Enabled by -Xgc:dumpPauseTimeStats.  Print the pause time histograms when the collector is shut down */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -594,6 +620,7 @@ public:
 	uintptr_t regionSize; /**< The size, in bytes, of a fixed-size table-backed region of the heap (does not apply to AUX regions) */
 	MM_NUMAManager _numaManager; /**< The object which abstracts the details of our NUMA support so that the GCExtensions and the callers don't need to duplicate the support to interpret our intention */
 	bool numaForced; /**< if true, specifies if numa is disabled or enabled (actual value stored in NUMA Manager) by command line option */
+	bool numaAwareGCWork; /**< if true, GC threads are bound to NUMA nodes and prefer sweep chunks and work packets belonging to their own node (set by -XXgc:numaAwareGCWork) */
 
 	bool padToPageSize;
 	
@@ -997,6 +1024,9 @@ public:
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		, rememberedSetCardTable(NULL)
+#endif /* OMR_GC_MODRON_SCAVENGER */
 #if defined(OMR_GC_STACCATO)
 		, staccatoRememberedSet(NULL)
 #endif /* OMR_GC_STACCATO */
@@ -1023,6 +1053,8 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, tlhRefillStashSize(0)
+		, freeListSizeIndex(false)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1056,13 +1088,22 @@ public:
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
 		, cacheListSplit(0)
+		, workPacketStealing(false)
+		, workPacketDequeSize(64)
+		, markingPrefetchDistance(0)
+		, vectorHeapMapKernels(true)
+		, backgroundMarkMapClear(false)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
 		, softMx(0) /* softMx only set if specified */
 		, gcThreadCountForced(false)
+		, gcThreadSpinCount(0)
+		, adaptiveGCThreading(false)
+		, adaptiveGCThreadingBytesPerThread(256 * 1024)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
+		, scavengerDepthFirstCopyLimit(8)
 		, scavengerTraceHotFields(false)
 #endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_VLHGC */
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -1076,6 +1117,7 @@ public:
 		, scvTenureStrategyLookback(true)
 		, scvTenureStrategyHistory(true)
 		, scavengerEnabled(false)
+		, scavengerCardRememberedSet(false)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, concurrentScavenger(true)
 #endif		
@@ -1124,6 +1166,8 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, slidingCompaction(false)
+		, partialCompactAreaCount(0)
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 		, concurrentMark(false)
@@ -1141,6 +1185,7 @@ public:
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, cardBlockSummary(false)
 #endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 		, lowMinimum(0)
 		, allowMergedSpaces(1)
@@ -1197,11 +1242,15 @@ public:
 		, allocationCacheInitialSize(256)
 		, allocationCacheIncrementSize(256)
 		, nonDeterministicSweep(false)
+		, concurrentSweepSegregated(false)
 		, verboseGCManager(NULL)
 		, verbosegcCycleTime(1000)  /* by default metronome outputs verbosegc every 1sec */
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asynchronousLogging(false)
+		, binaryLogging(false)
+		, dumpPauseTimeStats(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1222,6 +1271,7 @@ public:
 		, regionSize(0)
 		, _numaManager()
 		, numaForced(false)
+		, numaAwareGCWork(false)
 		, padToPageSize(false)
 		, fvtest_disableExplictMasterThread(false)
 #if defined(OMR_GC_VLHGC)
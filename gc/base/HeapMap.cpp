@@ -24,6 +24,7 @@
 #include "Forge.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapKernels.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "Math.hpp"
 #include "MemoryManager.hpp"
@@ -51,6 +52,9 @@ MM_HeapMap::initialize(MM_EnvironmentBase *env)
 	}
 #endif /* OMR_GC_SEGREGATED_HEAP */
 
+	/* choose the bulk heap map kernels for this processor */
+	MM_HeapMapKernels::selectBestLevel(_extensions->vectorHeapMapKernels);
+
 	uintptr_t heapMapSizeRequired = getMaximumHeapMapSize(env);
 	
 	MM_MemoryManager *memoryManager = _extensions->memoryManager;
@@ -261,11 +265,7 @@ MM_HeapMap::setBitsInRange(MM_EnvironmentBase *env, void *lowAddress, void *high
 	
 	bytesToSet= (topIndex - baseIndex) * sizeof(uintptr_t);
 		
-	if (clear) {
-		OMRZeroMemory((void *)&(_heapMapBits[baseIndex]), bytesToSet);
-	} else {
-		memset(&(_heapMapBits[baseIndex]), 0xFF, bytesToSet);
-	}
+	MM_HeapMapKernels::fill(&_heapMapBits[baseIndex], &_heapMapBits[topIndex], clear ? 0 : UDATA_MAX);
 		
 	return bytesToSet;
 }
@@ -280,7 +280,6 @@ bool
 MM_HeapMap::checkBitsForRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region)
 {
 	uintptr_t baseIndex, topIndex;
-	uintptr_t bytesToCheck;
 
 	void *lowAddress = region->getLowAddress();
 	void *highAddress = region->getHighAddress();
@@ -301,14 +300,5 @@ MM_HeapMap::checkBitsForRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor
 	topIndex = _extensions->heap->calculateOffsetFromHeapBase(highAddress);
 	topIndex >>= _heapMapIndexShift;
 
-	bytesToCheck= (topIndex - baseIndex) * sizeof(uintptr_t);
-
-	uint8_t *markMapBytes = (uint8_t *)(&_heapMapBits[baseIndex]);
-	for (uintptr_t i = 0; i < bytesToCheck; i++) {
-		if (0 != markMapBytes[i]) {
-			return false;
-		}
-	}
-
-	return true;
+	return &_heapMapBits[topIndex] == MM_HeapMapKernels::findNonZeroWord(&_heapMapBits[baseIndex], &_heapMapBits[topIndex]);
 }
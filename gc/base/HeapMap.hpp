@@ -189,7 +189,29 @@ public:
 		return true;
 	}
 
-	MMINLINE void 
+	MMINLINE bool
+	atomicClearBit(omrobjectptr_t objectPtr)
+	{
+		uintptr_t slotIndex, bitMask;
+		/* Ensure compiler does not optimize away assign into oldValue */
+		volatile uintptr_t *slotAddress;
+		uintptr_t oldValue;
+
+		getSlotIndexAndMask(objectPtr, &slotIndex, &bitMask);
+		slotAddress = &(_heapMapBits[slotIndex]);
+
+		do {
+			oldValue = *slotAddress;
+			if(0 == (oldValue & bitMask)) {
+				return false;
+			}
+		} while(oldValue != MM_AtomicOperations::lockCompareExchange(slotAddress,
+																	 oldValue,
+																	 oldValue & ~bitMask));
+		return true;
+	}
+
+	MMINLINE void
 	atomicSetSlot(uintptr_t slotIndex, uintptr_t slotValue)
 	{
 		/* Ensure compiler does not optimize away assign into oldValue */
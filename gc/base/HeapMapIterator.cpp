@@ -20,6 +20,7 @@
 #include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapMap.hpp"
+#include "HeapMapKernels.hpp"
 #include "Math.hpp"
 #include "ObjectModel.hpp"
 
@@ -122,11 +123,17 @@ MM_HeapMapIterator::nextObject()
 		/* The termination point may not be at the end of the map slot - adjust accordingly */
 		_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * (J9BITS_BITS_IN_SLOT - _bitIndexHead);
 
-		/* Move to the next mark map slot */
+		/* Move to the next non-empty mark map slot, skipping runs of empty slots in bulk */
 		_heapMapSlotCurrent += 1;
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
-			_heapMapSlotValue = *_heapMapSlotCurrent;
+			uintptr_t heapMapSlotsRemaining = ((uintptr_t)(_heapChunkTop - _heapSlotCurrent) + J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT - 1) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT;
+			uintptr_t *heapMapSlotNonEmpty = MM_HeapMapKernels::findNonZeroWord(_heapMapSlotCurrent, _heapMapSlotCurrent + heapMapSlotsRemaining);
+			_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (uintptr_t)(heapMapSlotNonEmpty - _heapMapSlotCurrent);
+			_heapMapSlotCurrent = heapMapSlotNonEmpty;
+			if(_heapSlotCurrent < _heapChunkTop) {
+				_heapMapSlotValue = *_heapMapSlotCurrent;
+			}
 		}
 	}
 
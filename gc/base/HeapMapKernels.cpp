@@ -0,0 +1,349 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "HeapMapKernels.hpp"
+
+#include <string.h>
+#if defined(J9MODRON_HEAPMAP_VECTOR_KERNELS)
+#include <immintrin.h>
+#endif /* J9MODRON_HEAPMAP_VECTOR_KERNELS */
+
+#include "omrutil.h"
+
+#include "Bits.hpp"
+
+/**
+ * Ranges at least this many bytes long are filled with non-temporal stores by the vector kernels.
+ * Smaller ranges are likely to still be cached when they are next touched (e.g. by marking), and
+ * the C library memset is already vectorized, so they are filled by the scalar kernel.
+ */
+#define J9MODRON_HEAPMAP_NON_TEMPORAL_FILL_THRESHOLD ((uintptr_t)16 * 1024 * 1024)
+
+MM_HeapMapKernels::KernelLevel MM_HeapMapKernels::_level = MM_HeapMapKernels::KERNELS_SCALAR;
+MM_HeapMapKernels::FindNonZeroWordFunction MM_HeapMapKernels::_findNonZeroWord = MM_HeapMapKernels::findNonZeroWordScalar;
+MM_HeapMapKernels::PopulationCountFunction MM_HeapMapKernels::_populationCount = MM_HeapMapKernels::populationCountScalar;
+MM_HeapMapKernels::FillFunction MM_HeapMapKernels::_fill = MM_HeapMapKernels::fillScalar;
+
+bool
+MM_HeapMapKernels::isLevelSupported(KernelLevel level)
+{
+	bool supported = false;
+
+	switch (level) {
+	case KERNELS_SCALAR:
+		supported = true;
+		break;
+#if defined(J9MODRON_HEAPMAP_VECTOR_KERNELS)
+	case KERNELS_SSE2:
+		/* SSE2 is part of the x86-64 base instruction set */
+		supported = true;
+		break;
+	case KERNELS_AVX2:
+		/* also checks that the operating system saves the YMM state */
+		__builtin_cpu_init();
+		supported = (0 != __builtin_cpu_supports("avx2"));
+		break;
+#endif /* J9MODRON_HEAPMAP_VECTOR_KERNELS */
+	default:
+		break;
+	}
+
+	return supported;
+}
+
+bool
+MM_HeapMapKernels::selectLevel(KernelLevel level)
+{
+	if (!isLevelSupported(level)) {
+		return false;
+	}
+
+	switch (level) {
+#if defined(J9MODRON_HEAPMAP_VECTOR_KERNELS)
+	case KERNELS_SSE2:
+		_findNonZeroWord = findNonZeroWordSSE2;
+		_populationCount = populationCountSSE2;
+		_fill = fillSSE2;
+		break;
+	case KERNELS_AVX2:
+		_findNonZeroWord = findNonZeroWordAVX2;
+		_populationCount = populationCountAVX2;
+		_fill = fillAVX2;
+		break;
+#endif /* J9MODRON_HEAPMAP_VECTOR_KERNELS */
+	default:
+		_findNonZeroWord = findNonZeroWordScalar;
+		_populationCount = populationCountScalar;
+		_fill = fillScalar;
+		break;
+	}
+	_level = level;
+
+	return true;
+}
+
+MM_HeapMapKernels::KernelLevel
+MM_HeapMapKernels::selectBestLevel(bool allowVector)
+{
+	intptr_t level = KERNELS_SCALAR;
+
+	if (allowVector) {
+		for (level = KERNELS_COUNT - 1; level > KERNELS_SCALAR; level--) {
+			if (isLevelSupported((KernelLevel)level)) {
+				break;
+			}
+		}
+	}
+	selectLevel((KernelLevel)level);
+
+	return _level;
+}
+
+const char *
+MM_HeapMapKernels::getLevelName(KernelLevel level)
+{
+	switch (level) {
+	case KERNELS_SCALAR:
+		return "scalar";
+	case KERNELS_SSE2:
+		return "sse2";
+	case KERNELS_AVX2:
+		return "avx2";
+	default:
+		return "unknown";
+	}
+}
+
+/****************************************
+ * Scalar kernels
+ ****************************************
+ */
+
+uintptr_t *
+MM_HeapMapKernels::findNonZeroWordScalar(uintptr_t *current, uintptr_t *top)
+{
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+uintptr_t
+MM_HeapMapKernels::populationCountScalar(uintptr_t *base, uintptr_t *top)
+{
+	uintptr_t count = 0;
+	for (uintptr_t *current = base; current < top; current++) {
+		count += MM_Bits::populationCount(*current);
+	}
+	return count;
+}
+
+void
+MM_HeapMapKernels::fillScalar(uintptr_t *base, uintptr_t *top, uintptr_t value)
+{
+	if (0 == value) {
+		OMRZeroMemory((void *)base, (top - base) * sizeof(uintptr_t));
+	} else if (UDATA_MAX == value) {
+		memset((void *)base, 0xFF, (top - base) * sizeof(uintptr_t));
+	} else {
+		for (uintptr_t *current = base; current < top; current++) {
+			*current = value;
+		}
+	}
+}
+
+#if defined(J9MODRON_HEAPMAP_VECTOR_KERNELS)
+
+/****************************************
+ * SSE2 kernels
+ ****************************************
+ */
+
+uintptr_t *
+MM_HeapMapKernels::findNonZeroWordSSE2(uintptr_t *current, uintptr_t *top)
+{
+	const uintptr_t wordsPerBlock = (4 * sizeof(__m128i)) / sizeof(uintptr_t);
+	const __m128i zero = _mm_setzero_si128();
+
+	while ((current < top) && (0 != ((uintptr_t)current & (sizeof(__m128i) - 1)))) {
+		if (0 != *current) {
+			return current;
+		}
+		current += 1;
+	}
+
+	/* test a cache line worth of words at a time */
+	while ((uintptr_t)(top - current) >= wordsPerBlock) {
+		const __m128i *block = (const __m128i *)current;
+		__m128i any = _mm_or_si128(
+				_mm_or_si128(_mm_load_si128(block), _mm_load_si128(block + 1)),
+				_mm_or_si128(_mm_load_si128(block + 2), _mm_load_si128(block + 3)));
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(any, zero))) {
+			break;
+		}
+		current += wordsPerBlock;
+	}
+
+	/* locate the word within the block, or finish the tail */
+	return findNonZeroWordScalar(current, top);
+}
+
+uintptr_t
+MM_HeapMapKernels::populationCountSSE2(uintptr_t *base, uintptr_t *top)
+{
+	const uintptr_t wordsPerVector = sizeof(__m128i) / sizeof(uintptr_t);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i mask1 = _mm_set1_epi8(0x55);
+	const __m128i mask2 = _mm_set1_epi8(0x33);
+	const __m128i mask4 = _mm_set1_epi8(0x0F);
+	__m128i sums = _mm_setzero_si128();
+	uintptr_t *current = base;
+
+	while ((uintptr_t)(top - current) >= wordsPerVector) {
+		__m128i bits = _mm_loadu_si128((const __m128i *)current);
+		/* per byte bit counts, then sum the bytes of each half into a 64 bit lane */
+		bits = _mm_sub_epi8(bits, _mm_and_si128(_mm_srli_epi16(bits, 1), mask1));
+		bits = _mm_add_epi8(_mm_and_si128(bits, mask2), _mm_and_si128(_mm_srli_epi16(bits, 2), mask2));
+		bits = _mm_and_si128(_mm_add_epi8(bits, _mm_srli_epi16(bits, 4)), mask4);
+		sums = _mm_add_epi64(sums, _mm_sad_epu8(bits, zero));
+		current += wordsPerVector;
+	}
+
+	uintptr_t count = (uintptr_t)_mm_cvtsi128_si64(sums) + (uintptr_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(sums, sums));
+
+	return count + populationCountScalar(current, top);
+}
+
+void
+MM_HeapMapKernels::fillSSE2(uintptr_t *base, uintptr_t *top, uintptr_t value)
+{
+	const uintptr_t wordsPerVector = sizeof(__m128i) / sizeof(uintptr_t);
+	uintptr_t *current = base;
+
+	if (((top - base) * sizeof(uintptr_t)) < J9MODRON_HEAPMAP_NON_TEMPORAL_FILL_THRESHOLD) {
+		fillScalar(base, top, value);
+		return;
+	}
+
+	const __m128i values = _mm_set1_epi64x((long long)value);
+	while (0 != ((uintptr_t)current & (sizeof(__m128i) - 1))) {
+		*current = value;
+		current += 1;
+	}
+	while ((uintptr_t)(top - current) >= wordsPerVector) {
+		_mm_stream_si128((__m128i *)current, values);
+		current += wordsPerVector;
+	}
+	/* order the streaming stores with respect to any later stores */
+	_mm_sfence();
+	while (current < top) {
+		*current = value;
+		current += 1;
+	}
+}
+
+/****************************************
+ * AVX2 kernels
+ ****************************************
+ */
+
+__attribute__((target("avx2"))) uintptr_t *
+MM_HeapMapKernels::findNonZeroWordAVX2(uintptr_t *current, uintptr_t *top)
+{
+	const uintptr_t wordsPerBlock = (4 * sizeof(__m256i)) / sizeof(uintptr_t);
+
+	while ((current < top) && (0 != ((uintptr_t)current & (sizeof(__m256i) - 1)))) {
+		if (0 != *current) {
+			return current;
+		}
+		current += 1;
+	}
+
+	/* test two cache lines worth of words at a time */
+	while ((uintptr_t)(top - current) >= wordsPerBlock) {
+		const __m256i *block = (const __m256i *)current;
+		__m256i any = _mm256_or_si256(
+				_mm256_or_si256(_mm256_load_si256(block), _mm256_load_si256(block + 1)),
+				_mm256_or_si256(_mm256_load_si256(block + 2), _mm256_load_si256(block + 3)));
+		if (!_mm256_testz_si256(any, any)) {
+			break;
+		}
+		current += wordsPerBlock;
+	}
+
+	/* locate the word within the block, or finish the tail */
+	return findNonZeroWordScalar(current, top);
+}
+
+__attribute__((target("avx2"))) uintptr_t
+MM_HeapMapKernels::populationCountAVX2(uintptr_t *base, uintptr_t *top)
+{
+	const uintptr_t wordsPerVector = sizeof(__m256i) / sizeof(uintptr_t);
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i lowNibble = _mm256_set1_epi8(0x0F);
+	/* bit count of each nibble value, looked up with a byte shuffle */
+	const __m256i nibbleCounts = _mm256_setr_epi8(
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	__m256i sums = _mm256_setzero_si256();
+	uintptr_t *current = base;
+
+	while ((uintptr_t)(top - current) >= wordsPerVector) {
+		__m256i bits = _mm256_loadu_si256((const __m256i *)current);
+		__m256i low = _mm256_and_si256(bits, lowNibble);
+		__m256i high = _mm256_and_si256(_mm256_srli_epi16(bits, 4), lowNibble);
+		__m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(nibbleCounts, low), _mm256_shuffle_epi8(nibbleCounts, high));
+		sums = _mm256_add_epi64(sums, _mm256_sad_epu8(counts, zero));
+		current += wordsPerVector;
+	}
+
+	uintptr_t count = (uintptr_t)_mm256_extract_epi64(sums, 0) + (uintptr_t)_mm256_extract_epi64(sums, 1)
+			+ (uintptr_t)_mm256_extract_epi64(sums, 2) + (uintptr_t)_mm256_extract_epi64(sums, 3);
+
+	return count + populationCountScalar(current, top);
+}
+
+__attribute__((target("avx2"))) void
+MM_HeapMapKernels::fillAVX2(uintptr_t *base, uintptr_t *top, uintptr_t value)
+{
+	const uintptr_t wordsPerVector = sizeof(__m256i) / sizeof(uintptr_t);
+	uintptr_t *current = base;
+
+	if (((top - base) * sizeof(uintptr_t)) < J9MODRON_HEAPMAP_NON_TEMPORAL_FILL_THRESHOLD) {
+		fillScalar(base, top, value);
+		return;
+	}
+
+	const __m256i values = _mm256_set1_epi64x((long long)value);
+	while (0 != ((uintptr_t)current & (sizeof(__m256i) - 1))) {
+		*current = value;
+		current += 1;
+	}
+	while ((uintptr_t)(top - current) >= wordsPerVector) {
+		_mm256_stream_si256((__m256i *)current, values);
+		current += wordsPerVector;
+	}
+	/* order the streaming stores with respect to any later stores */
+	_mm_sfence();
+	while (current < top) {
+		*current = value;
+		current += 1;
+	}
+}
+
+#endif /* J9MODRON_HEAPMAP_VECTOR_KERNELS */
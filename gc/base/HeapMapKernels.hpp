@@ -0,0 +1,143 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(HEAPMAPKERNELS_HPP_)
+#define HEAPMAPKERNELS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(__GNUC__) && defined(J9HAMMER)
+#define J9MODRON_HEAPMAP_VECTOR_KERNELS
+#endif /* defined(__GNUC__) && defined(J9HAMMER) */
+
+/**
+ * Bulk operations over ranges of heap map words.
+ *
+ * The heap map is walked a word at a time by the iterators and sweep; these kernels are used where
+ * long runs of words have to be scanned or written.  On x86-64 the SSE2 or AVX2 implementation is
+ * selected once at startup (see MM_HeapMap::initialize()), all other platforms use the scalar kernels.
+ * All ranges are [base, top) in heap map words and need not be aligned beyond uintptr_t.
+ * @ingroup GC_Base_Core
+ */
+class MM_HeapMapKernels
+{
+	/*
+	 * Data members
+	 */
+public:
+	/**
+	 * Kernel implementations, in increasing order of preference.
+	 */
+	enum KernelLevel {
+		KERNELS_SCALAR = 0,
+		KERNELS_SSE2,
+		KERNELS_AVX2,
+		KERNELS_COUNT
+	};
+
+	typedef uintptr_t *(*FindNonZeroWordFunction)(uintptr_t *current, uintptr_t *top);
+	typedef uintptr_t (*PopulationCountFunction)(uintptr_t *base, uintptr_t *top);
+	typedef void (*FillFunction)(uintptr_t *base, uintptr_t *top, uintptr_t value);
+
+private:
+	static KernelLevel _level; /**< Currently selected kernel implementation */
+	static FindNonZeroWordFunction _findNonZeroWord;
+	static PopulationCountFunction _populationCount;
+	static FillFunction _fill;
+
+	/*
+	 * Function members
+	 */
+private:
+	static uintptr_t *findNonZeroWordScalar(uintptr_t *current, uintptr_t *top);
+	static uintptr_t populationCountScalar(uintptr_t *base, uintptr_t *top);
+	static void fillScalar(uintptr_t *base, uintptr_t *top, uintptr_t value);
+#if defined(J9MODRON_HEAPMAP_VECTOR_KERNELS)
+	static uintptr_t *findNonZeroWordSSE2(uintptr_t *current, uintptr_t *top);
+	static uintptr_t populationCountSSE2(uintptr_t *base, uintptr_t *top);
+	static void fillSSE2(uintptr_t *base, uintptr_t *top, uintptr_t value);
+	static uintptr_t *findNonZeroWordAVX2(uintptr_t *current, uintptr_t *top);
+	static uintptr_t populationCountAVX2(uintptr_t *base, uintptr_t *top);
+	static void fillAVX2(uintptr_t *base, uintptr_t *top, uintptr_t value);
+#endif /* J9MODRON_HEAPMAP_VECTOR_KERNELS */
+
+public:
+	/**
+	 * Determine whether the processor (and operating system) can run the given kernel implementation.
+	 */
+	static bool isLevelSupported(KernelLevel level);
+
+	/**
+	 * Select the kernel implementation used by all subsequent calls.
+	 * @param level[in] the implementation to use
+	 * @return true if the implementation was selected, false if it is not supported (the selection is unchanged)
+	 */
+	static bool selectLevel(KernelLevel level);
+
+	/**
+	 * Select the best supported kernel implementation.
+	 * @param allowVector[in] if false, the scalar kernels are selected regardless of processor support
+	 * @return the selected implementation
+	 */
+	static KernelLevel selectBestLevel(bool allowVector);
+
+	MMINLINE static KernelLevel getLevel() { return _level; }
+
+	/**
+	 * @return a printable name for the given kernel implementation
+	 */
+	static const char *getLevelName(KernelLevel level);
+
+	/**
+	 * Find the first non-zero word in [current, top).
+	 * @return the address of the first non-zero word, or top if every word in the range is zero
+	 */
+	MMINLINE static uintptr_t *
+	findNonZeroWord(uintptr_t *current, uintptr_t *top)
+	{
+		return _findNonZeroWord(current, top);
+	}
+
+	/**
+	 * Count the bits set in [base, top).
+	 */
+	MMINLINE static uintptr_t
+	populationCount(uintptr_t *base, uintptr_t *top)
+	{
+		return _populationCount(base, top);
+	}
+
+	/**
+	 * Store value in every word of [base, top).  Very large ranges are written with non-temporal stores
+	 * by the vector kernels so that clearing a map does not flush the caches.
+	 */
+	MMINLINE static void
+	fill(uintptr_t *base, uintptr_t *top, uintptr_t value)
+	{
+		_fill(base, top, value);
+	}
+};
+
+#endif /* HEAPMAPKERNELS_HPP_ */
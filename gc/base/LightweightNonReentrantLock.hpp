@@ -86,6 +86,21 @@ public:
 		return true;
 	};
 
+	/**
+	 * Acquire the lock only if it is free, without spinning or waiting.
+	 *
+	 * @return TRUE if the lock was acquired, FALSE if it is in use
+	 * @note Creates a load/store barrier when the lock is acquired.
+	 */
+	MMINLINE bool tryAcquire()
+	{
+#if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
+		return 0 == omrgc_spinlock_try_acquire(&_spinlock, _tracing);
+#else /* J9MODRON_USE_CUSTOM_SPINLOCKS */
+		return 0 == MUTEX_TRY_ENTER(_mutex);
+#endif /* J9MODRON_USE_CUSTOM_SPINLOCKS */
+	};
+
 	/**
 	 * Release the lock.
 	 * If the current thread is not the owner of the lock, the
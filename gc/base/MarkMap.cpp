@@ -108,3 +108,13 @@ MM_MarkMap::initializeMarkMap(MM_EnvironmentBase *env)
 		}
 	}
 }
+
+void
+MM_MarkMap::getMarkMapRangeForHeapRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress, uintptr_t **markMapBase, uintptr_t **markMapTop)
+{
+	uintptr_t heapOffsetLow = ((uintptr_t)lowAddress) - _heapMapBaseDelta;
+	uintptr_t heapOffsetHigh = ((uintptr_t)highAddress) - _heapMapBaseDelta;
+
+	*markMapBase = (uintptr_t *)(((uintptr_t)_heapMapBits) + convertHeapIndexToHeapMapIndex(env, heapOffsetLow, sizeof(uintptr_t)));
+	*markMapTop = (uintptr_t *)(((uintptr_t)_heapMapBits) + convertHeapIndexToHeapMapIndex(env, heapOffsetHigh, sizeof(uintptr_t)));
+}
@@ -48,6 +48,15 @@ public:
  	
  	void initializeMarkMap(MM_EnvironmentBase *env);
 
+	/**
+	 * Find the mark map words which cover a range of the heap.
+	 * @param lowAddress[in] base of the heap range
+	 * @param highAddress[in] top of the heap range
+	 * @param markMapBase[out] first mark map word for the range
+	 * @param markMapTop[out] mark map word following the range
+	 */
+	void getMarkMapRangeForHeapRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress, uintptr_t **markMapBase, uintptr_t **markMapTop);
+
 	MMINLINE void *getMarkBits() { return _heapMapBits; };
  	
 	MMINLINE uintptr_t getHeapMapBaseRegionRounded() { return _heapMapBaseDelta; }
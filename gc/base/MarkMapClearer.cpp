@@ -0,0 +1,312 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "modronopt.h"
+#include "ModronAssertions.h"
+#include "omrport.h"
+#include "omrutil.h"
+
+#include "MarkMapClearer.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapMapKernels.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "MarkMap.hpp"
+#include "MarkStats.hpp"
+#include "ParallelDispatcher.hpp"
+
+/* Number of mark map words cleared per chunk (64K of mark map, covering 4M of heap on 64 bit) */
+#define MARKMAPCLEARER_CHUNK_WORDS ((uintptr_t)(64 * 1024) / sizeof(uintptr_t))
+
+MM_MarkMapClearer::MM_MarkMapClearer(MM_EnvironmentBase *env)
+	: MM_BaseNonVirtual()
+	, _extensions(env->getExtensions())
+	, _monitor(NULL)
+	, _state(STATE_ERROR)
+	, _ranges(NULL)
+	, _rangeCount(0)
+	, _rangeMax(0)
+	, _nextRange(0)
+	, _armed(false)
+	, _bytesClearedConcurrently(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_MarkMapClearer *
+MM_MarkMapClearer::newInstance(MM_EnvironmentBase *env)
+{
+	MM_MarkMapClearer *clearer = (MM_MarkMapClearer *)env->getForge()->allocate(sizeof(MM_MarkMapClearer), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != clearer) {
+		new(clearer) MM_MarkMapClearer(env);
+		if (!clearer->initialize(env)) {
+			clearer->kill(env);
+			clearer = NULL;
+		}
+	}
+	return clearer;
+}
+
+void
+MM_MarkMapClearer::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_MarkMapClearer::initialize(MM_EnvironmentBase *env)
+{
+	return 0 == omrthread_monitor_init_with_name(&_monitor, 0, "MM_MarkMapClearer::_monitor");
+}
+
+void
+MM_MarkMapClearer::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _ranges) {
+		env->getForge()->free(_ranges);
+		_ranges = NULL;
+	}
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+uintptr_t
+MM_MarkMapClearer::clearer_thread_proc2(OMRPortLibrary* portLib, void *info)
+{
+	MM_MarkMapClearer *clearer = (MM_MarkMapClearer *)info;
+	/* run the clearing loop until shutdown.  This method will NOT return */
+	clearer->clearerThreadEntryPoint();
+	Assert_MM_unreachable();
+	return 0;
+}
+
+int J9THREAD_PROC
+MM_MarkMapClearer::clearer_thread_proc(void *info)
+{
+	MM_MarkMapClearer *clearer = (MM_MarkMapClearer *)info;
+	MM_GCExtensionsBase *extensions = clearer->_extensions;
+	OMR_VM *omrVM = extensions->getOmrVM();
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	uintptr_t rc = 0;
+	omrsig_protect(clearer_thread_proc2, info,
+			((MM_ParallelDispatcher *)extensions->dispatcher)->getSignalHandler(), omrVM,
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+	return 0;
+}
+
+bool
+MM_MarkMapClearer::startup()
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it can not notify us of its start-up state before we wait */
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		clearer_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _state) {
+			omrthread_monitor_wait(_monitor);
+		}
+		success = (STATE_ERROR != _state);
+	} else {
+		_state = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return success;
+}
+
+void
+MM_MarkMapClearer::shutdown()
+{
+	Assert_MM_true(NULL != _monitor);
+	if (STATE_ERROR != _state) {
+		/* tell the thread to stop and then wait for it to exit */
+		omrthread_monitor_enter(_monitor);
+		while (STATE_TERMINATED != _state) {
+			_state = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify_all(_monitor);
+			omrthread_monitor_wait(_monitor);
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+	_armed = false;
+}
+
+void
+MM_MarkMapClearer::clearerThreadEntryPoint()
+{
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_WAITING;
+	omrthread_monitor_notify_all(_monitor);
+	do {
+		if (STATE_CLEAR_REQUESTED == _state) {
+			_state = STATE_CLEARING;
+			/* clear outside of the monitor so that a pause request is seen at the next chunk boundary */
+			omrthread_monitor_exit(_monitor);
+			uintptr_t bytesCleared = 0;
+			uintptr_t *base = NULL;
+			uintptr_t *top = NULL;
+			while ((STATE_CLEARING == _state) && claimChunk(&base, &top)) {
+				MM_HeapMapKernels::fill(base, top, 0);
+				bytesCleared += (uintptr_t)top - (uintptr_t)base;
+			}
+			omrthread_monitor_enter(_monitor);
+			_bytesClearedConcurrently += bytesCleared;
+			if ((STATE_CLEARING == _state) || (STATE_PAUSE_REQUESTED == _state)) {
+				_state = STATE_WAITING;
+				omrthread_monitor_notify_all(_monitor);
+			}
+		} else if (STATE_PAUSE_REQUESTED == _state) {
+			/* paused before the clear request was picked up */
+			_state = STATE_WAITING;
+			omrthread_monitor_notify_all(_monitor);
+		} else if (STATE_WAITING == _state) {
+			omrthread_monitor_wait(_monitor);
+		}
+	} while (STATE_TERMINATION_REQUESTED != _state);
+	_state = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+bool
+MM_MarkMapClearer::claimChunk(uintptr_t **base, uintptr_t **top)
+{
+	uintptr_t rangeIndex = _nextRange;
+	while (rangeIndex < _rangeCount) {
+		ClearRange *range = &_ranges[rangeIndex];
+		uintptr_t current = range->current;
+		while (current < (uintptr_t)range->top) {
+			uintptr_t chunkTop = OMR_MIN(current + (MARKMAPCLEARER_CHUNK_WORDS * sizeof(uintptr_t)), (uintptr_t)range->top);
+			if (current == MM_AtomicOperations::lockCompareExchange(&range->current, current, chunkTop)) {
+				*base = (uintptr_t *)current;
+				*top = (uintptr_t *)chunkTop;
+				return true;
+			}
+			current = range->current;
+		}
+		/* this range is fully claimed, move on to the next one (another thread may already have) */
+		MM_AtomicOperations::lockCompareExchange(&_nextRange, rangeIndex, rangeIndex + 1);
+		rangeIndex = _nextRange;
+	}
+	return false;
+}
+
+void
+MM_MarkMapClearer::startClearing(MM_EnvironmentBase *env, MM_MarkMap *markMap)
+{
+	omrthread_monitor_enter(_monitor);
+	if (STATE_WAITING != _state) {
+		/* the thread is not running, the next collection clears the whole map */
+		_armed = false;
+		omrthread_monitor_exit(_monitor);
+		return;
+	}
+
+	MM_HeapRegionManager *regionManager = _extensions->getHeap()->getHeapRegionManager();
+	uintptr_t regionCount = 0;
+	MM_HeapRegionDescriptor *region = NULL;
+	GC_HeapRegionIterator countIterator(regionManager);
+	while (NULL != (region = countIterator.nextRegion())) {
+		if (region->isCommitted()) {
+			regionCount += 1;
+		}
+	}
+
+	if (regionCount > _rangeMax) {
+		if (NULL != _ranges) {
+			env->getForge()->free(_ranges);
+		}
+		_ranges = (ClearRange *)env->getForge()->allocate(regionCount * sizeof(ClearRange), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		_rangeMax = (NULL == _ranges) ? 0 : regionCount;
+	}
+
+	if (regionCount <= _rangeMax) {
+		_rangeCount = 0;
+		GC_HeapRegionIterator regionIterator(regionManager);
+		while (NULL != (region = regionIterator.nextRegion())) {
+			if (region->isCommitted()) {
+				ClearRange *range = &_ranges[_rangeCount];
+				markMap->getMarkMapRangeForHeapRange(env, region->getLowAddress(), region->getHighAddress(), &range->base, &range->top);
+				range->current = (uintptr_t)range->base;
+				_rangeCount += 1;
+			}
+		}
+		_nextRange = 0;
+		_bytesClearedConcurrently = 0;
+		_armed = true;
+		_state = STATE_CLEAR_REQUESTED;
+		omrthread_monitor_notify_all(_monitor);
+	} else {
+		/* could not allocate the range table, the next collection clears the whole map */
+		_armed = false;
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_MarkMapClearer::pauseClearing(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	/* the thread may already have been shut down (the heap is torn down after the collector) */
+	while ((STATE_CLEAR_REQUESTED == _state) || (STATE_CLEARING == _state) || (STATE_PAUSE_REQUESTED == _state)) {
+		_state = STATE_PAUSE_REQUESTED;
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_monitor_wait(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_MarkMapClearer::cancelClearing(MM_EnvironmentBase *env)
+{
+	pauseClearing(env);
+	_armed = false;
+}
+
+void
+MM_MarkMapClearer::completeClearing(MM_EnvironmentBase *env)
+{
+	Assert_MM_true(_armed);
+	uintptr_t bytesCleared = 0;
+	uintptr_t *base = NULL;
+	uintptr_t *top = NULL;
+	while (claimChunk(&base, &top)) {
+		MM_HeapMapKernels::fill(base, top, 0);
+		bytesCleared += (uintptr_t)top - (uintptr_t)base;
+	}
+	env->_markStats._markMapBytesClearedInPause += bytesCleared;
+}
@@ -0,0 +1,155 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(MARKMAPCLEARER_HPP_)
+#define MARKMAPCLEARER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrthread.h"
+#include "modronbase.h"
+#include "modronopt.h"
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_MarkMap;
+
+/**
+ * Clears the mark map in the background between global collections.
+ *
+ * At the end of a collection the collector arms the clearer with the committed ranges of the mark map, and a
+ * dedicated thread zeroes them a chunk at a time while the mutators run.  When the next collection starts the
+ * thread is paused and the GC threads clear whatever chunks are left in parallel, instead of the whole map.
+ * Anything that invalidates the ranges (heap resizing, or the scavenger borrowing the mark map) cancels the
+ * clearing, and the next collection falls back to clearing the whole map.
+ * @ingroup GC_Base_Core
+ */
+class MM_MarkMapClearer : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	typedef enum ClearerState {
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_WAITING, /**< Idle, nothing to clear or clearing paused */
+		STATE_CLEAR_REQUESTED, /**< Ranges are armed and the thread should clear them */
+		STATE_CLEARING, /**< The thread is clearing (outside of the monitor) */
+		STATE_PAUSE_REQUESTED, /**< The thread should stop clearing at the end of the current chunk */
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED,
+	} ClearerState;
+
+	typedef struct ClearRange {
+		uintptr_t *base; /**< First mark map word of the range */
+		uintptr_t *top; /**< Mark map word following the range */
+		volatile uintptr_t current; /**< Address of the first word not yet claimed for clearing */
+	} ClearRange;
+
+	MM_GCExtensionsBase *_extensions;
+	omrthread_monitor_t _monitor; /**< Protects _state */
+	volatile ClearerState _state;
+	ClearRange *_ranges; /**< Mark map ranges to clear, one per committed heap region */
+	uintptr_t _rangeCount; /**< Number of entries in use in _ranges */
+	uintptr_t _rangeMax; /**< Number of entries allocated in _ranges */
+	volatile uintptr_t _nextRange; /**< Index of the first range which may still have unclaimed words */
+	bool _armed; /**< True if the ranges describe every word of the mark map that the next collection needs cleared */
+	uintptr_t _bytesClearedConcurrently; /**< Mark map bytes cleared by the background thread since the clearer was last armed */
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Claim the next chunk of mark map words to clear.
+	 * @param base[out] first word of the chunk
+	 * @param top[out] word following the chunk
+	 * @return true if a chunk was claimed, false if there is nothing left to clear
+	 */
+	bool claimChunk(uintptr_t **base, uintptr_t **top);
+
+	void clearerThreadEntryPoint();
+	static uintptr_t clearer_thread_proc2(OMRPortLibrary* portLib, void *info);
+	static int J9THREAD_PROC clearer_thread_proc(void *info);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_MarkMapClearer *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the background thread, waiting until it is ready to accept work.
+	 * @return true on success, false on failure
+	 */
+	bool startup();
+
+	/**
+	 * Stop the background thread, waiting until it has exited.
+	 */
+	void shutdown();
+
+	/**
+	 * Arm the clearer with the committed ranges of the given mark map and wake the background thread.
+	 * Must be called by the master GC thread at the end of a collection, after the mark map is no longer needed.
+	 */
+	void startClearing(MM_EnvironmentBase *env, MM_MarkMap *markMap);
+
+	/**
+	 * Stop the background thread from clearing, waiting until it is idle.  The remaining ranges stay armed.
+	 * Must be called by the master GC thread before a collection uses the mark map.
+	 */
+	void pauseClearing(MM_EnvironmentBase *env);
+
+	/**
+	 * Pause the background thread and disarm the ranges, so the next collection clears the whole mark map.
+	 */
+	void cancelClearing(MM_EnvironmentBase *env);
+
+	/**
+	 * Clear every chunk which the background thread has not yet cleared.  Called by all GC threads participating
+	 * in the mark task after the clearer has been paused; the caller must synchronize the threads afterwards.
+	 */
+	void completeClearing(MM_EnvironmentBase *env);
+
+	/**
+	 * Disarm the clearer once a collection has completed clearing.
+	 */
+	MMINLINE void disarm() { _armed = false; }
+
+	/**
+	 * @return true if the mark map is (or will be, after completeClearing()) fully cleared
+	 */
+	MMINLINE bool isArmed() { return _armed; }
+
+	MMINLINE uintptr_t getBytesClearedConcurrently() { return _bytesClearedConcurrently; }
+
+	MM_MarkMapClearer(MM_EnvironmentBase *env);
+};
+
+#endif /* MARKMAPCLEARER_HPP_ */
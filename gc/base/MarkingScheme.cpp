@@ -27,7 +27,11 @@
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "MarkMap.hpp"
+#include "MarkMapClearer.hpp"
 #include "MarkingScheme.hpp"
+#if defined(OMR_GC_MODRON_COMPACTION)
+#include "SublistFragment.hpp"
+#endif /* OMR_GC_MODRON_COMPACTION */
 #include "Task.hpp"
 #include "WorkPackets.hpp"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -192,8 +196,48 @@ void
 MM_MarkingScheme::workerSetupForGC(MM_EnvironmentBase *env)
 {
 	env->_workStack.reset(env, _workPackets);
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+	if (NULL != _partialCompactAreas) {
+		env->_partialCompactRememberedSet.count = 0;
+		env->_partialCompactRememberedSet.fragmentCurrent = NULL;
+		env->_partialCompactRememberedSet.fragmentTop = NULL;
+		env->_partialCompactRememberedSet.fragmentSize = (uintptr_t)J9_SCV_REMSET_FRAGMENT_SIZE;
+		env->_partialCompactRememberedSet.parentList = _partialCompactRememberedSet;
+	}
+#endif /* OMR_GC_MODRON_COMPACTION */
 }
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+void
+MM_MarkingScheme::setPartialCompactAreas(uint8_t *areas, void *areaBase, uintptr_t areaShift, MM_SublistPool *rememberedSet)
+{
+	_partialCompactAreaBase = (uintptr_t)areaBase;
+	_partialCompactAreaShift = areaShift;
+	_partialCompactRememberedSet = rememberedSet;
+	_partialCompactRememberedSetOverflow = false;
+	_partialCompactAreas = areas;
+}
+
+void
+MM_MarkingScheme::clearPartialCompactAreas()
+{
+	_partialCompactAreas = NULL;
+	_partialCompactRememberedSet = NULL;
+	_partialCompactRememberedSetOverflow = false;
+}
+
+void
+MM_MarkingScheme::rememberObjectForPartialCompact(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	MM_SublistFragment fragment((J9VMGC_SublistFragment *)&env->_partialCompactRememberedSet);
+	if (!fragment.add(env, (uintptr_t)objectPtr)) {
+		/* the remembered set is incomplete, so the compaction will have to fix up the whole heap */
+		_partialCompactRememberedSetOverflow = true;
+	}
+}
+#endif /* OMR_GC_MODRON_COMPACTION */
+
 
 
 /****************************************
@@ -274,14 +318,65 @@ MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
 	omrobjectptr_t objectPtr = NULL;
 	MM_WorkPackets *packets = getWorkPackets();
+	uintptr_t prefetchDistance = OMR_MIN(_extensions->markingPrefetchDistance, MARKING_PREFETCH_DISTANCE_MAX);
 
 	do {
-		while(NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
-			scanObject(env, objectPtr, MM_CollectorLanguageInterface::SCAN_REASON_PACKET);
+		if (0 != prefetchDistance) {
+			completeScanWithPrefetch(env, prefetchDistance);
+		} else {
+			while(NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
+				scanObject(env, objectPtr, MM_CollectorLanguageInterface::SCAN_REASON_PACKET);
+			}
 		}
 	} while (packets->handleWorkPacketOverflow(env));
 }
 
+void
+MM_MarkingScheme::completeScanWithPrefetch(MM_EnvironmentBase *env, uintptr_t prefetchDistance)
+{
+	omrobjectptr_t prefetchFIFO[MARKING_PREFETCH_DISTANCE_MAX];
+	uintptr_t head = 0;
+	uintptr_t count = 0;
+
+	while (true) {
+		omrobjectptr_t objectPtr = NULL;
+
+		/* Top up the FIFO without blocking: a thread holding unscanned objects must not wait for
+		 * work from other threads, or it could take part in termination with work still pending.
+		 */
+		while (count < prefetchDistance) {
+			objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env);
+			if (NULL == objectPtr) {
+				break;
+			}
+			prefetchObject(objectPtr);
+			uintptr_t tail = head + count;
+			if (tail >= prefetchDistance) {
+				tail -= prefetchDistance;
+			}
+			prefetchFIFO[tail] = objectPtr;
+			count += 1;
+		}
+
+		if (0 != count) {
+			objectPtr = prefetchFIFO[head];
+			head += 1;
+			if (head == prefetchDistance) {
+				head = 0;
+			}
+			count -= 1;
+		} else {
+			/* nothing in flight - wait for more work (or for all threads to finish) as the regular scan loop does */
+			objectPtr = (omrobjectptr_t)env->_workStack.pop(env);
+			if (NULL == objectPtr) {
+				break;
+			}
+		}
+
+		scanObject(env, objectPtr, MM_CollectorLanguageInterface::SCAN_REASON_PACKET);
+	}
+}
+
 /****************************************
  * Marking Core Functionality
  ****************************************/
@@ -298,7 +393,12 @@ MM_MarkingScheme::markLiveObjectsInit(MM_EnvironmentBase *env, bool initMarkMap)
 	workerSetupForGC(env);
 
 	if(initMarkMap) {
-		_markMap->initializeMarkMap(env);
+		if ((NULL != _markMapClearer) && _markMapClearer->isArmed()) {
+			/* most of the map was cleared in the background, only finish off what is left */
+			_markMapClearer->completeClearing(env);
+		} else {
+			_markMap->initializeMarkMap(env);
+		}
 		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
 	}
 }
@@ -36,6 +36,13 @@
 #define BITS_PER_BYTE 8
 
 class MM_CollectorLanguageInterface;
+class MM_MarkMapClearer;
+#if defined(OMR_GC_MODRON_COMPACTION)
+class MM_SublistPool;
+#endif /* OMR_GC_MODRON_COMPACTION */
+
+/* Upper bound on MM_GCExtensionsBase::markingPrefetchDistance (size of the on-stack prefetch FIFO) */
+#define MARKING_PREFETCH_DISTANCE_MAX 32
 
 /**
  * @todo Provide class documentation
@@ -51,9 +58,17 @@ protected:
 	MM_GCExtensionsBase *_extensions;
 	MM_CollectorLanguageInterface *_cli;
 	MM_MarkMap *_markMap;
+	MM_MarkMapClearer *_markMapClearer; /**< Background mark map clearer, or NULL if the mark map is cleared at the start of marking */
 	MM_WorkPackets *_workPackets;
 	void *_heapBase;
 	void *_heapTop;
+#if defined(OMR_GC_MODRON_COMPACTION)
+	uint8_t *_partialCompactAreas; /**< non-zero entries flag the heap areas selected for a partial compaction, or NULL if no partial compaction is planned */
+	uintptr_t _partialCompactAreaBase; /**< address of the first area of _partialCompactAreas */
+	uintptr_t _partialCompactAreaShift; /**< log2 of the area size of _partialCompactAreas */
+	MM_SublistPool *_partialCompactRememberedSet; /**< objects outside the selected areas which refer into them */
+	volatile bool _partialCompactRememberedSetOverflow; /**< set if an object could not be added to _partialCompactRememberedSet */
+#endif /* OMR_GC_MODRON_COMPACTION */
 public:
 
 	/*
@@ -70,6 +85,24 @@ private:
 
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
+	/**
+	 * Hint that the header of an object which is about to be scanned should be brought into the cache.
+	 */
+	MMINLINE void
+	prefetchObject(omrobjectptr_t objectPtr)
+	{
+#if defined(__GNUC__)
+		__builtin_prefetch((const void *)objectPtr, 0, 3);
+#endif /* defined(__GNUC__) */
+	}
+
+	/**
+	 * Scan work packets keeping a FIFO of popped but not yet scanned objects, prefetching each object as it enters the FIFO.
+	 * @param[in] env - passed Environment
+	 * @param[in] prefetchDistance - number of objects to keep in flight (at most MARKING_PREFETCH_DISTANCE_MAX)
+	 */
+	void completeScanWithPrefetch(MM_EnvironmentBase *env, uintptr_t prefetchDistance);
+
 protected:
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
@@ -200,6 +233,7 @@ public:
 
 	MMINLINE MM_MarkMap *getMarkMap() { return _markMap; }
 	MMINLINE void setMarkMap(MM_MarkMap *markMap) { _markMap = markMap; }
+	MMINLINE void setMarkMapClearer(MM_MarkMapClearer *markMapClearer) { _markMapClearer = markMapClearer; }
 	
 	bool isMarkedOutline(omrobjectptr_t objectPtr);
 	MMINLINE MM_WorkPackets *getWorkPackets() { return _workPackets; }
@@ -211,6 +245,48 @@ public:
 		return ((_heapBase <= (uint8_t *)objectPtr) && (_heapTop > (uint8_t *)objectPtr));
 	}
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/**
+	 * Have marking record the objects which refer into the given heap areas, so that a partial
+	 * compaction of those areas can fix up its references without walking the rest of the heap.
+	 * @param[in] areas table of flags with one entry per area, non-zero if the area is selected
+	 * @param[in] areaBase address of the first area of the table
+	 * @param[in] areaShift log2 of the area size
+	 * @param[in] rememberedSet the (empty) sublist the referring objects are added to
+	 */
+	void setPartialCompactAreas(uint8_t *areas, void *areaBase, uintptr_t areaShift, MM_SublistPool *rememberedSet);
+	void clearPartialCompactAreas();
+
+	/**
+	 * @return true if marking records a remembered set for a partial compaction
+	 */
+	MMINLINE bool isPartialCompactArmed() { return NULL != _partialCompactAreas; }
+
+	/**
+	 * @return true if an object could not be added to the remembered set, which is then incomplete
+	 */
+	MMINLINE bool hasPartialCompactRememberedSetOverflowed() { return _partialCompactRememberedSetOverflow; }
+
+	/**
+	 * Determine whether the object lies in one of the areas selected for a partial compaction.
+	 * @param[in] objectPtr a heap object
+	 * @return true if the object will be evacuated by the partial compaction
+	 */
+	MMINLINE bool
+	isPartialCompactAreaObject(omrobjectptr_t objectPtr)
+	{
+		return (NULL != _partialCompactAreas) && (0 != _partialCompactAreas[((uintptr_t)objectPtr - _partialCompactAreaBase) >> _partialCompactAreaShift]);
+	}
+
+	/**
+	 * Record an object outside of the selected areas which has a slot referring into them.  Each
+	 * object must be remembered at most once, as its slots are fixed up once per entry.
+	 * @param[in] env the current thread
+	 * @param[in] objectPtr the referring object
+	 */
+	void rememberObjectForPartialCompact(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+#endif /* OMR_GC_MODRON_COMPACTION */
+
 	/**
 	 * Create a MarkingScheme object.
 	 */
@@ -220,9 +296,17 @@ public:
 		, _extensions(env->getExtensions())
 		, _cli(_extensions->collectorLanguageInterface)
 		, _markMap(NULL)
+		, _markMapClearer(NULL)
 		, _workPackets(NULL)
 		, _heapBase(NULL)
 		, _heapTop(NULL)
+#if defined(OMR_GC_MODRON_COMPACTION)
+		, _partialCompactAreas(NULL)
+		, _partialCompactAreaBase(0)
+		, _partialCompactAreaShift(0)
+		, _partialCompactRememberedSet(NULL)
+		, _partialCompactRememberedSetOverflow(false)
+#endif /* OMR_GC_MODRON_COMPACTION */
 	{
 		_typeId = __FUNCTION__;
 	}
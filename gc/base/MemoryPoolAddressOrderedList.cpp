@@ -26,12 +26,15 @@
 #include "MemoryPoolAddressOrderedList.hpp"
 
 #include "AllocateDescription.hpp"
+#include "AllocationStats.hpp"
+#include "AtomicOperations.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Collector.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySubSpace.hpp"
+#include "ObjectAllocationInterface.hpp"
 //#include "mmhook_internal.h"
 #include "HeapRegionDescriptor.hpp"
 #include "LargeObjectAllocateStats.hpp"
@@ -125,6 +128,18 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase *env)
 	}
 	_hintInactive = previousInactiveHint;
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	if (0 != ext->tlhRefillStashSize) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		_tlhRefillStashCount = OMR_MAX(omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE), 1);
+		_tlhRefillStashes = (TLHRefillStash *)ext->getForge()->allocate(sizeof(TLHRefillStash) * _tlhRefillStashCount, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _tlhRefillStashes) {
+			return false;
+		}
+		memset(_tlhRefillStashes, 0, sizeof(TLHRefillStash) * _tlhRefillStashCount);
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+
 	return true;
 }
 
@@ -169,6 +184,13 @@ MM_MemoryPoolAddressOrderedList::tearDown(MM_EnvironmentBase *env)
 	
 	_largeObjectCollectorAllocateStats = NULL;
 
+	if (NULL != _tlhRefillStashes) {
+		env->getForge()->free(_tlhRefillStashes);
+		_tlhRefillStashes = NULL;
+	}
+
+	_sizeIndex.tearDown(env);
+
 	_heapLock.tearDown();
 	_resetLock.tearDown();
 }
@@ -410,11 +432,26 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 	J9ModronAllocateHint *allocateHintUsed;
 	void *addrBase;
 	uintptr_t largestFreeEntry = 0;
+	uintptr_t sizeIndexEntry = 0;
 	
 	if (lockingRequired) {
 		_heapLock.acquire();
 	}
 
+	if (_sizeIndex.isValid()) {
+		/* The index finds the same entry as the walk below, and the entry before it */
+		if (!_sizeIndex.findFirstFit(sizeInBytesRequired, &sizeIndexEntry)) {
+			largestFreeEntry = _sizeIndex.getLargestSize();
+			goto fail_allocate;
+		}
+		currentFreeEntry = _sizeIndex.getEntry(sizeIndexEntry);
+		previousFreeEntry = _sizeIndex.getPreviousEntry(sizeIndexEntry);
+		Assert_MM_true((NULL == previousFreeEntry) ? (_heapFreeList == currentFreeEntry) : (previousFreeEntry->getNext() == currentFreeEntry));
+		walkCount = 0;
+		allocateHintUsed = NULL;
+		goto found_entry;
+	}
+
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 retry:
 #endif /* OMR_GC_CONCURRENT_SWEEP */
@@ -464,11 +501,13 @@ retry:
 		goto fail_allocate;
 	}
 
-	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
 	if((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed)) {
 		addHint(previousFreeEntry, candidateHintSize);
 	}
 
+found_entry:
+	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
+
 	/* Adjust the free memory size */
 	_freeMemorySize -= sizeInBytesRequired;
 
@@ -485,6 +524,9 @@ retry:
 
 	if (recycleHeapChunk(recycleEntry, ((uint8_t *)recycleEntry) + recycleEntrySize, previousFreeEntry, currentFreeEntry->getNext())) {
 		updateHint(currentFreeEntry, recycleEntry);
+		if (_sizeIndex.isValid()) {
+			_sizeIndex.update(sizeIndexEntry, recycleEntry, recycleEntrySize);
+		}
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 	} else {
 		/* Adjust the free memory size and count */
@@ -496,6 +538,9 @@ retry:
 
 		/* Removed from the free list - Kill the hint if necessary */
 		removeHint(currentFreeEntry);
+		if (_sizeIndex.isValid()) {
+			_sizeIndex.remove(sizeIndexEntry);
+		}
 	}
 	
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */	
@@ -562,6 +607,7 @@ MM_MemoryPoolAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase *env, ui
 	MM_HeapLinkedFreeHeader *freeEntry = NULL;
 	uintptr_t consumedSize = 0;
 	uintptr_t recycleEntrySize = 0;
+	uintptr_t sizeIndexEntry = 0;
 	
 	if (lockingRequired) {
 		_heapLock.acquire();
@@ -587,6 +633,12 @@ retry:
 	}
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+	if (_sizeIndex.isValid()) {
+		/* The head of the list is the lowest addressed entry left in the index */
+		bool indexed = _sizeIndex.findFirstFit(1, &sizeIndexEntry);
+		Assert_MM_true(indexed && (_sizeIndex.getEntry(sizeIndexEntry) == freeEntry));
+	}
+
 	/* Consume the bytes and set the return pointer values */
 	freeEntrySize = freeEntry->getSize();
 	Assert_MM_true(freeEntrySize >= _minimumFreeEntrySize);
@@ -618,6 +670,9 @@ retry:
 		topOfRecycledChunk = ((uint8_t *)addrTop) + recycleEntrySize;
 		/* Recycle the remaining entry back onto the free list (if applicable) */
 		if (recycleHeapChunk(addrTop, topOfRecycledChunk, NULL, entryNext)) {
+			if (_sizeIndex.isValid()) {
+				_sizeIndex.update(sizeIndexEntry, (MM_HeapLinkedFreeHeader *)addrTop, recycleEntrySize);
+			}
 			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 		} else {
 			/* Adjust the free memory size and count */
@@ -625,12 +680,18 @@ retry:
 			_freeEntryCount -= 1;
 
 			_allocDiscardedBytes += recycleEntrySize;
+			if (_sizeIndex.isValid()) {
+				_sizeIndex.remove(sizeIndexEntry);
+			}
 		}
 	} else {
 		/* If not recycling just update the free list pointer to the next free entry */
 		_heapFreeList = entryNext;
 		/* also update the freeEntryCount as recycleHeapChunk would do this */
 		_freeEntryCount -= 1;
+		if (_sizeIndex.isValid()) {
+			_sizeIndex.remove(sizeIndexEntry);
+		}
 	}
 
 	if (lockingRequired) {
@@ -648,13 +709,104 @@ fail_allocate:
 	return false;
 }
 
+MMINLINE MM_HeapLinkedFreeHeader *
+MM_MemoryPoolAddressOrderedList::popTLHRefillStash(TLHRefillStash *stash)
+{
+	MM_HeapLinkedFreeHeader *chunk = stash->_head;
+	while (NULL != chunk) {
+		MM_HeapLinkedFreeHeader *next = chunk->getNext();
+		MM_HeapLinkedFreeHeader *found = (MM_HeapLinkedFreeHeader *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&stash->_head, (uintptr_t)chunk, (uintptr_t)next);
+		if (found == chunk) {
+			break;
+		}
+		chunk = found;
+	}
+	return chunk;
+}
+
+bool
+MM_MemoryPoolAddressOrderedList::allocateTLHFromStash(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
+{
+	MM_AllocationStats *stats = env->_objectAllocationInterface->getAllocationStats();
+	TLHRefillStash *stash = &_tlhRefillStashes[env->getEnvironmentId() % _tlhRefillStashCount];
+
+	MM_HeapLinkedFreeHeader *chunk = popTLHRefillStash(stash);
+	if (NULL != chunk) {
+		addrBase = (void *)chunk;
+		addrTop = (void *)chunk->afterEnd();
+		stats->_tlhStashRefreshCount += 1;
+		return true;
+	}
+
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t startTime = omrtime_hires_clock();
+	bool result = false;
+
+	if (!_heapLock.tryAcquire()) {
+		stats->_tlhLockContendedCount += 1;
+		_heapLock.acquire();
+	}
+
+	/* another thread on this CPU may have refilled the stash while we waited for the lock */
+	chunk = popTLHRefillStash(stash);
+	if (NULL != chunk) {
+		addrBase = (void *)chunk;
+		addrTop = (void *)chunk->afterEnd();
+		result = true;
+	} else if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, false, _largeObjectAllocateStats)) {
+		result = true;
+
+		/* carve the next TLHs for this CPU while the lock is held, keeping them walkable as free chunks */
+		MM_HeapLinkedFreeHeader *first = NULL;
+		MM_HeapLinkedFreeHeader *last = NULL;
+		for (uintptr_t i = 0; i < _extensions->tlhRefillStashSize; i++) {
+			void *chunkBase = NULL;
+			void *chunkTop = NULL;
+			if (!internalAllocateTLH(env, maximumSizeInBytesRequired, chunkBase, chunkTop, false, _largeObjectAllocateStats)) {
+				break;
+			}
+			if (internalRecycleHeapChunk(chunkBase, chunkTop, NULL)) {
+				if (NULL == last) {
+					first = (MM_HeapLinkedFreeHeader *)chunkBase;
+				} else {
+					last->setNext((MM_HeapLinkedFreeHeader *)chunkBase);
+				}
+				last = (MM_HeapLinkedFreeHeader *)chunkBase;
+			}
+		}
+
+		if (NULL != first) {
+			/* other threads may still be popping, so push the chunks ahead of whatever is left */
+			MM_HeapLinkedFreeHeader *head = NULL;
+			do {
+				head = stash->_head;
+				last->setNext(head);
+			} while ((uintptr_t)head != MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&stash->_head, (uintptr_t)head, (uintptr_t)first));
+		}
+	}
+
+	_heapLock.release();
+
+	stats->_tlhLockedRefreshCount += 1;
+	stats->_tlhLockedRefreshTime += omrtime_hires_clock() - startTime;
+
+	return result;
+}
+
 void *
 MM_MemoryPoolAddressOrderedList::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription,
 											uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
 {
 	void *tlhBase = NULL;
+	bool allocated = false;
+
+	if (NULL != _tlhRefillStashes) {
+		allocated = allocateTLHFromStash(env, maximumSizeInBytesRequired, addrBase, addrTop);
+	} else {
+		allocated = internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, true, _largeObjectAllocateStats);
+	}
 
-	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, true, _largeObjectAllocateStats)) {
+	if (allocated) {
 		tlhBase = addrBase;
 	}
 
@@ -700,12 +852,34 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	MM_MemoryPool::reset(cause);
 
 	clearHints();
+	_sizeIndex.invalidate();
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
 
+	/* chunks left in the TLH refill stashes are about to be rebuilt into the free list */
+	if (NULL != _tlhRefillStashes) {
+		for (uintptr_t i = 0; i < _tlhRefillStashCount; i++) {
+			_tlhRefillStashes[i]._head = NULL;
+		}
+	}
+
 	resetFreeEntryAllocateStats(_largeObjectAllocateStats);
 	resetLargeObjectAllocateStats();
 }
 
+void
+MM_MemoryPoolAddressOrderedList::postProcess(MM_EnvironmentBase *env, Cause cause)
+{
+	/* The free list is complete after a sweep or compaction, index it for the allocations up to the next collection */
+	bool buildIndex = _extensions->freeListSizeIndex;
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	/* a concurrent sweep hands the list over to the mutators before it is complete */
+	buildIndex = buildIndex && !_extensions->concurrentSweep;
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+	if (buildIndex) {
+		_sizeIndex.rebuild(env, _heapFreeList);
+	}
+}
+
 /**
  * As opposed to reset, which will empty out, this will fill out as if everything is free.
  * Returns the freelist entry created at the end of the given region
@@ -778,6 +952,20 @@ MM_MemoryPoolAddressOrderedList::isValidListOrdering()
  */
 void
 MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintptr_t expandSize, void *lowAddress, void *highAddress, bool canCoalesce)
+{
+	/* The heap is resized right after a collection, keep the index rather than lose it until the next one */
+	bool rebuildSizeIndex = _sizeIndex.isValid();
+	_sizeIndex.invalidate();
+
+	internalExpandWithRange(env, expandSize, lowAddress, highAddress, canCoalesce);
+
+	if (rebuildSizeIndex) {
+		_sizeIndex.rebuild(env, _heapFreeList);
+	}
+}
+
+void
+MM_MemoryPoolAddressOrderedList::internalExpandWithRange(MM_EnvironmentBase *env, uintptr_t expandSize, void *lowAddress, void *highAddress, bool canCoalesce)
 {
 	MM_HeapLinkedFreeHeader *previousFreeEntry, *nextFreeEntry;
 
@@ -892,6 +1080,9 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 		return NULL;
 	}
 
+	bool rebuildSizeIndex = _sizeIndex.isValid();
+	_sizeIndex.invalidate();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	previousFreeEntry = NULL;
@@ -958,6 +1149,10 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 	_freeMemorySize -= totalContractSize;
 	_freeEntryCount -= contractCount;
 
+	if (rebuildSizeIndex) {
+		_sizeIndex.rebuild(env, _heapFreeList);
+	}
+
 	assume0(isMemoryPoolValid(env, true));
 	
 	return lowAddress;
@@ -977,6 +1172,8 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 {
 	uintptr_t localFreeListMemoryCount = freeListMemoryCount;
 
+	_sizeIndex.invalidate();
+
 	MM_HeapLinkedFreeHeader *currentFreeEntry = freeListHead;
 
 	while (currentFreeEntry != NULL) {
@@ -1076,6 +1273,8 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
+	_sizeIndex.invalidate();
+
 	/* Find the first free entry, if any, within specified range */
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
@@ -1430,6 +1629,8 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 {
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	_sizeIndex.invalidate();
+
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1479,6 +1680,9 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(void* chunkBase, void* chunkTo
 
 	_heapLock.acquire();
 
+	/* an insertion shifts the entries after it, so the index can not be updated in place */
+	_sizeIndex.invalidate();
+
 	if ((NULL == _heapFreeList) || (chunkBase < (void*)_heapFreeList)) {
 		/* Add to front of freelist */
 		recycled = recycleHeapChunk(chunkBase, chunkTop, NULL, _heapFreeList);
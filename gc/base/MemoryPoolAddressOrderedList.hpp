@@ -23,6 +23,7 @@
 #include "omrcomp.h"
 #include "modronopt.h"
 
+#include "FreeEntrySizeIndex.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "LightweightNonReentrantLock.hpp"
 #include "MemoryPoolAddressOrderedListBase.hpp"
@@ -56,6 +57,16 @@ private:
 	
 	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats;  /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
 
+	/* TLH refill stash support */
+	struct TLHRefillStash {
+		MM_HeapLinkedFreeHeader * volatile _head; /**< First free chunk carved ahead for this stash, the chunks are linked through their free headers */
+		uintptr_t _padding[7]; /**< Keeps each stash on its own cache line */
+	};
+	TLHRefillStash *_tlhRefillStashes; /**< Per-CPU stashes of TLH sized free chunks (NULL if tlhRefillStashSize is 0) */
+	uintptr_t _tlhRefillStashCount; /**< Number of entries in _tlhRefillStashes */
+
+	MM_FreeEntrySizeIndex _sizeIndex; /**< Size index of the free list, valid from a sweep or compaction until the list is changed other than by allocation (only built if freeListSizeIndex is set) */
+
 protected:
 public:
 	
@@ -73,6 +84,21 @@ private:
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 
 	bool recycleHeapChunk(void *addrBase, void *addrTop, MM_HeapLinkedFreeHeader *previousFreeEntry, MM_HeapLinkedFreeHeader *nextFreeEntry);	
+	void internalExpandWithRange(MM_EnvironmentBase *env, uintptr_t expandSize, void *lowAddress, void *highAddress, bool canCoalesce);
+
+	/**
+	 * Pop a free chunk from a TLH refill stash without locking.
+	 * Chunks only return to the pool when it is reset for a collection, which cannot happen while a mutator is
+	 * allocating, so a chunk address cannot reappear at the head of a stash during a pop.
+	 * @return the chunk, or NULL if the stash is empty
+	 */
+	MMINLINE MM_HeapLinkedFreeHeader *popTLHRefillStash(TLHRefillStash *stash);
+
+	/**
+	 * Allocate a TLH for a mutator from the per-CPU stash of the calling thread, locking the pool only if
+	 * the stash is empty.  The locked path carves tlhRefillStashSize more chunks into the stash.
+	 */
+	bool allocateTLHFromStash(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop);
 	
 protected:
 public:
@@ -91,6 +117,7 @@ public:
 	virtual void tearDown(MM_EnvironmentBase *env);
 
 	virtual void reset(Cause cause = any);
+	virtual void postProcess(MM_EnvironmentBase *env, Cause cause);
 	virtual MM_HeapLinkedFreeHeader *rebuildFreeListInRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, MM_HeapLinkedFreeHeader *previousFreeEntry);
 
 #if defined(DEBUG)
@@ -145,6 +172,8 @@ public:
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize)
 		,_heapFreeList(NULL)
 		,_largeObjectCollectorAllocateStats(NULL)
+		,_tlhRefillStashes(NULL)
+		,_tlhRefillStashCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -153,6 +182,8 @@ public:
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
 		,_heapFreeList(NULL)
 		,_largeObjectCollectorAllocateStats(NULL)
+		,_tlhRefillStashes(NULL)
+		,_tlhRefillStashCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -31,6 +31,9 @@
 class MM_EnvironmentBase;
 struct J9MemoryNodeDetail;
 
+/* Size of the heap stripes spread round robin across the NUMA nodes when GC work is NUMA aware */
+#define NUMA_GC_WORK_STRIPE_SIZE ((uintptr_t)1024 * 1024)
+
 class MM_NUMAManager
 {
 	/* Data Members */
@@ -96,6 +99,39 @@ public:
 	 */
 	uintptr_t getAffinityLeaderCount() const;
 
+	/**
+	 * Answer the affinity leader a GC thread is associated with when GC work is distributed by NUMA node (see MM_GCExtensionsBase::numaAwareGCWork).
+	 * GC threads are spread round robin across the affinity leaders.
+	 * @param slaveID[in] The slave ID of the GC thread
+	 * @return The index of the affinity leader, where 1 is the first node (0 if NUMA is not enabled)
+	 */
+	uintptr_t getAffinityLeaderForGCThread(uintptr_t slaveID) const {
+		uintptr_t numaNodeID = 0;
+
+		if (0 != _affinityLeaderCount) {
+			numaNodeID = (slaveID % _affinityLeaderCount) + 1;
+		}
+
+		return numaNodeID;
+	}
+
+	/**
+	 * Answer the affinity leader whose node backs the heap memory at the given offset when GC work is distributed by NUMA node
+	 * (see MM_GCExtensionsBase::numaAwareGCWork).  The heap is bound to the affinity leaders round robin in stripes of
+	 * NUMA_GC_WORK_STRIPE_SIZE bytes, unless a sub arena is bound to a node of its own.
+	 * @param heapOffset[in] The offset of the memory from the heap base
+	 * @return The index of the affinity leader, where 1 is the first node (0 if NUMA is not enabled)
+	 */
+	uintptr_t getAffinityLeaderForHeapOffset(uintptr_t heapOffset) const {
+		uintptr_t numaNodeID = 0;
+
+		if (0 != _affinityLeaderCount) {
+			numaNodeID = ((heapOffset / NUMA_GC_WORK_STRIPE_SIZE) % _affinityLeaderCount) + 1;
+		}
+
+		return numaNodeID;
+	}
+
 	/**
 	 * @return The highest j9NodeNumber of all NUMA nodes currently known to the receiver or 0 if NUMA is not enabled or available
 	 */
@@ -0,0 +1,51 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omr.h"
+
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "PacketDeque.hpp"
+
+bool
+MM_PacketDeque::initialize(MM_EnvironmentBase *env, uintptr_t capacity)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	/* round up to a power of two so that indices can be masked */
+	_capacity = (uintptr_t)1 << MM_Math::floorLog2(OMR_MAX(capacity, 2));
+	if (_capacity < capacity) {
+		_capacity <<= 1;
+	}
+	_mask = _capacity - 1;
+	_top = 0;
+	_bottom = 0;
+
+	_slots = (MM_Packet **)extensions->getForge()->allocate(sizeof(MM_Packet *) * _capacity, MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+
+	return NULL != _slots;
+}
+
+void
+MM_PacketDeque::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _slots) {
+		env->getExtensions()->getForge()->free(_slots);
+		_slots = NULL;
+	}
+}
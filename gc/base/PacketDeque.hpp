@@ -0,0 +1,172 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(PACKETDEQUE_HPP_)
+#define PACKETDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "Packet.hpp"
+
+/**
+ * A bounded, lock-free work stealing deque of packets (Chase-Lev).
+ * The owning GC thread pushes and pops at the bottom without any atomic read-modify-write
+ * (except when racing for the last entry), other GC threads steal from the top with a single
+ * compare and swap.  The deque never grows: when it is full the owner must fall back to the
+ * shared packet lists.
+ * @ingroup GC_Base
+ */
+class MM_PacketDeque : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_Packet **_slots; /**< Circular buffer of packets, _capacity entries long */
+	uintptr_t _capacity; /**< Number of slots in the buffer (power of two) */
+	uintptr_t _mask; /**< _capacity - 1 */
+	volatile intptr_t _top; /**< Index of the next entry to be stolen (only ever incremented) */
+	volatile intptr_t _bottom; /**< Index of the next free slot (owned by the owning thread) */
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t capacity);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Push a packet on the bottom of the deque.  Must only be called by the owning thread.
+	 * @param packet[in] the packet to push
+	 * @return true if the packet was pushed, false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_Packet *packet)
+	{
+		intptr_t bottom = _bottom;
+		intptr_t top = _top;
+
+		if ((bottom - top) >= (intptr_t)_capacity) {
+			return false;
+		}
+
+		_slots[(uintptr_t)bottom & _mask] = packet;
+		/* the packet must be visible before thieves can observe the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+
+		return true;
+	}
+
+	/**
+	 * Pop a packet from the bottom of the deque.  Must only be called by the owning thread.
+	 * @return a packet, or NULL if the deque is empty (or the last packet was stolen)
+	 */
+	MMINLINE MM_Packet *
+	pop()
+	{
+		intptr_t bottom = _bottom - 1;
+		MM_Packet *packet = NULL;
+
+		_bottom = bottom;
+		/* the store to bottom must be globally visible before we read top */
+		MM_AtomicOperations::readWriteBarrier();
+		intptr_t top = _top;
+
+		if (top <= bottom) {
+			packet = _slots[(uintptr_t)bottom & _mask];
+			if (top == bottom) {
+				/* last entry - race any thieves for it */
+				if ((uintptr_t)top != MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_top, (uintptr_t)top, (uintptr_t)(top + 1))) {
+					packet = NULL;
+				}
+				_bottom = bottom + 1;
+			}
+		} else {
+			/* deque was empty */
+			_bottom = bottom + 1;
+		}
+
+		return packet;
+	}
+
+	/**
+	 * Attempt to steal a packet from the top of the deque.  May be called by any thread.
+	 * @return a packet, or NULL if the deque was empty or another thread won the race
+	 */
+	MMINLINE MM_Packet *
+	steal()
+	{
+		intptr_t top = _top;
+		/* top must be read before bottom */
+		MM_AtomicOperations::readWriteBarrier();
+		intptr_t bottom = _bottom;
+		MM_Packet *packet = NULL;
+
+		if (top < bottom) {
+			packet = _slots[(uintptr_t)top & _mask];
+			if ((uintptr_t)top != MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_top, (uintptr_t)top, (uintptr_t)(top + 1))) {
+				packet = NULL;
+			}
+		}
+
+		return packet;
+	}
+
+	/**
+	 * Answer an approximation of the number of packets in the deque.  The value is only exact when
+	 * no other thread is operating on the deque.
+	 */
+	MMINLINE uintptr_t
+	getCount()
+	{
+		intptr_t size = _bottom - _top;
+		return (0 < size) ? (uintptr_t)size : 0;
+	}
+
+	MMINLINE bool isEmpty() { return 0 == getCount(); }
+
+	/**
+	 * Create a PacketDeque object.
+	 */
+	MM_PacketDeque()
+		: MM_BaseNonVirtual()
+		, _slots(NULL)
+		, _capacity(0)
+		, _mask(0)
+		, _top(0)
+		, _bottom(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* PACKETDEQUE_HPP_ */
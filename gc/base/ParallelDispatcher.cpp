@@ -27,6 +27,7 @@
 #include "ModronAssertions.h"
 #include "ut_j9mm.h"
 
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterfaceImpl.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -148,6 +149,8 @@ void
 MM_ParallelDispatcher::slaveEntryPoint(MM_EnvironmentBase *env) 
 {
 	uintptr_t slaveID = env->getSlaveID();
+
+	bindThreadToNumaNode(env);
 	
 	setThreadInitializationComplete(env);
 	
@@ -155,6 +158,7 @@ MM_ParallelDispatcher::slaveEntryPoint(MM_EnvironmentBase *env)
 
 	while(slave_status_dying != _statusTable[slaveID]) {
 		/* Wait for a task to be dispatched to the slave thread */
+		spinUntilTaskDispatched(env);
 		while(slave_status_waiting == _statusTable[slaveID]) {
 			omrthread_monitor_wait(_slaveThreadMutex);
 		}
@@ -174,6 +178,29 @@ MM_ParallelDispatcher::slaveEntryPoint(MM_EnvironmentBase *env)
 	omrthread_monitor_exit(_slaveThreadMutex);	
 }
 
+/**
+ * Spin with the _slaveThreadMutex released, yielding the CPU between checks, while the slave thread is waiting for a
+ * task.  Tasks are often dispatched back to back (e.g. mark then sweep), and a slave thread which picks up the next
+ * task while spinning does not pay for a monitor wait and notify.  Gives up after gcThreadSpinCount checks, leaving
+ * the caller to wait on the monitor.
+ * @note Must be called with the _slaveThreadMutex entered, and returns with it entered.
+ */
+void
+MM_ParallelDispatcher::spinUntilTaskDispatched(MM_EnvironmentBase *env)
+{
+	uintptr_t slaveID = env->getSlaveID();
+	uintptr_t spinCount = _extensions->gcThreadSpinCount;
+
+	if ((slave_status_waiting == _statusTable[slaveID]) && (0 != spinCount)) {
+		omrthread_monitor_exit(_slaveThreadMutex);
+		while ((slave_status_waiting == *(volatile uintptr_t *)&_statusTable[slaveID]) && (0 != spinCount)) {
+			MM_AtomicOperations::yieldCPU();
+			spinCount -= 1;
+		}
+		omrthread_monitor_enter(_slaveThreadMutex);
+	}
+}
+
 void
 MM_ParallelDispatcher::masterEntryPoint(MM_EnvironmentBase *env)
 {
@@ -402,6 +429,18 @@ MM_ParallelDispatcher::recomputeActiveThreadCount(MM_EnvironmentBase *env)
 	_activeThreadCount = adjustThreadCount(_threadCount);
 }
 
+void
+MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task)
+{
+	if (_extensions->adaptiveGCThreading) {
+		/* Small collections are completed sooner by fewer threads than by paying to wake and synchronize all of them */
+		uintptr_t recommendedThreads = OMR_MAX(1, task->getRecommendedWorkingThreads());
+		if (recommendedThreads < _activeThreadCount) {
+			_activeThreadCount = recommendedThreads;
+		}
+	}
+}
+
 uintptr_t 
 MM_ParallelDispatcher::adjustThreadCount(uintptr_t maxThreadCount)
 {
@@ -448,6 +487,7 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 		 * a GC cycle. It may not be safe to do so at the beginning of a task
 		 */	
 		recomputeActiveThreadCount(env);
+		recomputeActiveThreadCountForTask(env, task);
 	}
 
 	task->setThreadCount(_activeThreadCount);
@@ -525,6 +565,20 @@ MM_ParallelDispatcher::setThreadInitializationComplete(MM_EnvironmentBase *env)
 	omrthread_monitor_exit(_dispatcherMonitor);
 }
 
+void
+MM_ParallelDispatcher::bindThreadToNumaNode(MM_EnvironmentBase *env)
+{
+	if (_extensions->numaAwareGCWork) {
+		MM_NUMAManager *numaManager = &_extensions->_numaManager;
+		uintptr_t j9NodeNumber = numaManager->getJ9NodeNumber(numaManager->getAffinityLeaderForGCThread(env->getSlaveID()));
+
+		/* simulated NUMA has no physical node to bind to, but work is still distributed by logical node */
+		if (0 != j9NodeNumber) {
+			env->setNumaAffinity(&j9NodeNumber, 1);
+		}
+	}
+}
+
 void
 MM_ParallelDispatcher::reinitAfterFork(MM_EnvironmentBase *env, uintptr_t newThreadCount)
 {
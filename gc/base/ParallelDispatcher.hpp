@@ -85,6 +85,7 @@ public:
 private:
 protected:
 	virtual void slaveEntryPoint(MM_EnvironmentBase *env);
+	void spinUntilTaskDispatched(MM_EnvironmentBase *env);
 	virtual void masterEntryPoint(MM_EnvironmentBase *env);
 
 	bool initialize(MM_EnvironmentBase *env);
@@ -105,8 +106,22 @@ protected:
 	virtual void wakeUpThreads(uintptr_t count);
 
 	virtual void recomputeActiveThreadCount(MM_EnvironmentBase *env);
+
+	/**
+	 * Reduce the active thread count to the thread count the task recommends, when adaptive GC threading is enabled
+	 * (see MM_GCExtensionsBase::adaptiveGCThreading).
+	 * @param env[in] The master thread
+	 * @param task[in] The task about to be dispatched
+	 */
+	void recomputeActiveThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task);
 	
 	virtual void setThreadInitializationComplete(MM_EnvironmentBase *env);
+
+	/**
+	 * Bind a slave thread to the NUMA node it is expected to work on (see MM_GCExtensionsBase::numaAwareGCWork).
+	 * @param env[in] The slave thread
+	 */
+	void bindThreadToNumaNode(MM_EnvironmentBase *env);
 	
 	uintptr_t adjustThreadCount(uintptr_t maxThreadCount);
 	
@@ -44,7 +44,13 @@ MM_ParallelMarkTask::run(MM_EnvironmentBase *env)
 	env->_workStack.prepareForWork(env, (MM_WorkPackets *)(_markingScheme->getWorkPackets()));
 
 	_markingScheme->markLiveObjectsInit(env, _initMarkMap);
+
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t rootScanStartTime = omrtime_hires_clock();
 	_markingScheme->markLiveObjectsRoots(env);
+	if (env->isMasterThread()) {
+		env->getExtensions()->pauseTimeStats.recordPause(env, OMR_GC_PAUSE_TYPE_ROOT_SCAN, rootScanStartTime, omrtime_hires_clock());
+	}
 	_markingScheme->markLiveObjectsScan(env);
 	_markingScheme->markLiveObjectsComplete(env);
 
@@ -58,6 +64,7 @@ MM_ParallelMarkTask::setup(MM_EnvironmentBase *env)
 	
 	env->_markStats.clear();
 	env->_workPacketStats.clear();
+	env->_rootScannerStats.clear();
 
 	env->_envLanguageInterface->parallelMarkTask_setup(env);
 
@@ -83,6 +90,7 @@ MM_ParallelMarkTask::cleanup(MM_EnvironmentBase *env)
 
 	extensions->globalGCStats.markStats.merge(&env->_markStats);
 	extensions->globalGCStats.workPacketStats.merge(&env->_workPacketStats);
+	extensions->globalGCStats.rootScannerStats.merge(&env->_rootScannerStats);
 	if (env->isMasterThread()) {
 		Assert_MM_true(_cycleState == env->_cycleState);
 	} else {
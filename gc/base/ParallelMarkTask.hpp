@@ -44,6 +44,7 @@ private:
 	MM_MarkingScheme *_markingScheme;
 	const bool _initMarkMap;
 	MM_CycleState *_cycleState;  /**< Collection cycle state active for the task */
+	uintptr_t _recommendedThreads; /**< thread count recommended by the collector, UDATA_MAX for none */
 	
 public:
 	virtual uintptr_t getVMStateID();
@@ -51,6 +52,11 @@ public:
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
 	virtual void cleanup(MM_EnvironmentBase *env);
+
+	/**
+	 * @see MM_Task::getRecommendedWorkingThreads()
+	 */
+	virtual uintptr_t getRecommendedWorkingThreads() { return _recommendedThreads; }
 	
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id);
@@ -65,11 +71,13 @@ public:
 			MM_Dispatcher *dispatcher, 
 			MM_MarkingScheme *markingScheme, 
 			bool initMarkMap,
-			MM_CycleState *cycleState) :
+			MM_CycleState *cycleState,
+			uintptr_t recommendedThreads = UDATA_MAX) :
 		MM_ParallelTask(env, dispatcher)
 		,_markingScheme(markingScheme)
 		,_initMarkMap(initMarkMap)
 		,_cycleState(cycleState)
+		,_recommendedThreads(recommendedThreads)
 	{
 		_typeId = __FUNCTION__;
 	};
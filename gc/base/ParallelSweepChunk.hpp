@@ -68,6 +68,8 @@ public:
 	MM_HeapLinkedFreeHeader *_previousLargestFreeEntry; /**< previous free entry of the Largest Free Entry */
 	MM_ParallelSweepChunk *_previous;  /**< previous heap address ordered chunk */
 	MM_ParallelSweepChunk *_next;  /**< next heap address ordered chunk */
+	uintptr_t _numaNode; /**< NUMA node backing the chunk's memory, where 1 is the first node (0 if the memory has no node affinity) */
+	volatile uintptr_t _sweepClaimed; /**< Non-zero once a GC thread has claimed the chunk for sweeping (NUMA aware sweep only) */
 
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	MM_ParallelSweepChunk *_nextChunk;
@@ -136,6 +138,8 @@ public:
 		_previousLargestFreeEntry(NULL),
 		_previous(NULL),
 		_next(NULL),
+		_numaNode(0),
+		_sweepClaimed(0),
 		_splitCandidate(NULL),
 		_splitCandidatePreviousEntry(NULL),
 		_accumulatedFreeSize(0),
@@ -95,9 +95,10 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 		} else {
 			volatile uintptr_t index = _synchronizeIndex;
 
-			do {
+			spinUntilSynchronized(env, index, false);
+			while(index == _synchronizeIndex) {
 				omrthread_monitor_wait(_synchronizeMutex);
-			} while(index == _synchronizeIndex);
+			}
 		}
 		omrthread_monitor_exit(_synchronizeMutex);
 
@@ -139,6 +140,8 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMaster(MM_EnvironmentBase *env, c
 				goto done;
 			}
 			omrthread_monitor_notify_all(_synchronizeMutex);
+		} else {
+			spinUntilSynchronized(env, index, env->isMasterThread());
 		}
 
 		while(index == _synchronizeIndex) {
@@ -194,9 +197,10 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 			goto done;
 		}
 
-		do {
+		spinUntilSynchronized(env, index, false);
+		while(index == _synchronizeIndex) {
 			omrthread_monitor_wait(_synchronizeMutex);
-		} while(index == _synchronizeIndex);
+		}
 		omrthread_monitor_exit(_synchronizeMutex);
 	} else {
 		_synchronized = true;
@@ -226,6 +230,22 @@ MM_ParallelTask::releaseSynchronizedGCThreads(MM_EnvironmentBase *env)
 	omrthread_monitor_exit(_synchronizeMutex);
 }
 
+void
+MM_ParallelTask::spinUntilSynchronized(MM_EnvironmentBase *env, uintptr_t index, bool waitForAllThreads)
+{
+	uintptr_t spinCount = env->getExtensions()->gcThreadSpinCount;
+
+	if (0 != spinCount) {
+		/* The releasing thread needs the monitor, and a thread released while spinning has no need to be notified */
+		omrthread_monitor_exit(_synchronizeMutex);
+		while ((index == _synchronizeIndex) && !(waitForAllThreads && (_synchronizeCount == _threadCount)) && (0 != spinCount)) {
+			MM_AtomicOperations::yieldCPU();
+			spinCount -= 1;
+		}
+		omrthread_monitor_enter(_synchronizeMutex);
+	}
+}
+
 void
 MM_ParallelTask::complete(MM_EnvironmentBase *env)
 {
@@ -267,6 +287,15 @@ MM_ParallelTask::complete(MM_EnvironmentBase *env)
 	
 		if(env->isMasterThread()) {
 			/* Synchronization on exit - cannot delete the task object until all threads are done with it */
+			uintptr_t spinCount = env->getExtensions()->gcThreadSpinCount;
+			if ((0 != _threadCount) && (0 != spinCount)) {
+				omrthread_monitor_exit(_synchronizeMutex);
+				while ((0 != _threadCount) && (0 != spinCount)) {
+					MM_AtomicOperations::yieldCPU();
+					spinCount -= 1;
+				}
+				omrthread_monitor_enter(_synchronizeMutex);
+			}
 			while(0 != _threadCount) {
 				omrthread_monitor_wait(_synchronizeMutex);
 			}
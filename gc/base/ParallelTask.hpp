@@ -60,6 +60,17 @@ public:
 	/*
 	 * Function members
 	 */
+protected:
+	/**
+	 * Spin with the synchronize mutex released, yielding the CPU between checks, until the threads waiting at the
+	 * synchronization point are released or, when waitForAllThreads is true, until all the threads have reached it.
+	 * Gives up after gcThreadSpinCount checks, leaving the caller to wait on the mutex.
+	 * @note Must be called with the synchronize mutex entered, and returns with it entered.
+	 * @param[in] index the _synchronizeIndex of the synchronization point
+	 * @param[in] waitForAllThreads true if the caller is the master waiting for the other threads to arrive
+	 */
+	void spinUntilSynchronized(MM_EnvironmentBase *env, uintptr_t index, bool waitForAllThreads);
+
 public:
 	virtual bool handleNextWorkUnit(MM_EnvironmentBase *env);
 	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id);
@@ -23,6 +23,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
 #include "HeapVirtualMemory.hpp"
 #include "MemoryManager.hpp"
 #include "MemorySpace.hpp"
@@ -250,7 +251,40 @@ bool
 MM_PhysicalArenaVirtualMemory::inflate(MM_EnvironmentBase* env)
 {
 	/* Attach to the virtual memory heap store */
-	return _heap->attachArena(env, this, _memorySpace->getMaximumSize());
+	if (!_heap->attachArena(env, this, _memorySpace->getMaximumSize())) {
+		return false;
+	}
+
+	/* bind the whole reserved range before any of it is committed, so memory committed by later expansions keeps the placement */
+	if (env->getExtensions()->numaAwareGCWork) {
+		return interleaveAcrossNumaNodes(env);
+	}
+
+	return true;
+}
+
+bool
+MM_PhysicalArenaVirtualMemory::interleaveAcrossNumaNodes(MM_EnvironmentBase* env)
+{
+	MM_GCExtensionsBase* ext = env->getExtensions();
+	MM_NUMAManager* numaManager = &ext->_numaManager;
+	uintptr_t stripeBase = (uintptr_t)getLowAddress();
+	uintptr_t arenaTop = (uintptr_t)getHighAddress();
+
+	while (stripeBase < arenaTop) {
+		uintptr_t heapOffset = _heap->calculateOffsetFromHeapBase((void*)stripeBase);
+		uintptr_t stripeTop = OMR_MIN(arenaTop, stripeBase - (heapOffset % NUMA_GC_WORK_STRIPE_SIZE) + NUMA_GC_WORK_STRIPE_SIZE);
+		/* simulated NUMA has no physical node to bind to, but GC work is still distributed by the logical node of each stripe */
+		uintptr_t j9NodeNumber = numaManager->getJ9NodeNumber(numaManager->getAffinityLeaderForHeapOffset(heapOffset));
+		if (0 != j9NodeNumber) {
+			if (!ext->memoryManager->setNumaAffinity(((MM_HeapVirtualMemory *)_heap)->getVmemHandle(), j9NodeNumber, (void*)stripeBase, stripeTop - stripeBase)) {
+				return false;
+			}
+		}
+		stripeBase = stripeTop;
+	}
+
+	return true;
 }
 
 /**
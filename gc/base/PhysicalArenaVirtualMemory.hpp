@@ -41,6 +41,13 @@ enum {
  */
 class MM_PhysicalArenaVirtualMemory : public MM_PhysicalArena {
 private:
+	/**
+	 * Bind the memory of the receiver to the NUMA affinity leaders round robin, in the stripes used to distribute GC work by node
+	 * (see MM_NUMAManager::getAffinityLeaderForHeapOffset()).
+	 * @return true if the memory was bound (or there is no physical NUMA to bind it to), false otherwise.
+	 */
+	bool interleaveAcrossNumaNodes(MM_EnvironmentBase* env);
+
 protected:
 	MM_PhysicalSubArenaVirtualMemory* _physicalSubArena;
 
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "ModronAssertions.h"
+
+#include "RootRangeSet.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+
+bool
+MM_RootRangeSet::addRange(RootScannerEntity entity, MM_RootRangeScanFunction scanFunction, void *userData, uintptr_t size, uintptr_t sliceSize)
+{
+	Assert_MM_true((RootScannerEntity_None < entity) && (RootScannerEntity_Count > entity));
+	Assert_MM_true(0 < sliceSize);
+
+	if (MAXIMUM_RANGES == _rangeCount) {
+		return false;
+	}
+
+	RootRange *range = &_ranges[_rangeCount];
+	range->_entity = entity;
+	range->_scanFunction = scanFunction;
+	range->_userData = userData;
+	range->_size = size;
+	range->_sliceSize = sliceSize;
+	range->_nextIndex = 0;
+	_rangeCount += 1;
+
+	return true;
+}
+
+void
+MM_RootRangeSet::scan(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	bool recordStats = env->getExtensions()->rootScannerStatsEnabled;
+	uintptr_t rangeCount = _rangeCount;
+	if (0 == rangeCount) {
+		return;
+	}
+
+	/* Threads start on different ranges, so that every range gets under way early */
+	uintptr_t firstRange = env->getSlaveID() % rangeCount;
+	for (uintptr_t i = 0; i < rangeCount; i++) {
+		RootRange *range = &_ranges[(firstRange + i) % rangeCount];
+		if (range->_nextIndex < range->_size) {
+			uint64_t startTime = recordStats ? omrtime_hires_clock() : 0;
+			uintptr_t slicesScanned = 0;
+			uintptr_t startIndex = 0;
+			while ((startIndex = MM_AtomicOperations::add(&range->_nextIndex, range->_sliceSize) - range->_sliceSize) < range->_size) {
+				uintptr_t endIndex = OMR_MIN(startIndex + range->_sliceSize, range->_size);
+				range->_scanFunction(env, range->_userData, startIndex, endIndex);
+				slicesScanned += 1;
+			}
+			if (recordStats && (0 != slicesScanned)) {
+				env->_rootScannerStats.addToEntityScanTime(range->_entity, startTime, omrtime_hires_clock(), slicesScanned);
+			}
+		}
+	}
+}
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(ROOTRANGESET_HPP_)
+#define ROOTRANGESET_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "BaseNonVirtual.hpp"
+#include "RootScannerTypes.h"
+
+class MM_EnvironmentBase;
+
+/**
+ * Scan the roots [startIndex, endIndex) of a root range.
+ * @param[in] env the scanning thread
+ * @param[in] userData the data the range was registered with
+ * @param[in] startIndex index of the first root to scan
+ * @param[in] endIndex index following the last root to scan
+ */
+typedef void (*MM_RootRangeScanFunction)(MM_EnvironmentBase *env, void *userData, uintptr_t startIndex, uintptr_t endIndex);
+
+/**
+ * Root sets (thread stacks, global tables, class tables, ...) registered by the collector language interface as
+ * ranges of indexed roots, and scanned by all the threads of a task.  Each range is split into slices which the
+ * threads claim as they go, so a large root set is shared out instead of being scanned by the one thread which
+ * claimed it.
+ *
+ * Ranges are registered by a single thread before the task is dispatched (e.g. from the master setup of the
+ * collector), after which each thread of the task calls scan().  When root scanner stats are enabled, the time
+ * each thread spends on each range is recorded in its MM_RootScannerStats.
+ * @ingroup GC_Base
+ */
+class MM_RootRangeSet : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum {
+		MAXIMUM_RANGES = 16 /**< number of ranges that can be registered at once */
+	};
+
+protected:
+private:
+	struct RootRange {
+		RootScannerEntity _entity; /**< the root scanner entity the scan time is recorded for */
+		MM_RootRangeScanFunction _scanFunction;
+		void *_userData;
+		uintptr_t _size; /**< number of roots in the range */
+		uintptr_t _sliceSize; /**< number of roots claimed by a thread at once */
+		volatile uintptr_t _nextIndex; /**< index of the first root not yet claimed */
+	};
+
+	RootRange _ranges[MAXIMUM_RANGES];
+	uintptr_t _rangeCount;
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Forget all the ranges registered.  Must not be called while the ranges are being scanned.
+	 */
+	MMINLINE void clear() { _rangeCount = 0; }
+
+	/**
+	 * Register a range of roots.  Must not be called while the ranges are being scanned.
+	 * @param[in] entity the root scanner entity the scan time is recorded for
+	 * @param[in] scanFunction the function scanning a slice of the range
+	 * @param[in] userData passed to scanFunction
+	 * @param[in] size number of roots in the range
+	 * @param[in] sliceSize number of roots a thread claims at once, 1 or more
+	 * @return false if no more ranges can be registered
+	 */
+	bool addRange(RootScannerEntity entity, MM_RootRangeScanFunction scanFunction, void *userData, uintptr_t size, uintptr_t sliceSize);
+
+	/**
+	 * Scan slices of the registered ranges until every slice has been claimed.  Called by each thread of the task.
+	 * @param[in] env the scanning thread
+	 */
+	void scan(MM_EnvironmentBase *env);
+
+	MM_RootRangeSet()
+		: MM_BaseNonVirtual()
+		, _rangeCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* ROOTRANGESET_HPP_ */
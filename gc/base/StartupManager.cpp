@@ -44,6 +44,16 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNCHRONOUS_LOGGING "-Xgc:asynchronousLogging"
+#define OMR_XGCASYNCHRONOUS_LOGGING_LENGTH 24
+#define OMR_XGCBINARY_LOGGING "-Xgc:binaryLogging"
+#define OMR_XGCBINARY_LOGGING_LENGTH 18
+#define OMR_XGCDUMP_PAUSE_TIME_STATS "-Xgc:dumpPauseTimeStats"
+#define OMR_XGCDUMP_PAUSE_TIME_STATS_LENGTH 23
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#define OMR_XGCCONCURRENT_SWEEP_SEGREGATED "-Xgc:concurrentSweepSegregated"
+#define OMR_XGCCONCURRENT_SWEEP_SEGREGATED_LENGTH 30
+#endif /* OMR_GC_SEGREGATED_HEAP */
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
 
@@ -272,6 +282,20 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCASYNCHRONOUS_LOGGING, OMR_XGCASYNCHRONOUS_LOGGING_LENGTH)) {
+		extensions->asynchronousLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCBINARY_LOGGING, OMR_XGCBINARY_LOGGING_LENGTH)) {
+		extensions->binaryLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCDUMP_PAUSE_TIME_STATS, OMR_XGCDUMP_PAUSE_TIME_STATS_LENGTH)) {
+		extensions->dumpPauseTimeStats = true;
+	}
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_SWEEP_SEGREGATED, OMR_XGCCONCURRENT_SWEEP_SEGREGATED_LENGTH)) {
+		extensions->concurrentSweepSegregated = true;
+	}
+#endif /* OMR_GC_SEGREGATED_HEAP */
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
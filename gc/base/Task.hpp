@@ -72,6 +72,13 @@ public:
 	MMINLINE virtual void setThreadCount(uintptr_t threadCount) { assume0(1 == threadCount); }
 	MMINLINE virtual uintptr_t getThreadCount() { return 1; }
 
+	/**
+	 * Answer the number of threads the task can make good use of.  When adaptive GC threading is enabled, the
+	 * dispatcher does not dispatch the task with more threads than this.
+	 * @return the recommended thread count, UDATA_MAX to leave the thread count to the dispatcher
+	 */
+	MMINLINE virtual uintptr_t getRecommendedWorkingThreads() { return UDATA_MAX; }
+
 	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex)
 	{
 		/* in a Task we don't need a mutex */
@@ -103,6 +103,10 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (!initializePacketDeques(env)) {
+		return false;
+	}
+
 	if(omrthread_monitor_init_with_name(&_inputListMonitor, 0, "MM_WorkPackets::inputList")) {
 		return false;
 	}
@@ -155,6 +159,57 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 	return true;
 }
 
+/**
+ * Allocate the per GC thread work stealing deques, if work stealing is enabled.
+ * @return true on success, false otherwise
+ */
+bool
+MM_WorkPackets::initializePacketDeques(MM_EnvironmentBase *env)
+{
+	/* NUMA aware GC work relies on the deques to keep packets on the node which produced them */
+	bool stealingEnabled = _extensions->workPacketStealing || _extensions->numaAwareGCWork;
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	/* mutator threads trace outside of any task during concurrent mark and can not own a deque */
+	stealingEnabled = stealingEnabled && !_extensions->concurrentMark;
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+
+	if (stealingEnabled) {
+		uintptr_t dequeCount = _extensions->gcThreadCount;
+		_packetDeques = (MM_PacketDeque *)env->getForge()->allocate(sizeof(MM_PacketDeque) * dequeCount, MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (NULL == _packetDeques) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < dequeCount; i++) {
+			new(&_packetDeques[i]) MM_PacketDeque();
+		}
+		/* count only the initialized deques so that a partial failure is torn down correctly */
+		while (_packetDequeCount < dequeCount) {
+			if (!_packetDeques[_packetDequeCount].initialize(env, _extensions->workPacketDequeSize)) {
+				return false;
+			}
+			_packetDequeCount += 1;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Free the per GC thread work stealing deques.
+ */
+void
+MM_WorkPackets::tearDownPacketDeques(MM_EnvironmentBase *env)
+{
+	if (NULL != _packetDeques) {
+		for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+			_packetDeques[i].tearDown(env);
+		}
+		env->getForge()->free(_packetDeques);
+		_packetDeques = NULL;
+		_packetDequeCount = 0;
+	}
+}
+
 /**
  * Allocate another workpacket block
  * @return true on sucess, false on allocation failure or if _maxpackets is already reached
@@ -243,6 +298,8 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 	_relativelyFullPacketList.tearDown(env);
 	_deferredPacketList.tearDown(env);
 	_deferredFullPacketList.tearDown(env);
+
+	tearDownPacketDeques(env);
 }
 
 void
@@ -258,6 +315,14 @@ void
 MM_WorkPackets::resetAllPackets(MM_EnvironmentBase *env)
 {	
 	MM_Packet *packet;
+
+	for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+		while (NULL != (packet = _packetDeques[i].steal())) {
+			packet->setOwner(env);
+			packet->resetData(env);
+			putPacket(env, packet);
+		}
+	}
 	
 	while(NULL != (packet = getPacket(env, &_fullPacketList))) {
 		packet->resetData(env);
@@ -328,11 +393,79 @@ MM_WorkPackets::inputPacketAvailable(MM_EnvironmentBase *env)
 	bool res = 	((!_fullPacketList.isEmpty())
 				|| (!_relativelyFullPacketList.isEmpty())
 				|| (!_nonEmptyPacketList.isEmpty())
-				|| (!_overflowHandler->isEmpty()));
+				|| (!_overflowHandler->isEmpty())
+				|| packetDequesNonEmpty());
 				
 	return res;
 }
 
+bool
+MM_WorkPackets::packetDequesNonEmpty()
+{
+	for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+		if (!_packetDeques[i].isEmpty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+MM_Packet *
+MM_WorkPackets::getPacketFromDeque(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+	MM_PacketDeque *deque = getPacketDeque(env);
+
+	if (NULL != deque) {
+		packet = deque->pop();
+		if (NULL != packet) {
+			packet->setOwner(env);
+		}
+	}
+
+	return packet;
+}
+
+MM_Packet *
+MM_WorkPackets::stealPacket(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+
+	if (0 != _packetDequeCount) {
+		uintptr_t ownIndex = env->getSlaveID();
+		uintptr_t ownNode = getNumaNodeForDeque(ownIndex);
+		/* when NUMA aware, the first pass only visits threads on this thread's node and the second pass the remaining ones */
+		uintptr_t passCount = (0 != ownNode) ? 2 : 1;
+
+		for (uintptr_t pass = 0; (pass < passCount) && (NULL == packet); pass++) {
+			uintptr_t index = ownIndex;
+			for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+				index = (index + 1) % _packetDequeCount;
+				/* a thread without a deque of its own may steal from any deque, including the one at its index */
+				if ((index == ownIndex) && (NULL != getPacketDeque(env))) {
+					continue;
+				}
+				bool isLocal = (ownNode == getNumaNodeForDeque(index));
+				if ((0 != ownNode) && (isLocal != (0 == pass))) {
+					continue;
+				}
+				MM_PacketDeque *victim = &_packetDeques[index];
+				if (!victim->isEmpty()) {
+					env->_workPacketStats._stealAttempts += 1;
+					packet = victim->steal();
+					if (NULL != packet) {
+						env->_workPacketStats._packetsStolen += 1;
+						packet->setOwner(env);
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	return packet;
+}
+
 /**
  * Transfer a packet to the current overflow handler to be emptied to
  * resolve work packet overflow. 
@@ -382,6 +515,14 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 {
 	MM_Packet *packet;
 
+	/* work on this thread's own deque is preferred as it requires no shared lock */
+	if (NULL != (packet = getPacketFromDeque(env))) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.workPacketsAcquired += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		return packet;
+	}
+
 	if (!inputPacketAvailable(env)) {
 		return NULL;
 	}
@@ -400,6 +541,11 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 		}
 	}
 
+	if(NULL == packet) {
+		/* the shared lists are exhausted - try to steal from another GC thread before resorting to overflow */
+		packet = stealPacket(env);
+	}
+
 	if(NULL == packet) {
 		packet = getInputPacketFromOverflow(env);
 	}
@@ -574,6 +720,10 @@ MM_WorkPackets::getPacketByOverflowing(MM_EnvironmentBase *env)
 	MM_Packet *packet = NULL;
 	
 	packet = getPacket(env, &_fullPacketList);
+	if(NULL == packet) {
+		/* with work stealing enabled full packets are kept on the owning thread's deque */
+		packet = getPacketFromDeque(env);
+	}
 	if(NULL != packet) {
 		/* Move the contents of the packet to overflow */
 		emptyToOverflow(env, packet, OVERFLOW_TYPE_WORKSTACK);
@@ -704,6 +854,21 @@ MM_WorkPackets::putPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 	uintptr_t freeSlots = packet->freeSlots();
 	bool mustNotifyWaitingThreads = false;
 
+	/* Non empty packets stay on this thread's deque, if it has room, where other threads can steal them */
+	if (freeSlots != _slotsInPacket) {
+		MM_PacketDeque *deque = getPacketDeque(env);
+		if (NULL != deque) {
+			mustNotifyWaitingThreads = deque->isEmpty();
+			packet->resetOwner();
+			if (deque->push(packet)) {
+				if (mustNotifyWaitingThreads && (_inputListWaitCount > 0)) {
+					notifyWaitingThreads(env);
+				}
+				return;
+			}
+		}
+	}
+
     /* Empty packet */
 	if(freeSlots == _slotsInPacket) {
 		list = &_emptyPacketList;
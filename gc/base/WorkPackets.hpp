@@ -32,6 +32,7 @@
 
 #include "BaseVirtual.hpp"
 #include "Packet.hpp"
+#include "PacketDeque.hpp"
 #include "PacketList.hpp"
 #include "WorkPacketOverflow.hpp"
 
@@ -75,6 +76,8 @@ protected:
 	MM_PacketList _nonEmptyPacketList;  /**< List for non empty packets */
 	MM_PacketList _deferredPacketList;  /**< List for deferred packets */
 	MM_PacketList _deferredFullPacketList;  /**< List for full deferred packets */
+	MM_PacketDeque *_packetDeques; /**< Per GC thread work stealing deques (indexed by slave ID), or NULL if work stealing is disabled */
+	uintptr_t _packetDequeCount; /**< Number of entries in _packetDeques */
 	
 	OMRPortLibrary *_portLibrary;
 
@@ -92,6 +95,58 @@ protected:
 	MM_Packet *getPacket(MM_EnvironmentBase *env, MM_PacketList *list);
 	MM_Packet *getLeastFullPacket(MM_EnvironmentBase *env, int requiredSlots);
 
+	bool initializePacketDeques(MM_EnvironmentBase *env);
+	void tearDownPacketDeques(MM_EnvironmentBase *env);
+
+	/**
+	 * Answer the work stealing deque owned by the given thread.  Only GC threads participating
+	 * in a task own a deque (the slave ID is only unique within a task).
+	 * @param env[in] the current thread
+	 * @return the deque, or NULL if work stealing is disabled or the thread does not own one
+	 */
+	MMINLINE MM_PacketDeque *
+	getPacketDeque(MM_EnvironmentBase *env)
+	{
+		MM_PacketDeque *deque = NULL;
+		if ((NULL != _packetDeques) && (NULL != env->_currentTask) && (env->getSlaveID() < _packetDequeCount)) {
+			deque = &_packetDeques[env->getSlaveID()];
+		}
+		return deque;
+	}
+
+	/**
+	 * Answer the NUMA node whose threads own the deque at the given index, when work packets are NUMA aware.
+	 * @param index[in] Index of the deque (the slave ID of its owner)
+	 * @return The node, where 1 is the first node, or 0 if work packets are not NUMA aware
+	 */
+	MMINLINE uintptr_t
+	getNumaNodeForDeque(uintptr_t index)
+	{
+		uintptr_t numaNode = 0;
+		if (_extensions->numaAwareGCWork) {
+			numaNode = _extensions->_numaManager.getAffinityLeaderForGCThread(index);
+		}
+		return numaNode;
+	}
+
+	/**
+	 * Pop a packet from the deque owned by the current thread.
+	 * @return a packet, or NULL if none available
+	 */
+	MM_Packet *getPacketFromDeque(MM_EnvironmentBase *env);
+
+	/**
+	 * Steal a packet from the deque of another GC thread.  Victims are visited round robin
+	 * starting after the current thread's own deque (threads on the same NUMA node first, when NUMA aware).
+	 * @return a packet, or NULL if none could be stolen
+	 */
+	MM_Packet *stealPacket(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if any work stealing deque contains a packet
+	 */
+	bool packetDequesNonEmpty();
+
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
 	
@@ -217,6 +272,8 @@ public:
 		_nonEmptyPacketList(env),
 		_deferredPacketList(env),
 		_deferredFullPacketList(env),
+		_packetDeques(NULL),
+		_packetDequeCount(0),
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
@@ -124,6 +124,32 @@ done:
 	return result;
 }
 
+/**
+ * Acquire a spinlock only if it is free, without spinning or waiting.
+ * @param[in] s spinlock to be acquired
+ * @param[in] lockTracing lock statistics
+ * @return  0 if the lock was acquired, -1 if it is held by another thread
+ */
+intptr_t
+omrgc_spinlock_try_acquire(J9GCSpinlock *spinlock, J9ThreadMonitorTracing*  lockTracing)
+{
+	volatile intptr_t *target = (volatile intptr_t*) &spinlock->target;
+	intptr_t result = -1;
+
+	if ((-1 == *target) && (-1 == (intptr_t) MM_AtomicOperations::lockCompareExchange((volatile uintptr_t*) target, (uintptr_t)-1, 0))) {
+#if defined(OMR_THR_JLM)
+		J9ThreadMonitorTracing* tracing = lockTracing;
+		if (tracing != NULL) {
+			UPDATE_JLM_MON_ENTER(tracing);
+		}
+#endif /* OMR_THR_JLM */
+		/* On out-of-order memory models (e.g. Power4), ensure that all reads and writes have been completed at this point */
+		MM_AtomicOperations::readWriteBarrier();
+		result = 0;
+	}
+	return result;
+}
+
 /**
  * Destroy a spinlock.
  * @param[in] s spinlock to be destroyed
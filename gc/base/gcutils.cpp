@@ -236,4 +236,84 @@ getSystemGCReasonAsString(uint32_t gcCode)
 	}
 }
 
+/**
+ * Return the name of a root scanner entity as a string
+ * @param entity root scanner entity
+ */
+const char *
+getRootScannerEntityAsString(RootScannerEntity entity)
+{
+	switch(entity) {
+	case RootScannerEntity_ScavengeRememberedSet:
+		return "scavengeRememberedSet";
+	case RootScannerEntity_Classes:
+		return "classes";
+	case RootScannerEntity_VMClassSlots:
+		return "vmClassSlots";
+	case RootScannerEntity_PermanentClasses:
+		return "permanentClasses";
+	case RootScannerEntity_ClassLoaders:
+		return "classLoaders";
+	case RootScannerEntity_Threads:
+		return "threads";
+	case RootScannerEntity_FinalizableObjects:
+		return "finalizableObjects";
+	case RootScannerEntity_UnfinalizedObjects:
+		return "unfinalizedObjects";
+	case RootScannerEntity_OwnableSynchronizerObjects:
+		return "ownableSynchronizerObjects";
+	case RootScannerEntity_StringTable:
+		return "stringTable";
+	case RootScannerEntity_JNIGlobalReferences:
+		return "jniGlobalReferences";
+	case RootScannerEntity_JNIWeakGlobalReferences:
+		return "jniWeakGlobalReferences";
+	case RootScannerEntity_DebuggerReferences:
+		return "debuggerReferences";
+	case RootScannerEntity_DebuggerClassReferences:
+		return "debuggerClassReferences";
+	case RootScannerEntity_MonitorReferences:
+		return "monitorReferences";
+	case RootScannerEntity_WeakReferenceObjects:
+		return "weakReferenceObjects";
+	case RootScannerEntity_SoftReferenceObjects:
+		return "softReferenceObjects";
+	case RootScannerEntity_PhantomReferenceObjects:
+		return "phantomReferenceObjects";
+	case RootScannerEntity_JVMTIObjectTagTables:
+		return "jvmtiObjectTagTables";
+	case RootScannerEntity_NonCollectableObjects:
+		return "nonCollectableObjects";
+	case RootScannerEntity_RememberedSet:
+		return "rememberedSet";
+	case RootScannerEntity_MemoryAreaObjects:
+		return "memoryAreaObjects";
+	case RootScannerEntity_MetronomeRememberedSet:
+		return "metronomeRememberedSet";
+	case RootScannerEntity_ClassesComplete:
+		return "classesComplete";
+	case RootScannerEntity_WeakReferenceObjectsComplete:
+		return "weakReferenceObjectsComplete";
+	case RootScannerEntity_SoftReferenceObjectsComplete:
+		return "softReferenceObjectsComplete";
+	case RootScannerEntity_PhantomReferenceObjectsComplete:
+		return "phantomReferenceObjectsComplete";
+	case RootScannerEntity_UnfinalizedObjectsComplete:
+		return "unfinalizedObjectsComplete";
+	case RootScannerEntity_OwnableSynchronizerObjectsComplete:
+		return "ownableSynchronizerObjectsComplete";
+	case RootScannerEntity_MonitorLookupCaches:
+		return "monitorLookupCaches";
+	case RootScannerEntity_MonitorLookupCachesComplete:
+		return "monitorLookupCachesComplete";
+	case RootScannerEntity_MonitorReferenceObjectsComplete:
+		return "monitorReferenceObjectsComplete";
+	case RootScannerEntity_GlobalReferences:
+		return "globalReferences";
+	case RootScannerEntity_None:
+	default:
+		return "unknown";
+	}
+}
+
 } /* extern "C" */
@@ -27,6 +27,7 @@
 #include "omrcfg.h"
 #include "modronbase.h"
 #include "j9nongenerated.h"
+#include "RootScannerTypes.h"
 
 /**
  * @}
@@ -56,6 +57,8 @@ const char *getLoaResizeReasonAsString(LoaResizeReason reason);
 
 const char *getSystemGCReasonAsString(uint32_t gcCode);
 
+const char *getRootScannerEntityAsString(RootScannerEntity entity);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif  /* __cplusplus */
@@ -149,18 +149,21 @@ MM_AllocationContextSegregated::flush(MM_EnvironmentBase *env)
 {
 	lockContext();
 
-	/* flush the per-context small full regions to sweep regions */
+	/* Flush the per-context full regions to the full regions of the region pool, which are moved to the sweep regions
+	 * when a collection starts sweeping.  A flush between collections must not put regions on the sweep regions, since
+	 * the sweep of the last collection may still be taking regions from them concurrently.
+	 */
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 		flushSmall(env, sizeClass);
-		_regionPool->getSmallSweepRegions(sizeClass)->enqueue(_perContextSmallFullRegions[sizeClass]);
+		_regionPool->getSmallFullRegions(sizeClass)->enqueue(_perContextSmallFullRegions[sizeClass]);
 	}
 
-	/* flush the per-context large full region to sweep regions */
-	_regionPool->getLargeSweepRegions()->enqueue(_perContextLargeFullRegions);
+	/* flush the per-context large full region */
+	_regionPool->getLargeFullRegions()->enqueue(_perContextLargeFullRegions);
 
-	/* flush the per-context arraylet region to sweep regions */
+	/* flush the per-context arraylet region */
 	flushArraylet(env);
-	_regionPool->getArrayletSweepRegions()->enqueue(_perContextArrayletFullRegions);
+	_regionPool->getArrayletFullRegions()->enqueue(_perContextArrayletFullRegions);
 
 	unlockContext();
 }
@@ -266,18 +269,23 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 	uintptr_t preAllocatedBytes = 0;
 
 	while (!done) {
+		bool waitForSweep = false;
+		uintptr_t concurrentSweepCount = 0;
 
 		/* If we have a region, attempt to replenish the ACL's cache */
 		MM_HeapRegionDescriptorSegregated *region = _smallRegions[sizeClass];
 		if (NULL != region) {
 			MM_MemoryPoolAggregatedCellList *memoryPoolACL = region->getMemoryPoolACL();
-			uintptr_t* cellList = memoryPoolACL->preAllocateCells(env, sizeClasses->getCellSize(sizeClass), replenishSize, &preAllocatedBytes);
-			if (NULL != cellList) {
+			/* Take enough runs of free cells for the whole replenish at once, rather than one run per call */
+			MM_HeapLinkedFreeHeader *runs = memoryPoolACL->preAllocateCellRuns(env, sizeClasses->getCellSize(sizeClass), replenishSize, &preAllocatedBytes);
+			if (NULL != runs) {
 				Assert_MM_true(preAllocatedBytes > 0);
 				if (shouldPreMarkSmallCells(env)) {
-					_markingScheme->preMarkSmallCells(env, region, cellList, preAllocatedBytes);
+					for (MM_HeapLinkedFreeHeader *run = runs; NULL != run; run = run->getNext()) {
+						_markingScheme->preMarkSmallCells(env, region, (uintptr_t *)run, run->getSize());
+					}
 				}
-				segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, cellList, preAllocatedBytes);
+				segregatedAllocationInterface->replenishCacheWithRuns(env, sizeInBytesRequired, runs, preAllocatedBytes);
 				result = (uintptr_t *) segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
 				done = true;
 			}
@@ -300,15 +308,23 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 				/* Attempt to get a region by sweeping */
 				if (!trySweepAndAllocateRegionFromSmallSizeClass(env, sizeClass, &sweepCount, &sweepStartTime)) {
 					/* Attempt to get an unused region */
+					concurrentSweepCount = _regionPool->getConcurrentSweepCount();
 					if (!tryAllocateFromRegionPool(env, sizeClass)) {
-						/* Really out of regions */
-						done = true;
+						/* Unless the cache was just replenished, retry once the regions freed by a concurrent sweep have
+						 * been returned, otherwise really out of regions
+						 */
+						waitForSweep = !done;
 					}
 				}
 			}
 		}
 
 		smallAllocationUnlock();
+
+		/* wait outside of the lock so that the other threads of this context can still allocate from their caches and sweep */
+		if (waitForSweep) {
+			done = !_regionPool->waitForConcurrentSweep(env, concurrentSweepCount);
+		}
 	}
 	return result;
 
@@ -340,6 +356,7 @@ retry:
 		goto retry;
 	}
 
+	uintptr_t concurrentSweepCount = _regionPool->getConcurrentSweepCount();
 	region = _regionPool->allocateFromRegionPool(env, 1, OMR_SIZECLASSES_ARRAYLET, MAX_UINT);
 	if (region != NULL) {
 		/* cache the small full region in AC */
@@ -350,6 +367,11 @@ retry:
 
 	arrayletAllocationUnlock();
 
+	if (_regionPool->waitForConcurrentSweep(env, concurrentSweepCount)) {
+		arrayletAllocationLock();
+		goto retry;
+	}
+
 	return NULL;
 }
 #endif /* defined(OMR_GC_ARRAYLETS) */
@@ -360,12 +382,16 @@ MM_AllocationContextSegregated::allocateLarge(MM_EnvironmentBase *env, uintptr_t
 {
 	uintptr_t neededRegions = _regionPool->divideUpRegion(sizeInBytesRequired);
 	MM_HeapRegionDescriptorSegregated *region = NULL;
-	uintptr_t excess = 0;
-
-	while (region == NULL && excess < MAX_UINT) {
-		region = _regionPool->allocateFromRegionPool(env, neededRegions, OMR_SIZECLASSES_LARGE, excess);
-		excess = (2 * excess) + 1;
-	}
+	uintptr_t concurrentSweepCount = 0;
+
+	do {
+		uintptr_t excess = 0;
+		concurrentSweepCount = _regionPool->getConcurrentSweepCount();
+		while (region == NULL && excess < MAX_UINT) {
+			region = _regionPool->allocateFromRegionPool(env, neededRegions, OMR_SIZECLASSES_LARGE, excess);
+			excess = (2 * excess) + 1;
+		}
+	} while ((NULL == region) && _regionPool->waitForConcurrentSweep(env, concurrentSweepCount));
 
 	uintptr_t *result = (region == NULL) ? NULL : (uintptr_t *)region->getLowAddress();
 
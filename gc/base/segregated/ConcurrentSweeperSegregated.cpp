@@ -0,0 +1,269 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "modronopt.h"
+#include "ModronAssertions.h"
+#include "omrport.h"
+#include "omrutil.h"
+
+#include "ConcurrentSweeperSegregated.hpp"
+
+#include "CollectorLanguageInterfaceImpl.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ParallelDispatcher.hpp"
+#include "SweepSchemeSegregated.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_ConcurrentSweeperSegregated::MM_ConcurrentSweeperSegregated(MM_EnvironmentBase *env, MM_CollectorLanguageInterface *cli, MM_SweepSchemeSegregated *sweepScheme)
+	: MM_BaseNonVirtual()
+	, _extensions(env->getExtensions())
+	, _cli(cli)
+	, _sweepScheme(sweepScheme)
+	, _monitor(NULL)
+	, _state(STATE_ERROR)
+	, _armed(false)
+	, _regionsSweptConcurrently(0)
+	, _sweepsCompleted(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_ConcurrentSweeperSegregated *
+MM_ConcurrentSweeperSegregated::newInstance(MM_EnvironmentBase *env, MM_CollectorLanguageInterface *cli, MM_SweepSchemeSegregated *sweepScheme)
+{
+	MM_ConcurrentSweeperSegregated *sweeper = (MM_ConcurrentSweeperSegregated *)env->getForge()->allocate(sizeof(MM_ConcurrentSweeperSegregated), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != sweeper) {
+		new(sweeper) MM_ConcurrentSweeperSegregated(env, cli, sweepScheme);
+		if (!sweeper->initialize(env)) {
+			sweeper->kill(env);
+			sweeper = NULL;
+		}
+	}
+	return sweeper;
+}
+
+void
+MM_ConcurrentSweeperSegregated::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ConcurrentSweeperSegregated::initialize(MM_EnvironmentBase *env)
+{
+	return 0 == omrthread_monitor_init_with_name(&_monitor, 0, "MM_ConcurrentSweeperSegregated::_monitor");
+}
+
+void
+MM_ConcurrentSweeperSegregated::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+uintptr_t
+MM_ConcurrentSweeperSegregated::sweeper_thread_proc2(OMRPortLibrary* portLib, void *info)
+{
+	MM_ConcurrentSweeperSegregated *sweeper = (MM_ConcurrentSweeperSegregated *)info;
+	/* run the sweeping loop until shutdown.  This method will NOT return */
+	sweeper->sweeperThreadEntryPoint();
+	Assert_MM_unreachable();
+	return 0;
+}
+
+int J9THREAD_PROC
+MM_ConcurrentSweeperSegregated::sweeper_thread_proc(void *info)
+{
+	MM_ConcurrentSweeperSegregated *sweeper = (MM_ConcurrentSweeperSegregated *)info;
+	MM_GCExtensionsBase *extensions = sweeper->_extensions;
+	OMR_VM *omrVM = extensions->getOmrVM();
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	uintptr_t rc = 0;
+	omrsig_protect(sweeper_thread_proc2, info,
+			((MM_ParallelDispatcher *)extensions->dispatcher)->getSignalHandler(), omrVM,
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+	return 0;
+}
+
+bool
+MM_ConcurrentSweeperSegregated::startup()
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it can not notify us of its start-up state before we wait */
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		sweeper_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _state) {
+			omrthread_monitor_wait(_monitor);
+		}
+		success = (STATE_ERROR != _state);
+	} else {
+		_state = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return success;
+}
+
+void
+MM_ConcurrentSweeperSegregated::shutdown()
+{
+	Assert_MM_true(NULL != _monitor);
+	if (STATE_ERROR != _state) {
+		/* tell the thread to stop and then wait for it to exit */
+		omrthread_monitor_enter(_monitor);
+		while (STATE_TERMINATED != _state) {
+			_state = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify_all(_monitor);
+			omrthread_monitor_wait(_monitor);
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+void
+MM_ConcurrentSweeperSegregated::sweeperThreadEntryPoint()
+{
+	OMR_VM *omrVM = _extensions->getOmrVM();
+	OMR_VMThread *omrVMThread = NULL;
+	MM_EnvironmentBase *env = NULL;
+
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_WAITING;
+	omrthread_monitor_notify_all(_monitor);
+	do {
+		if ((STATE_SWEEP_REQUESTED == _state) && (NULL == omrVMThread)) {
+			/* the sweep needs an environment of its own for its region work lists and allocation tracker, which
+			 * can only be created once the heap exists, so attach when the first sweep is requested
+			 */
+			omrthread_monitor_exit(_monitor);
+			omrVMThread = _cli->attachVMThread(omrVM, "Concurrent Sweep Helper", MM_CollectorLanguageInterfaceImpl::ATTACH_GC_HELPER_THREAD);
+			omrthread_monitor_enter(_monitor);
+			if (NULL == omrVMThread) {
+				/* the sweeper stays armed, so the next collection sweeps the regions */
+				_state = STATE_ERROR;
+				omrthread_monitor_notify_all(_monitor);
+				omrthread_exit(_monitor);
+			}
+			env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		} else if (STATE_SWEEP_REQUESTED == _state) {
+			_state = STATE_SWEEPING;
+			/* sweep outside of the monitor so that a pause request is seen at the next increment */
+			omrthread_monitor_exit(_monitor);
+			uintptr_t regionsSwept = 0;
+			bool finished = false;
+			while (!finished && (STATE_SWEEPING == _state)) {
+				uintptr_t increment = _sweepScheme->sweepIncrement(env);
+				if (0 == increment) {
+					/* allocating threads only take small regions off the queues, and the finish waits for them to return the regions they took */
+					_sweepScheme->finishConcurrentSweep(env);
+					finished = true;
+				}
+				regionsSwept += increment;
+			}
+			omrthread_monitor_enter(_monitor);
+			_regionsSweptConcurrently += regionsSwept;
+			if (finished) {
+				_armed = false;
+				_sweepsCompleted += 1;
+			}
+			if ((STATE_SWEEPING == _state) || (STATE_PAUSE_REQUESTED == _state)) {
+				_state = STATE_WAITING;
+				omrthread_monitor_notify_all(_monitor);
+			}
+		} else if (STATE_PAUSE_REQUESTED == _state) {
+			/* paused before the sweep request was picked up */
+			_state = STATE_WAITING;
+			omrthread_monitor_notify_all(_monitor);
+		} else if (STATE_WAITING == _state) {
+			omrthread_monitor_wait(_monitor);
+		}
+	} while (STATE_TERMINATION_REQUESTED != _state);
+	omrthread_monitor_exit(_monitor);
+
+	if (NULL != omrVMThread) {
+		_cli->detachVMThread(omrVM, omrVMThread, MM_CollectorLanguageInterfaceImpl::ATTACH_GC_HELPER_THREAD);
+	}
+
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+bool
+MM_ConcurrentSweeperSegregated::startSweeping(MM_EnvironmentBase *env)
+{
+	bool started = false;
+	omrthread_monitor_enter(_monitor);
+	if (STATE_WAITING == _state) {
+		_armed = true;
+		_regionsSweptConcurrently = 0;
+		_state = STATE_SWEEP_REQUESTED;
+		omrthread_monitor_notify_all(_monitor);
+		started = true;
+	}
+	omrthread_monitor_exit(_monitor);
+	return started;
+}
+
+void
+MM_ConcurrentSweeperSegregated::pauseSweeping(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	/* the thread may already have been shut down (the heap is torn down after the collector) */
+	while ((STATE_SWEEP_REQUESTED == _state) || (STATE_SWEEPING == _state) || (STATE_PAUSE_REQUESTED == _state)) {
+		_state = STATE_PAUSE_REQUESTED;
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_monitor_wait(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+bool
+MM_ConcurrentSweeperSegregated::waitForSweep(MM_EnvironmentBase *env, uintptr_t sweepsCompleted)
+{
+	bool waited = false;
+	omrthread_monitor_enter(_monitor);
+	while ((STATE_SWEEP_REQUESTED == _state) || (STATE_SWEEPING == _state)) {
+		waited = true;
+		omrthread_monitor_wait(_monitor);
+	}
+	/* the sweep may have returned its regions after the caller found none, but before it got here */
+	waited = waited || (sweepsCompleted != _sweepsCompleted);
+	omrthread_monitor_exit(_monitor);
+	return waited;
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
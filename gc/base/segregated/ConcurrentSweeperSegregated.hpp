@@ -0,0 +1,141 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(CONCURRENTSWEEPERSEGREGATED_HPP_)
+#define CONCURRENTSWEEPERSEGREGATED_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "omrthread.h"
+#include "modronbase.h"
+#include "modronopt.h"
+
+#include "BaseNonVirtual.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+class MM_CollectorLanguageInterface;
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_SweepSchemeSegregated;
+
+/**
+ * Sweeps the segregated heap in the background after a global collection.
+ *
+ * At the end of marking the collector queues every region in use for sweeping (see
+ * MM_SweepSchemeSegregated::startConcurrentSweep()) and, once the pause is over, arms the sweeper.  A dedicated
+ * thread then sweeps the queued regions while the mutators run, which take small regions of the size class they
+ * allocate from off the same queues and sweep them on demand.  When everything is swept the thread coalesces the
+ * free regions.  When the next collection starts the thread is paused, and the GC threads sweep whatever is left
+ * before the mark map is reused.
+ */
+class MM_ConcurrentSweeperSegregated : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	typedef enum SweeperState {
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_WAITING, /**< Idle, nothing to sweep or sweeping paused */
+		STATE_SWEEP_REQUESTED, /**< Regions are queued and the thread should sweep them */
+		STATE_SWEEPING, /**< The thread is sweeping (outside of the monitor) */
+		STATE_PAUSE_REQUESTED, /**< The thread should stop sweeping at the end of the current increment */
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED,
+	} SweeperState;
+
+	MM_GCExtensionsBase *_extensions;
+	MM_CollectorLanguageInterface *_cli;
+	MM_SweepSchemeSegregated *_sweepScheme;
+	omrthread_monitor_t _monitor; /**< Protects _state */
+	volatile SweeperState _state;
+	bool _armed; /**< True if regions queued by the last collection may not all have been swept and coalesced */
+	uintptr_t _regionsSweptConcurrently; /**< Regions swept by the background thread since the sweeper was last armed */
+	volatile uintptr_t _sweepsCompleted; /**< Number of sweeps the background thread has finished, each returning the free regions to the pool */
+
+	/*
+	 * Function members
+	 */
+private:
+	void sweeperThreadEntryPoint();
+	static uintptr_t sweeper_thread_proc2(OMRPortLibrary* portLib, void *info);
+	static int J9THREAD_PROC sweeper_thread_proc(void *info);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_ConcurrentSweeperSegregated *newInstance(MM_EnvironmentBase *env, MM_CollectorLanguageInterface *cli, MM_SweepSchemeSegregated *sweepScheme);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the background thread, waiting until it is ready to accept work.
+	 * @return true on success, false on failure
+	 */
+	bool startup();
+
+	/**
+	 * Stop the background thread, waiting until it has exited.
+	 */
+	void shutdown();
+
+	/**
+	 * Arm the sweeper and wake the background thread.  Must be called by the master GC thread at the end of a
+	 * collection, after the regions have been queued for sweeping and the heap has been resized.
+	 * @return true if the thread is sweeping, false if it is not running and the caller has to sweep the regions
+	 */
+	bool startSweeping(MM_EnvironmentBase *env);
+
+	/**
+	 * Stop the background thread from sweeping, waiting until it is idle.  The remaining regions stay queued.
+	 * Must be called before a collection uses the mark map or the heap is resized.
+	 */
+	void pauseSweeping(MM_EnvironmentBase *env);
+
+	/**
+	 * Wait until the background thread has stopped sweeping.  Called by allocating threads which found no free
+	 * region, before giving up on the allocation.
+	 * @param sweepsCompleted[in] The value of getSweepsCompleted() read before the thread looked for a free region
+	 * @return true if the thread was sweeping or has finished a sweep since, so the free regions may have changed
+	 */
+	bool waitForSweep(MM_EnvironmentBase *env, uintptr_t sweepsCompleted);
+
+	MMINLINE uintptr_t getSweepsCompleted() { return _sweepsCompleted; }
+
+	/**
+	 * Disarm the sweeper once a collection has completed the sweep.
+	 */
+	MMINLINE void disarm() { _armed = false; }
+
+	/**
+	 * @return true if the regions queued by the last collection may not all have been swept and coalesced
+	 */
+	MMINLINE bool isArmed() { return _armed; }
+
+	MMINLINE uintptr_t getRegionsSweptConcurrently() { return _regionsSweptConcurrently; }
+
+	MM_ConcurrentSweeperSegregated(MM_EnvironmentBase *env, MM_CollectorLanguageInterface *cli, MM_SweepSchemeSegregated *sweepScheme);
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* CONCURRENTSWEEPERSEGREGATED_HPP_ */
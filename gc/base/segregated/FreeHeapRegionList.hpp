@@ -70,6 +70,13 @@ public:
 	 */
 	virtual void detach(MM_HeapRegionDescriptorSegregated *cur) = 0;
 
+	/*
+	 * Detach the given range if it is free, which it must then be on this list.  The check and
+	 * the detach are atomic with respect to allocation from the list.
+	 * @return true if the range was detached
+	 */
+	virtual bool detachIfFree(MM_HeapRegionDescriptorSegregated *cur) = 0;
+
 	virtual MM_HeapRegionDescriptorSegregated *allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess) = 0;
 
 	MM_HeapRegionDescriptorSegregated *allocate(MM_EnvironmentBase *env, uintptr_t szClass)
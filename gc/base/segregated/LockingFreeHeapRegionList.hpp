@@ -108,23 +108,26 @@ public:
 		lock();
 		src->lock();
 		
-		/* Remove from src */
-		MM_HeapRegionDescriptorSegregated *front = src->_head;
-		MM_HeapRegionDescriptorSegregated *back = src->_tail;
-		uintptr_t srcLength = src->_length;
-		src->_head = NULL;
-		src->_tail = NULL;
-		src->_length = 0;
-		
-		/* Add to front of self */
-		back->setNext(_head); /* OK even if _head is NULL */
-		if (_head == NULL) {
-			_tail = back;
-		} else {
-			_head->setPrev(back);
+		/* src may have been emptied by a concurrent allocation since it was read */
+		if (NULL != src->_head) {
+			/* Remove from src */
+			MM_HeapRegionDescriptorSegregated *front = src->_head;
+			MM_HeapRegionDescriptorSegregated *back = src->_tail;
+			uintptr_t srcLength = src->_length;
+			src->_head = NULL;
+			src->_tail = NULL;
+			src->_length = 0;
+			
+			/* Add to front of self */
+			back->setNext(_head); /* OK even if _head is NULL */
+			if (_head == NULL) {
+				_tail = back;
+			} else {
+				_head->setPrev(back);
+			}
+			_head = front;
+			_length += srcLength;
 		}
-		_head = front;
-		_length += srcLength;
 		
 		src->unlock();
 		unlock();
@@ -147,6 +150,18 @@ public:
 		unlock();
 	}
 
+	virtual bool
+	detachIfFree(MM_HeapRegionDescriptorSegregated *cur)
+	{
+		lock();
+		bool result = cur->isFree();
+		if (result) {
+			detachInternal(cur);
+		}
+		unlock();
+		return result;
+	}
+
 	virtual MM_HeapRegionDescriptorSegregated* allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess);
 
 	virtual uintptr_t getTotalRegions();
@@ -88,6 +88,71 @@ MM_MemoryPoolAggregatedCellList::preAllocateCells(MM_EnvironmentBase* env, uintp
 	return allocatedCellList;
 }
 
+/**
+ * Pre allocates runs of cells within the region, taking as many free chunks as needed to reach the desired amount
+ * of bytes under a single acquisition of the lock.  The runs are linked through their free headers, so they stay
+ * walkable until they are used.
+ * @param desiredBytes the desired amount of bytes to be pre-allocated
+ * @param preAllocatedBytes a pointer to where the actual amount of pre-allocated bytes will be written to
+ * @return the first run, or NULL if the region has no free cell
+ */
+MM_HeapLinkedFreeHeader*
+MM_MemoryPoolAggregatedCellList::preAllocateCellRuns(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, uintptr_t* preAllocatedBytes)
+{
+	uintptr_t adjustedDesiredBytes = (desiredBytes / cellSize) * cellSize;
+	if (0 == adjustedDesiredBytes) {
+		adjustedDesiredBytes = cellSize;
+	}
+
+	MM_HeapLinkedFreeHeader *firstRun = NULL;
+	MM_HeapLinkedFreeHeader *lastRun = NULL;
+	uintptr_t totalBytes = 0;
+
+	_lock.acquire();
+
+	while (totalBytes < adjustedDesiredBytes) {
+		if (_heapCurrent == _heapTop) {
+			/* The current chunk is empty, get the next one */
+			refreshCurrentEntry();
+			if (NULL == _heapCurrent) {
+				break;
+			}
+		}
+
+		uintptr_t *runBase = _heapCurrent;
+		uintptr_t runBytes = (uintptr_t)_heapTop - (uintptr_t)_heapCurrent;
+		uintptr_t remainingBytes = adjustedDesiredBytes - totalBytes;
+		if (runBytes > remainingBytes) {
+			/* Carve off the desired part and make the remainder walkable */
+			runBytes = remainingBytes;
+			_heapCurrent = (uintptr_t *)((uintptr_t)_heapCurrent + runBytes);
+			MM_HeapLinkedFreeHeader::fillWithHoles(_heapCurrent, (uintptr_t)_heapTop - (uintptr_t)_heapCurrent);
+		} else {
+			/* Take the whole free chunk */
+			_heapCurrent = _heapTop;
+		}
+
+		MM_HeapLinkedFreeHeader *run = MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(runBase);
+		run->setSize(runBytes);
+		run->setNext(NULL);
+		if (NULL == lastRun) {
+			firstRun = run;
+		} else {
+			lastRun->setNext(run);
+		}
+		lastRun = run;
+		totalBytes += runBytes;
+	}
+
+	*preAllocatedBytes = totalBytes;
+	if (0 != totalBytes) {
+		addBytesAllocated(env, totalBytes);
+	}
+	_lock.release();
+
+	return firstRun;
+}
+
 /**
  * @todo Provide function documentation
  */
@@ -189,4 +254,17 @@ MM_MemoryPoolAggregatedCellList::returnCell(MM_EnvironmentBase *env, uintptr_t *
 	_lock.release();
 }
 
+void
+MM_MemoryPoolAggregatedCellList::returnCellRun(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *run)
+{
+	_lock.acquire();
+	uintptr_t runBytes = run->getSize();
+	MM_HeapLinkedFreeHeader::linkInAsHead((volatile uintptr_t *)(&_freeListHead), run);
+	/* The run was counted as allocated when it was pre-allocated, correct for its un-allocation */
+	if (GC_UNMARK == env->getAllocationColor()) {
+		addSweepFreeBytes(env, runBytes);
+	}
+	_lock.release();
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
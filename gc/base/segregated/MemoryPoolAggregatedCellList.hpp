@@ -115,8 +115,15 @@ public:
 	 * Return the cell to the free list
 	 */ 
 	void returnCell(MM_EnvironmentBase *env, uintptr_t *cell);
+
+	/**
+	 * Return a run of cells pre-allocated by preAllocateCellRuns() to the free list
+	 * @param run the run, with its size set in its free header
+	 */
+	void returnCellRun(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *run);
 	MMINLINE bool hasCell() { return (_freeListHead != NULL) || (_heapCurrent < _heapTop); }
 	uintptr_t* preAllocateCells(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, uintptr_t* preAllocatedBytesOutput);
+	MM_HeapLinkedFreeHeader *preAllocateCellRuns(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, uintptr_t* preAllocatedBytesOutput);
 	void addBytesAllocated(MM_EnvironmentBase* env, uintptr_t bytesAllocated);
 	uintptr_t debugCountFreeBytes();
 	
@@ -22,6 +22,7 @@
  */
 
 
+#include "ConcurrentSweeperSegregated.hpp"
 #include "EnvironmentBase.hpp"
 #include "FreeHeapRegionList.hpp"
 #include "GCExtensionsBase.hpp"
@@ -331,6 +332,20 @@ MM_RegionPoolSegregated::joinBucketListsForSplitIndex(MM_EnvironmentBase *env)
 	}
 }
 
+/* join the lists for each buckets per size class, for every split index */
+void
+MM_RegionPoolSegregated::joinBucketLists(MM_EnvironmentBase *env)
+{
+	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		for (uintptr_t splitIndex = 0; splitIndex < _splitAvailableListSplitCount; splitIndex++) {
+			MM_LockingHeapRegionQueue *primaryQueue = &(_smallAvailableRegions[sizeClass][PRIMARY_BUCKET])[splitIndex];
+			for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
+				primaryQueue->enqueue(&(_smallAvailableRegions[sizeClass][i])[splitIndex]);
+			}
+		}
+	}
+}
+
 /**
  * Attempt to allocate a region from the given size classes available list.
  * If there are no available regions in this size class, return null.
@@ -414,6 +429,20 @@ MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass(MM_Environment
 	return region;
 }
 
+bool
+MM_RegionPoolSegregated::waitForConcurrentSweep(MM_EnvironmentBase *env, uintptr_t concurrentSweepCount)
+{
+	MM_ConcurrentSweeperSegregated *concurrentSweeper = (NULL == _sweepScheme) ? NULL : _sweepScheme->getConcurrentSweeper();
+	return (NULL != concurrentSweeper) && concurrentSweeper->waitForSweep(env, concurrentSweepCount);
+}
+
+uintptr_t
+MM_RegionPoolSegregated::getConcurrentSweepCount()
+{
+	MM_ConcurrentSweeperSegregated *concurrentSweeper = (NULL == _sweepScheme) ? NULL : _sweepScheme->getConcurrentSweeper();
+	return (NULL == concurrentSweeper) ? 0 : concurrentSweeper->getSweepsCompleted();
+}
+
 void
 MM_RegionPoolSegregated::updateOccupancy (uintptr_t sizeClass, uintptr_t occupancy)
 {
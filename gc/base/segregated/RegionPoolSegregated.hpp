@@ -128,6 +128,7 @@ private:
 	volatile uintptr_t _currentCountOfSweepRegions[OMR_SIZECLASSES_MAX_SMALL + 1];
 	uintptr_t _initialTotalCountOfSweepRegions;
 	volatile uintptr_t _currentTotalCountOfSweepRegions;
+	volatile uintptr_t _smallSweepsInProgress; /**< Number of threads sweeping small regions they have taken off the sweep queues */
 	
 	bool _isSweepingSmall; /**< if GC is sweeping small pages */
 	uintptr_t _splitAvailableListSplitCount; /* number of split available region queues per size class per defragment bucket */
@@ -168,6 +169,20 @@ public:
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromArrayletSizeClass(MM_EnvironmentBase *env);
 	MM_HeapRegionDescriptorSegregated *sweepAndAllocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
+
+	/**
+	 * Wait for the background sweeper to return the regions freed by the last collection to the pool.
+	 * Must not be called with an allocation context lock held, since other threads of the context would block
+	 * behind the wait.
+	 * @param concurrentSweepCount[in] The value of getConcurrentSweepCount() read before the caller tried to allocate from the pool
+	 * @return true if the caller waited or a sweep has returned regions since, so allocating from the pool again may succeed
+	 */
+	bool waitForConcurrentSweep(MM_EnvironmentBase *env, uintptr_t concurrentSweepCount);
+
+	/**
+	 * @return the number of concurrent sweeps which have returned their free regions to the pool
+	 */
+	uintptr_t getConcurrentSweepCount();
 	void enqueueAvailable(MM_HeapRegionDescriptorSegregated *region, uintptr_t sizeClass, uintptr_t occupancy, uintptr_t splitListIndex);
 
 	/**
@@ -218,6 +233,14 @@ public:
 	{
 		MM_AtomicOperations::subtract(&_currentTotalCountOfSweepRegions, count);
 	}
+
+	/**
+	 * Called around the sweep of small regions taken off the sweep queues, which may return some of them to the free
+	 * lists.  Free regions can only be coalesced once no thread is in such a sweep.
+	 */
+	MMINLINE void startSmallSweep() { MM_AtomicOperations::add(&_smallSweepsInProgress, 1); }
+	MMINLINE void endSmallSweep() { MM_AtomicOperations::subtract(&_smallSweepsInProgress, 1); }
+	MMINLINE uintptr_t getSmallSweepsInProgress() const { return _smallSweepsInProgress; }
 	
 	MMINLINE void addDarkMatterCellsAfterSweepForSizeClass(uintptr_t sizeClass, uintptr_t cellCount) {
 		MM_AtomicOperations::add(&_darkMatterCellCount[sizeClass], cellCount);
@@ -251,6 +274,7 @@ public:
 	MMINLINE uintptr_t getDarkMatterCellCount(uintptr_t sizeClass) { return _darkMatterCellCount[sizeClass]; }
 
 	void joinBucketListsForSplitIndex(MM_EnvironmentBase *env);
+	void joinBucketLists(MM_EnvironmentBase *env);
 	
 	void setSweepScheme(MM_SweepSchemeSegregated *sweepScheme) { _sweepScheme = sweepScheme; }
 
@@ -270,6 +294,7 @@ public:
 		, _largeFullRegions(NULL)
 		, _largeSweepRegions(NULL)
 		, _regionsInUse(0)
+		, _smallSweepsInProgress(0)
 		, _isSweepingSmall(false)
 	{
 		_typeId = __FUNCTION__;
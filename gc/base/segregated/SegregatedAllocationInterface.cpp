@@ -27,6 +27,9 @@
 #include "FrequentObjectsStats.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManager.hpp"
+#include "MemoryPoolAggregatedCellList.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "SizeClasses.hpp"
@@ -130,11 +133,15 @@ MM_SegregatedAllocationInterface::allocateFromCache(MM_EnvironmentBase* env, uin
 	/* Not doing check as (uintptr_t)cellCurrent + cellSize <= (uintptr_t)_allocationCache[sizeClass].top
 	 * to avoid overflow.  See CMVC 194852 for more info.
 	 */
-	if (cellSize <= ((uintptr_t)_allocationCache[sizeClass].top) - ((uintptr_t) cellCurrent)) {
-		_allocationCache[sizeClass].current = (uintptr_t *)((uintptr_t)cellCurrent + cellSize);
-	} else {
-		return NULL;
+	if (cellSize > ((uintptr_t)_allocationCache[sizeClass].top) - ((uintptr_t) cellCurrent)) {
+		if (NULL == _cacheRuns[sizeClass]) {
+			return NULL;
+		}
+		/* The cache is used up, move on to the next run pre-allocated with it (a run holds at least one cell) */
+		useNextCacheRun(env, sizeClass);
+		cellCurrent = _allocationCache[sizeClass].current;
 	}
+	_allocationCache[sizeClass].current = (uintptr_t *)((uintptr_t)cellCurrent + cellSize);
 	return cellCurrent;
 }
 
@@ -262,6 +269,7 @@ MM_SegregatedAllocationInterface::flushCache(MM_EnvironmentBase *env)
 			chunk->setNext(NULL);
 		}
 	}
+	returnCacheRuns(env);
 	memset(_allocationCache, 0, sizeof(LanguageSegregatedAllocationCache));
 	env->getExtensions()->allocationStats.merge(&_stats);
 	_stats.clear();
@@ -329,10 +337,41 @@ MM_SegregatedAllocationInterface::replenishCache(MM_EnvironmentBase* env, uintpt
 		updateFrequentObjectsStats(env, sizeClass);
 	}
 
-	_allocationCache[sizeClass].current = cellLink;
-	_allocationCacheBases[sizeClass] = cellLink;
-	_allocationCache[sizeClass].top = (uintptr_t *)((uintptr_t)cellLink + cacheSize);
-	
+	setCache(sizeClass, cellLink, cacheSize);
+	updateReplenishStats(env, sizeClass, cacheSize);
+}
+
+void
+MM_SegregatedAllocationInterface::replenishCacheWithRuns(MM_EnvironmentBase* env, uintptr_t sizeInBytes, MM_HeapLinkedFreeHeader *runs, uintptr_t cacheSize)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	uintptr_t sizeClass = _sizeClasses->getSizeClass(sizeInBytes);
+
+	Assert_MM_true(_allocationCache[sizeClass].current == _allocationCache[sizeClass].top);
+	Assert_MM_true(NULL == _cacheRuns[sizeClass]);
+	if (extensions->doFrequentObjectAllocationSampling) {
+		updateFrequentObjectsStats(env, sizeClass);
+	}
+
+	_cacheRuns[sizeClass] = runs->getNext();
+	setCache(sizeClass, (uintptr_t *)runs, runs->getSize());
+	/* The whole batch counts as a single replenish */
+	updateReplenishStats(env, sizeClass, cacheSize);
+}
+
+void
+MM_SegregatedAllocationInterface::setCache(uintptr_t sizeClass, uintptr_t *cacheMemory, uintptr_t cacheSize)
+{
+	_allocationCache[sizeClass].current = cacheMemory;
+	_allocationCacheBases[sizeClass] = cacheMemory;
+	_allocationCache[sizeClass].top = (uintptr_t *)((uintptr_t)cacheMemory + cacheSize);
+}
+
+void
+MM_SegregatedAllocationInterface::updateReplenishStats(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t cacheSize)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
 	if (_cachedAllocationsEnabled) {
 		/* Update the allocation stats. */
 		_allocationCacheStats.bytesPreAllocatedTotal[sizeClass] += cacheSize;
@@ -350,6 +389,40 @@ MM_SegregatedAllocationInterface::replenishCache(MM_EnvironmentBase* env, uintpt
 	}
 }
 
+/**
+ * Make the next run pre-allocated with the cache of the given size class the current cache.
+ */
+void
+MM_SegregatedAllocationInterface::useNextCacheRun(MM_EnvironmentBase *env, uintptr_t sizeClass)
+{
+	if (env->getExtensions()->doFrequentObjectAllocationSampling) {
+		updateFrequentObjectsStats(env, sizeClass);
+	}
+
+	MM_HeapLinkedFreeHeader *run = _cacheRuns[sizeClass];
+	_cacheRuns[sizeClass] = run->getNext();
+	setCache(sizeClass, (uintptr_t *)run, run->getSize());
+}
+
+/**
+ * Return the unused runs of every size class to the free lists of their regions.
+ */
+void
+MM_SegregatedAllocationInterface::returnCacheRuns(MM_EnvironmentBase *env)
+{
+	MM_HeapRegionManager *regionManager = env->getExtensions()->getHeap()->getHeapRegionManager();
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		MM_HeapLinkedFreeHeader *run = _cacheRuns[sizeClass];
+		while (NULL != run) {
+			MM_HeapLinkedFreeHeader *nextRun = run->getNext();
+			MM_HeapRegionDescriptorSegregated *region = (MM_HeapRegionDescriptorSegregated *)regionManager->tableDescriptorForAddress(run);
+			region->getMemoryPoolACL()->returnCellRun(env, run);
+			run = nextRun;
+		}
+		_cacheRuns[sizeClass] = NULL;
+	}
+}
+
 uintptr_t
 MM_SegregatedAllocationInterface::getReplenishSize(MM_EnvironmentBase* env, uintptr_t sizeInBytes)
 {
@@ -28,6 +28,7 @@
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+class MM_HeapLinkedFreeHeader;
 class MM_SizeClasses;
 
 typedef struct SegregatedAllocationCacheStats {
@@ -54,6 +55,7 @@ private:
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	
 	uintptr_t *_allocationCacheBases[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The Base of each current cache (per size class). */
+	MM_HeapLinkedFreeHeader *_cacheRuns[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< Runs of cells pre-allocated together with the current cache, each becomes the cache in turn once it is used up (per size class). */
 
 	/*
 	 * Function members
@@ -88,6 +90,17 @@ public:
 	uintptr_t getAllocatableSize(uintptr_t sizeClass) { return (uintptr_t)_allocationCache[sizeClass].top - (uintptr_t)_allocationCache[sizeClass].current; }
 	void* allocateFromCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
 	void replenishCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes, void *cacheMemory, uintptr_t cacheSize);
+
+	/**
+	 * Replenishes the cache for the given size class with a batch of runs of cells linked through their free headers
+	 * (see MM_MemoryPoolAggregatedCellList::preAllocateCellRuns()).  The first run becomes the cache, the others are
+	 * kept and used in turn by allocateFromCache() without going back to the region.  The cache and the runs for the
+	 * size class must be empty.
+	 * @param sizeInBytes The size in bytes of a single cell (ie: not the total of bytes in the cache)
+	 * @param runs The first run
+	 * @param cacheSize The total size of allocatable memory contained in the runs
+	 */
+	void replenishCacheWithRuns(MM_EnvironmentBase* env, uintptr_t sizeInBytes, MM_HeapLinkedFreeHeader *runs, uintptr_t cacheSize);
 	uintptr_t getReplenishSize(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
 	
 	virtual void enableCachedAllocations(MM_EnvironmentBase *env);
@@ -105,10 +118,15 @@ protected:
 	{
 		_typeId = __FUNCTION__;
 		memset(_allocationCacheBases, 0, sizeof(_allocationCacheBases));
+		memset(_cacheRuns, 0, sizeof(_cacheRuns));
 	};
 	
 private:
 	void updateFrequentObjectsStats(MM_EnvironmentBase *env, uintptr_t sizeClass);
+	void setCache(uintptr_t sizeClass, uintptr_t *cacheMemory, uintptr_t cacheSize);
+	void updateReplenishStats(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t cacheSize);
+	void useNextCacheRun(MM_EnvironmentBase *env, uintptr_t sizeClass);
+	void returnCacheRuns(MM_EnvironmentBase *env);
 	
 };
 
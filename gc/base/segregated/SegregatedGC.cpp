@@ -17,6 +17,7 @@
  *******************************************************************************/
 
 #include "CollectionStatisticsStandard.hpp"
+#include "ConcurrentSweeperSegregated.hpp"
 #include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
 #include "GlobalAllocationManagerSegregated.hpp"
@@ -89,6 +90,14 @@ MM_SegregatedGC::initialize(MM_EnvironmentBase *env)
 	}
 
 	_sweepScheme->setClearMarkMapAfterSweep(false);
+
+	if (_extensions->concurrentSweepSegregated) {
+		_concurrentSweeper = MM_ConcurrentSweeperSegregated::newInstance(env, _cli, _sweepScheme);
+		if (NULL == _concurrentSweeper) {
+			return false;
+		}
+		_sweepScheme->setConcurrentSweeper(_concurrentSweeper);
+	}
 	return true;
 }
 
@@ -103,6 +112,11 @@ MM_SegregatedGC::tearDown(MM_EnvironmentBase *env)
 		_markingScheme = NULL;
 	}
 
+	if (NULL != _concurrentSweeper) {
+		_concurrentSweeper->kill(env);
+		_concurrentSweeper = NULL;
+	}
+
 	if(NULL != _sweepScheme) {
 		_sweepScheme->kill(env);
 		_sweepScheme = NULL;
@@ -112,12 +126,19 @@ MM_SegregatedGC::tearDown(MM_EnvironmentBase *env)
 bool
 MM_SegregatedGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress)
 {
+	/* the new regions must not be coalesced by the concurrent sweep while they are being added */
+	if (NULL != _concurrentSweeper) {
+		_concurrentSweeper->pauseSweeping(env);
+	}
 	return _markingScheme->heapAddRange(env, subspace, size, lowAddress, highAddress);
 }
 
 bool
 MM_SegregatedGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
 {
+	if (NULL != _concurrentSweeper) {
+		_concurrentSweeper->pauseSweeping(env);
+	}
 	return _markingScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 }
 
@@ -129,12 +150,29 @@ void MM_SegregatedGC::heapReconfigured(MM_EnvironmentBase* env)
 bool
 MM_SegregatedGC::collectorStartup(MM_GCExtensionsBase* extensions)
 {
+	if (NULL != _concurrentSweeper) {
+		return _concurrentSweeper->startup();
+	}
 	return true;
 }
 
 void
 MM_SegregatedGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+	if (NULL != _concurrentSweeper) {
+		_concurrentSweeper->shutdown();
+	}
+}
+
+void
+MM_SegregatedGC::completeConcurrentSweep(MM_EnvironmentBase *env)
+{
+	_concurrentSweeper->pauseSweeping(env);
+	if (_concurrentSweeper->isArmed()) {
+		MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool(), true);
+		_dispatcher->run(env, &sweepTask);
+		_concurrentSweeper->disarm();
+	}
 }
 
 void *
@@ -185,6 +223,11 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 	MM_MarkStats *markStats = &_extensions->globalGCStats.markStats;
 
+	/* the regions still queued by the last collection have to be swept with its mark map */
+	if (NULL != _concurrentSweeper) {
+		completeConcurrentSweep(env);
+	}
+
 	/* OMRTODO the allocation contexts are never flushed for realtime, do
 	 * we really need to do this here? */
 	/* Flush the allocation contexts */
@@ -214,6 +257,7 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	/* OMRTODO we need to implement this function for segregated marking scheme */
 //	_markingScheme->masterCleanupAfterGC(env);
 	markStats->_endTime = omrtime_hires_clock();
+	_extensions->pauseTimeStats.recordPause(env, OMR_GC_PAUSE_TYPE_MARK, markStats->_startTime, markStats->_endTime);
 	reportMarkEnd(env);
 
 	/*
@@ -222,13 +266,22 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
 	reportSweepStart(env);
 	sweepStats->_startTime = omrtime_hires_clock();
-	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool());
-	_dispatcher->run(env, &sweepTask);
+	MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool();
+	if (NULL != _concurrentSweeper) {
+		/* only queue the regions, they are swept once the mutators have been restarted.  The free space
+		 * statistics used to resize the heap below are those of the previous cycle.
+		 */
+		_sweepScheme->startConcurrentSweep(env, memoryPool);
+	} else {
+		MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, memoryPool);
+		_dispatcher->run(env, &sweepTask);
+	}
 	MM_MemorySubSpace *activeSubSpace = env->_cycleState->_activeSubSpace;
 	bool isExplicitGC = env->_cycleState->_gcCode.isExplicitGC();
 	/* We now have accurate free space statistics so recalculate any expand/contract amount */
 	activeSubSpace->checkResize(env, allocDescription, isExplicitGC);
 	sweepStats->_endTime = omrtime_hires_clock();
+	_extensions->pauseTimeStats.recordPause(env, OMR_GC_PAUSE_TYPE_SWEEP, sweepStats->_startTime, sweepStats->_endTime);
 	reportSweepEnd(env);
 
 	/* Perform the resize now based on expand/contract calculation from checkResize() (above) */
@@ -244,6 +297,12 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 		((MM_SegregatedAllocationInterface *)(walkEnv->_objectAllocationInterface))->restartCache(walkEnv);
 	}
 
+	/* the heap will not be resized again in this collection, so the sweep can proceed in the background */
+	if ((NULL != _concurrentSweeper) && !_concurrentSweeper->startSweeping(env)) {
+		MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, memoryPool, true);
+		_dispatcher->run(env, &sweepTask);
+	}
+
 	return true;
 }
 
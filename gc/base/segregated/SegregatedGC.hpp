@@ -30,6 +30,8 @@
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+class MM_ConcurrentSweeperSegregated;
+
 class MM_SegregatedGC : public MM_GlobalCollector
 {
 	/*
@@ -40,6 +42,7 @@ protected:
 	OMRPortLibrary *_portLibrary;
 	MM_SegregatedMarkingScheme *_markingScheme;
 	MM_SweepSchemeSegregated *_sweepScheme;
+	MM_ConcurrentSweeperSegregated *_concurrentSweeper; /**< Sweeps the heap after a collection when concurrentSweepSegregated is enabled (NULL otherwise) */
 	MM_Dispatcher *_dispatcher;
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
@@ -69,6 +72,12 @@ protected:
 	void reportSweepStart(MM_EnvironmentBase *env);
 	void reportSweepEnd(MM_EnvironmentBase *env);
 
+	/**
+	 * Stop the concurrent sweep of the previous collection and sweep whatever regions it has left.
+	 * Must be called by the master GC thread before the mark map is reused.
+	 */
+	void completeConcurrentSweep(MM_EnvironmentBase *env);
+
 public:
 	static MM_SegregatedGC *newInstance(MM_EnvironmentBase *env, MM_CollectorLanguageInterface *cli);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -115,6 +124,7 @@ public:
 		, _portLibrary(env->getPortLibrary())
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
+		, _concurrentSweeper(NULL)
 		, _dispatcher(_extensions->dispatcher)
 		, _scanBytes(0)
 		, _objectsMarked(0)
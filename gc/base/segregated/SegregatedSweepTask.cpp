@@ -26,7 +26,11 @@
 void
 MM_SegregatedSweepTask::run(MM_EnvironmentBase *env)
 {
-	_sweepScheme->sweep(env, _memoryPool, false);
+	if (_completeConcurrentSweep) {
+		_sweepScheme->completeSweep(env);
+	} else {
+		_sweepScheme->sweep(env, _memoryPool, false);
+	}
 }
 
 void
@@ -33,6 +33,7 @@ protected:
 private:
 	MM_SweepSchemeSegregated *_sweepScheme;
 	MM_MemoryPoolSegregated *_memoryPool;
+	bool _completeConcurrentSweep; /**< Sweep only the regions left over from a concurrent sweep (see MM_SweepSchemeSegregated::completeSweep()) */
 
 /* Methods */
 public:
@@ -43,10 +44,11 @@ public:
 	virtual void setup(MM_EnvironmentBase *env);
 	virtual void cleanup(MM_EnvironmentBase *env);
 	
-	MM_SegregatedSweepTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_SweepSchemeSegregated *sweepScheme, MM_MemoryPoolSegregated *memoryPool)
+	MM_SegregatedSweepTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_SweepSchemeSegregated *sweepScheme, MM_MemoryPoolSegregated *memoryPool, bool completeConcurrentSweep = false)
 		: MM_ParallelTask(env, dispatcher)
 		, _sweepScheme(sweepScheme)
 		, _memoryPool(memoryPool)
+		, _completeConcurrentSweep(completeConcurrentSweep)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -102,7 +102,13 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 		preSweep(env);
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
-	
+
+	completeSweep(env);
+}
+
+void
+MM_SweepSchemeSegregated::completeSweep(MM_EnvironmentBase *env)
+{
 #if defined(OMR_GC_ARRAYLETS)
 	incrementalSweepArraylet(env);
 	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
@@ -126,6 +132,59 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 	}
 }
 
+void
+MM_SweepSchemeSegregated::startConcurrentSweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool)
+{
+	_memoryPool = memoryPool;
+	_isFixHeapForWalk = false;
+
+	preSweep(env);
+
+	/* regions are handed out as they are swept, so allocation has to look in every bucket until the sweep completes */
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	regionPool->setSweepSmallPages(true);
+	regionPool->resetSkipAvailableRegionForAllocation();
+}
+
+uintptr_t
+MM_SweepSchemeSegregated::sweepIncrement(MM_EnvironmentBase *env)
+{
+#if defined(OMR_GC_ARRAYLETS)
+	if (sweepNextArrayletRegion(env)) {
+		return 1;
+	}
+#endif /* OMR_GC_ARRAYLETS */
+	if (sweepNextLargeRegion(env)) {
+		return 1;
+	}
+
+	/* take the size classes in turn so that swept regions of every size class become available early */
+	for (uintptr_t i = OMR_SIZECLASSES_MIN_SMALL; i <= OMR_SIZECLASSES_MAX_SMALL; i++) {
+		uintptr_t sizeClass = _nextConcurrentSweepSizeClass;
+		_nextConcurrentSweepSizeClass = (OMR_SIZECLASSES_MAX_SMALL == sizeClass) ? OMR_SIZECLASSES_MIN_SMALL : (sizeClass + 1);
+		uintptr_t regionsSwept = sweepSmallRegions(env, sizeClass);
+		if (0 != regionsSwept) {
+			return regionsSwept;
+		}
+	}
+	return 0;
+}
+
+void
+MM_SweepSchemeSegregated::finishConcurrentSweep(MM_EnvironmentBase *env)
+{
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	/* the sweep queues are empty, but allocating threads may still be returning the empty regions they swept to the
+	 * free lists, and a free region which is on none of the lists must not be found by the coalescing
+	 */
+	while (0 != regionPool->getSmallSweepsInProgress()) {
+		omrthread_yield();
+	}
+	regionPool->joinBucketLists(env);
+	regionPool->setSweepSmallPages(false);
+	postSweep(env);
+}
+
 void
 MM_SweepSchemeSegregated::preSweep(MM_EnvironmentBase *env)
 {
@@ -406,8 +465,8 @@ MM_SweepSchemeSegregated::incrementalCoalesceFreeRegions(MM_EnvironmentBase *env
 		bool shouldYield = updateCoalesceFreeRegionCount(range);
 		bool shouldClose = shouldYield || (i >= regionCount);
 		
-		if (currentRegion->isFree()) {
-			coalesceFreeList->detach(currentRegion);
+		/* the check and the detach are made atomically, free regions may be allocated concurrently after a concurrent sweep */
+		if (coalesceFreeList->detachIfFree(currentRegion)) {
 			bool joined = (range < MAX_REGION_COALESCE) && (coalescing != NULL && coalescing->joinFreeRangeInit(currentRegion));
 			if (joined) {
 				currentRegion = NULL;
@@ -446,45 +505,55 @@ void
 MM_SweepSchemeSegregated::incrementalSweepLarge(MM_EnvironmentBase *env)
 {
 	/* Sweep through large objects. */
+	while (sweepNextLargeRegion(env)) {
+		yieldFromSweep(env);
+	}
+}
+
+bool
+MM_SweepSchemeSegregated::sweepNextLargeRegion(MM_EnvironmentBase *env)
+{
 	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
-	MM_HeapRegionQueue *largeSweepRegions = regionPool->getLargeSweepRegions();
-	MM_HeapRegionQueue *largeFullRegions = regionPool->getLargeFullRegions();
-	MM_HeapRegionDescriptorSegregated *currentRegion;
-	while ((currentRegion = largeSweepRegions->dequeue()) != NULL) {
+	MM_HeapRegionDescriptorSegregated *currentRegion = regionPool->getLargeSweepRegions()->dequeue();
+	if (NULL != currentRegion) {
 		sweepRegion(env, currentRegion);
 		
 		if (currentRegion->getMemoryPoolACL()->getFreeCount() == 0) {
-			largeFullRegions->enqueue(currentRegion);
+			regionPool->getLargeFullRegions()->enqueue(currentRegion);
 		} else {
 			currentRegion->emptyRegionReturned(env);
 			regionPool->addFreeRegion(env, currentRegion);
 		}
-		yieldFromSweep(env);
 	}
+	return NULL != currentRegion;
 }
 
 void
 MM_SweepSchemeSegregated::incrementalSweepArraylet(MM_EnvironmentBase *env)
+{
+	while (sweepNextArrayletRegion(env)) {
+		yieldFromSweep(env);
+	}
+}
+
+bool
+MM_SweepSchemeSegregated::sweepNextArrayletRegion(MM_EnvironmentBase *env)
 {
 	uintptr_t arrayletsPerRegion = env->getExtensions()->arrayletsPerRegion;
 
 	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
-	MM_HeapRegionQueue *arrayletSweepRegions = regionPool->getArrayletSweepRegions();
-	MM_HeapRegionQueue *arrayletAvailableRegions = regionPool->getArrayletAvailableRegions();
-	MM_HeapRegionDescriptorSegregated *currentRegion;
-	
-	while ((currentRegion = arrayletSweepRegions->dequeue()) != NULL) {
+	MM_HeapRegionDescriptorSegregated *currentRegion = regionPool->getArrayletSweepRegions()->dequeue();
+	if (NULL != currentRegion) {
 		sweepRegion(env, currentRegion);
 		
 		if (currentRegion->getMemoryPoolACL()->getFreeCount() != arrayletsPerRegion) {
-			arrayletAvailableRegions->enqueue(currentRegion);
+			regionPool->getArrayletAvailableRegions()->enqueue(currentRegion);
 		} else {
 			currentRegion->emptyRegionReturned(env);
 			regionPool->addFreeRegion(env, currentRegion);
 		}
-		
-		yieldFromSweep(env);
 	}
+	return NULL != currentRegion;
 }
 
 uintptr_t
@@ -502,10 +571,7 @@ MM_SweepSchemeSegregated::updateSweepSmallRegionCount()
 void
 MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 {
-	MM_GCExtensionsBase *ext = env->getExtensions();
-	bool shouldUpdateOccupancy = ext->nonDeterministicSweep;
 	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
-	uintptr_t splitIndex = env->getSlaveID() % (regionPool->getSplitAvailableListSplitCount());
 
 	/* 
 	 * Iterate through the regions so that each region is processed exactly once.
@@ -516,7 +582,6 @@ MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 	 * If a region holds a marked object, then the region is kept active; 
 	 * if a region contains no marked objects, then it can be returned to a free list.
 	 */
-	MM_SizeClasses *sizeClasses = ext->defaultSizeClasses;
 	while (regionPool->getCurrentTotalCountOfSweepRegions()) {
 		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 			while (regionPool->getCurrentCountOfSweepRegions(sizeClass)) {
@@ -527,50 +592,64 @@ MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 					break;
 				}
 				
-				MM_HeapRegionQueue *sweepList = regionPool->getSmallSweepRegions(sizeClass);
-				MM_HeapRegionDescriptorSegregated *currentRegion;
-				uintptr_t numCells = sizeClasses->getNumCells(sizeClass);
-				uintptr_t sweepSmallRegionsPerIteration = calcSweepSmallRegionsPerIteration(numCells);
-				uintptr_t yieldSlackTime = resetSweepSmallRegionCount(env, sweepSmallRegionsPerIteration);
-				uintptr_t actualSweepRegions;
-				if ((actualSweepRegions = sweepList->dequeue(env->getRegionWorkList(), sweepSmallRegionsPerIteration)) > 0) {
-					regionPool->decrementCurrentCountOfSweepRegions(sizeClass, actualSweepRegions);
-					regionPool->decrementCurrentTotalCountOfSweepRegions(actualSweepRegions);
-					uintptr_t freedRegions = 0, processedRegions = 0;
-					MM_HeapRegionQueue *fullList = env->getRegionLocalFull();
-					while ((currentRegion = env->getRegionWorkList()->dequeue()) != NULL) {
-						sweepRegion(env, currentRegion);
-						if (currentRegion->getMemoryPoolACL()->getFreeCount() < numCells) {
-							uintptr_t occupancy = (currentRegion->getMemoryPoolACL()->getMarkCount() * 100) / numCells;
-							/* Maintain average occupancy needed for nondeterministic sweep heuristic */
-							if (shouldUpdateOccupancy) {
-								regionPool->updateOccupancy(sizeClass, occupancy);
-							}
-							if (currentRegion->getMemoryPoolACL()->getMarkCount() == numCells) {
-								/* Return full regions to full list */
-								fullList->enqueue(currentRegion);
-							} else {
-								regionPool->enqueueAvailable(currentRegion, sizeClass, occupancy, splitIndex);
-							}
-						} else {
-							currentRegion->emptyRegionReturned(env);
-							currentRegion->setFree(1);
-							env->getRegionLocalFree()->enqueue(currentRegion);
-							freedRegions++;
-						}
-						processedRegions++;
-						
-						if (updateSweepSmallRegionCount()) {
-							yieldFromSweep(env, yieldSlackTime);
-						}
-					}
-					regionPool->addSingleFree(env, env->getRegionLocalFree());				
-					regionPool->getSmallFullRegions(sizeClass)->enqueue(fullList);
-					yieldFromSweep(env, yieldSlackTime);
-				}
+				sweepSmallRegions(env, sizeClass);
 			} /* end of while(currentTotalCountOfSweepRegions); */
 		}
 	}
 }
 
+uintptr_t
+MM_SweepSchemeSegregated::sweepSmallRegions(MM_EnvironmentBase *env, uintptr_t sizeClass)
+{
+	MM_GCExtensionsBase *ext = env->getExtensions();
+	bool shouldUpdateOccupancy = ext->nonDeterministicSweep;
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	uintptr_t splitIndex = env->getSlaveID() % (regionPool->getSplitAvailableListSplitCount());
+
+	MM_HeapRegionQueue *sweepList = regionPool->getSmallSweepRegions(sizeClass);
+	MM_HeapRegionDescriptorSegregated *currentRegion;
+	uintptr_t numCells = ext->defaultSizeClasses->getNumCells(sizeClass);
+	uintptr_t sweepSmallRegionsPerIteration = calcSweepSmallRegionsPerIteration(numCells);
+	uintptr_t yieldSlackTime = resetSweepSmallRegionCount(env, sweepSmallRegionsPerIteration);
+	uintptr_t actualSweepRegions;
+	regionPool->startSmallSweep();
+	if ((actualSweepRegions = sweepList->dequeue(env->getRegionWorkList(), sweepSmallRegionsPerIteration)) > 0) {
+		regionPool->decrementCurrentCountOfSweepRegions(sizeClass, actualSweepRegions);
+		regionPool->decrementCurrentTotalCountOfSweepRegions(actualSweepRegions);
+		uintptr_t freedRegions = 0, processedRegions = 0;
+		MM_HeapRegionQueue *fullList = env->getRegionLocalFull();
+		while ((currentRegion = env->getRegionWorkList()->dequeue()) != NULL) {
+			sweepRegion(env, currentRegion);
+			if (currentRegion->getMemoryPoolACL()->getFreeCount() < numCells) {
+				uintptr_t occupancy = (currentRegion->getMemoryPoolACL()->getMarkCount() * 100) / numCells;
+				/* Maintain average occupancy needed for nondeterministic sweep heuristic */
+				if (shouldUpdateOccupancy) {
+					regionPool->updateOccupancy(sizeClass, occupancy);
+				}
+				if (currentRegion->getMemoryPoolACL()->getMarkCount() == numCells) {
+					/* Return full regions to full list */
+					fullList->enqueue(currentRegion);
+				} else {
+					regionPool->enqueueAvailable(currentRegion, sizeClass, occupancy, splitIndex);
+				}
+			} else {
+				currentRegion->emptyRegionReturned(env);
+				currentRegion->setFree(1);
+				env->getRegionLocalFree()->enqueue(currentRegion);
+				freedRegions++;
+			}
+			processedRegions++;
+			
+			if (updateSweepSmallRegionCount()) {
+				yieldFromSweep(env, yieldSlackTime);
+			}
+		}
+		regionPool->addSingleFree(env, env->getRegionLocalFree());				
+		regionPool->getSmallFullRegions(sizeClass)->enqueue(fullList);
+		yieldFromSweep(env, yieldSlackTime);
+	}
+	regionPool->endSmallSweep();
+	return actualSweepRegions;
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -34,6 +34,7 @@
 class MM_EnvironmentBase;
 class MM_EnvironmentRealtime;
 class MM_HeapRegionDescriptorSegregated;
+class MM_ConcurrentSweeperSegregated;
 class MM_MarkMap;
 class MM_MemoryPoolSegregated;
 
@@ -49,6 +50,8 @@ protected:
 private:
 	bool _isFixHeapForWalk;
 	bool _clearMarkMapAfterSweep; /**< If a region should be unmarked after it is swept */
+	MM_ConcurrentSweeperSegregated *_concurrentSweeper; /**< Background sweeper, or NULL if regions are swept in the pause */
+	uintptr_t _nextConcurrentSweepSizeClass; /**< Size class sweepIncrement() takes small regions from first */
 
 	/*
 	 * Function members
@@ -60,6 +63,37 @@ public:
 	MM_MarkMap *getMarkMap(MM_EnvironmentBase * env);
 
 	void sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool, bool isFixHeapForWalk);
+
+	/**
+	 * Sweep every region still queued for sweeping and coalesce the free regions.  Called by all threads of a
+	 * sweep task, as the second half of sweep() or to finish a sweep started by startConcurrentSweep().
+	 */
+	void completeSweep(MM_EnvironmentBase *env);
+
+	/**
+	 * Queue every region in use for sweeping without sweeping any of them.  The regions are then swept by
+	 * allocating threads on demand and by the background sweeper (sweepIncrement()), and whatever is left
+	 * when the next collection starts is swept by completeSweep().
+	 * Called by the master GC thread at the end of marking.
+	 */
+	void startConcurrentSweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool);
+
+	/**
+	 * Sweep the next queued arraylet or large region, or a batch of queued small regions.  May run concurrently
+	 * with the mutators and with on demand sweeping of small regions, but not with another call.
+	 * @return the number of regions swept, 0 if no region is left to sweep
+	 */
+	uintptr_t sweepIncrement(MM_EnvironmentBase *env);
+
+	/**
+	 * Join the available lists and coalesce the free regions once sweepIncrement() has swept every region.
+	 * May run concurrently with the mutators.
+	 */
+	void finishConcurrentSweep(MM_EnvironmentBase *env);
+
+	MMINLINE MM_ConcurrentSweeperSegregated *getConcurrentSweeper() { return _concurrentSweeper; }
+	MMINLINE void setConcurrentSweeper(MM_ConcurrentSweeperSegregated *concurrentSweeper) { _concurrentSweeper = concurrentSweeper; }
+
 	virtual void sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 
 	bool isClearMarkMapAfterSweep() { return _clearMarkMapAfterSweep; }
@@ -82,6 +116,8 @@ protected:
 		,_markMap(markMap)
 		,_isFixHeapForWalk(false)
 		,_clearMarkMapAfterSweep(true)
+		,_concurrentSweeper(NULL)
+		,_nextConcurrentSweepSizeClass(OMR_SIZECLASSES_MIN_SMALL)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -96,6 +132,24 @@ private:
 	void addBytesFreedAfterSweep(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 	void incrementalSweepSmall(MM_EnvironmentBase *env);
 	void incrementalSweepLarge(MM_EnvironmentBase *env);
+
+	/**
+	 * Sweep a batch of the queued small regions of the given size class.
+	 * @return the number of regions swept
+	 */
+	uintptr_t sweepSmallRegions(MM_EnvironmentBase *env, uintptr_t sizeClass);
+
+	/**
+	 * Sweep the next queued large region.
+	 * @return false if there was no region to sweep
+	 */
+	bool sweepNextLargeRegion(MM_EnvironmentBase *env);
+
+	/**
+	 * Sweep the next queued arraylet region.
+	 * @return false if there was no region to sweep
+	 */
+	bool sweepNextArrayletRegion(MM_EnvironmentBase *env);
 	void incrementalCoalesceFreeRegions(MM_EnvironmentBase *env);
 
 	MMINLINE bool addFreeChunk(MM_MemoryPoolAggregatedCellList *memoryPoolACL, uintptr_t *freeChunk, uintptr_t freeChunkSize, uintptr_t minimumFreeEntrySize, uintptr_t freeChunkCellCount)
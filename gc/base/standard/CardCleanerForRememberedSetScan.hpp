@@ -0,0 +1,91 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(CARDCLEANERFORREMEMBEREDSETSCAN_HPP_)
+#define CARDCLEANERFORREMEMBEREDSETSCAN_HPP_
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "CardCleaner.hpp"
+#include "ConcurrentGC.hpp"
+#include "EnvironmentStandard.hpp"
+#include "HeapMapIterator.hpp"
+#include "RememberedSetCardTable.hpp"
+
+/**
+ * Visits the dirty cards of the scavenger's remembered set card table to rescan the remembered
+ * objects at the end of a concurrent mark.  Cards are left dirty.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_CardCleanerForRememberedSetScan : public MM_CardCleaner
+{
+public:
+protected:
+private:
+	MM_ConcurrentGC *_collector;
+	MM_RememberedSetCardTable *_rememberedSetCardTable;
+	uintptr_t _maxPushes; /**< number of references pushed after which the work stack is drained */
+	uintptr_t _rememberedObjectsScanned; /**< remembered objects rescanned by this thread */
+	uintptr_t _bytesTraced; /**< bytes traced by this thread */
+
+public:
+	MMINLINE uintptr_t getRememberedObjectsScanned() { return _rememberedObjectsScanned; }
+	MMINLINE uintptr_t getBytesTraced() { return _bytesTraced; }
+
+protected:
+	/**
+	 * @see MM_CardCleaner::clean()
+	 */
+	virtual void clean(MM_EnvironmentBase *envModron, void *lowAddress, void *highAddress, Card *cardToClean)
+	{
+		MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envModron);
+		MM_HeapMapIterator rememberedObjectIterator(env->getExtensions(), _rememberedSetCardTable->getRememberedObjectMap(), (uintptr_t *)lowAddress, (uintptr_t *)highAddress, false);
+		omrobjectptr_t objectPtr = NULL;
+		while (NULL != (objectPtr = rememberedObjectIterator.nextObject())) {
+			_collector->scanRememberedObject(env, objectPtr, _maxPushes, &_rememberedObjectsScanned, &_bytesTraced);
+		}
+	}
+
+	/**
+	 * @see MM_CardCleaner::getVMStateID()
+	 */
+	virtual uintptr_t getVMStateID() { return J9VMSTATE_GC_CONCURRENT_MARK_SCAN_REMEMBERED_SET; }
+
+public:
+	/**
+	 * Create a CardCleaner object used by one thread of the remembered set scan
+	 */
+	MM_CardCleanerForRememberedSetScan(MM_ConcurrentGC *collector, MM_RememberedSetCardTable *rememberedSetCardTable, uintptr_t maxPushes)
+		: MM_CardCleaner()
+		, _collector(collector)
+		, _rememberedSetCardTable(rememberedSetCardTable)
+		, _maxPushes(maxPushes)
+		, _rememberedObjectsScanned(0)
+		, _bytesTraced(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+private:
+};
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_MODRON_SCAVENGER) */
+
+#endif /* CARDCLEANERFORREMEMBEREDSETSCAN_HPP_ */
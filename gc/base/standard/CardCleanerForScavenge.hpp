@@ -0,0 +1,95 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(CARDCLEANERFORSCAVENGE_HPP_)
+#define CARDCLEANERFORSCAVENGE_HPP_
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "CardCleaner.hpp"
+#include "EnvironmentStandard.hpp"
+#include "Scavenger.hpp"
+
+/**
+ * Visits the dirty cards of the scavenger's remembered set card table (see MM_RememberedSetCardTable).
+ * @ingroup GC_Modron_Standard
+ */
+class MM_CardCleanerForScavenge : public MM_CardCleaner
+{
+public:
+	/**
+	 * The scavenge phase the cards are visited for.
+	 */
+	enum Phase {
+		scavenge = 0, /**< scavenge the remembered objects; cards are left dirty */
+		prune, /**< forget objects which no longer need remembering and clean cards left with none */
+		backOut /**< back out remembered objects after a failed scavenge; cards are left dirty */
+	};
+
+protected:
+private:
+	MM_Scavenger *_scavenger;
+	Phase _phase;
+
+public:
+protected:
+	/**
+	 * @see MM_CardCleaner::clean()
+	 */
+	virtual void clean(MM_EnvironmentBase *envModron, void *lowAddress, void *highAddress, Card *cardToClean)
+	{
+		MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envModron);
+
+		switch (_phase) {
+		case scavenge:
+			_scavenger->scavengeRememberedSetCard(env, lowAddress, highAddress);
+			break;
+		case prune:
+			_scavenger->pruneRememberedSetCard(env, lowAddress, highAddress, cardToClean);
+			break;
+		case backOut:
+			_scavenger->backOutRememberedSetCard(env, lowAddress, highAddress);
+			break;
+		}
+	}
+
+	/**
+	 * @see MM_CardCleaner::getVMStateID()
+	 */
+	virtual uintptr_t getVMStateID() { return J9VMSTATE_GC_SCAVENGE; }
+
+public:
+	/**
+	 * Create a CardCleaner object for the given phase of a scavenge
+	 */
+	MM_CardCleanerForScavenge(MM_Scavenger *scavenger, Phase phase)
+		: MM_CardCleaner()
+		, _scavenger(scavenger)
+		, _phase(phase)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+private:
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+#endif /* CARDCLEANERFORSCAVENGE_HPP_ */
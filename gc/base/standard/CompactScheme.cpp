@@ -44,6 +44,7 @@
 #include "HeapStats.hpp"
 #include "MarkingScheme.hpp"
 #include "MarkMap.hpp"
+#include "Math.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -52,8 +53,10 @@
 #include "ParallelSweepScheme.hpp"
 #include "ParallelTask.hpp"
 #include "SlotObject.hpp"
+#include "SublistIterator.hpp"
 #include "SublistPool.hpp"
 #include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
 #include "SweepHeapSectioning.hpp"
 
 /* OMRTODO temporary workaround to allow both ut_j9mm.h and ut_omrmm.h to be included.
@@ -63,6 +66,8 @@
 #undef UT_MODULE_UNLOADED
 #include "ut_omrmm.h"
 
+/* Number of yields before a sliding thread blocks on a block it must not overwrite yet */
+#define SLIDING_BLOCK_SPIN_COUNT 64
 
 /**
  * Allocate and initialize a new instance of the receiver.
@@ -273,13 +278,54 @@ public:
 bool
 MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 {
+	if (_extensions->slidingCompaction) {
+		if (0 != omrthread_monitor_init_with_name(&_slidingBlockMonitor, 0, "MM_CompactScheme::slidingBlockMonitor")) {
+			return false;
+		}
+	}
+	if ((0 != _extensions->partialCompactAreaCount) && !_extensions->collectorLanguageInterface->compactScheme_supportsPartialCompaction()) {
+		/* Without the language's remembered set a partial compaction would leave references into the evacuated areas */
+		_extensions->partialCompactAreaCount = 0;
+	}
+	if (0 != _extensions->partialCompactAreaCount) {
+		/* Areas are never smaller than DESIRED_SUBAREA_SIZE, so this covers the maximum heap */
+		_partialCompactAreaTableSize = (_extensions->heap->getMaximumPhysicalRange() >> MM_Math::floorLog2(DESIRED_SUBAREA_SIZE)) + 1;
+		_partialCompactAreaTable = (uint8_t *)env->getForge()->allocate(_partialCompactAreaTableSize * sizeof(uint8_t), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _partialCompactAreaTable) {
+			return false;
+		}
+		_partialCompactAreaScores = (uintptr_t *)env->getForge()->allocate(_partialCompactAreaTableSize * sizeof(uintptr_t), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _partialCompactAreaScores) {
+			return false;
+		}
+		if (!_partialCompactRememberedSet.initialize(env, MM_AllocationCategory::REMEMBERED_SET)) {
+			return false;
+		}
+		_partialCompactRememberedSet.setGrowSize(J9_SCV_REMSET_SIZE);
+	}
 	return true;
 }
 
 void
 MM_CompactScheme::tearDown(MM_EnvironmentBase *env)
 {
-	/* Do nothing */
+	if (NULL != _slidingBlockTable) {
+		env->getForge()->free(_slidingBlockTable);
+		_slidingBlockTable = NULL;
+	}
+	if (NULL != _slidingBlockMonitor) {
+		omrthread_monitor_destroy(_slidingBlockMonitor);
+		_slidingBlockMonitor = NULL;
+	}
+	if (NULL != _partialCompactAreaTable) {
+		env->getForge()->free(_partialCompactAreaTable);
+		_partialCompactAreaTable = NULL;
+	}
+	if (NULL != _partialCompactAreaScores) {
+		env->getForge()->free(_partialCompactAreaScores);
+		_partialCompactAreaScores = NULL;
+	}
+	_partialCompactRememberedSet.tearDown(env);
 }
 
 /**
@@ -362,17 +408,18 @@ MM_CompactScheme::freeChunkEnd(omrobjectptr_t chunk)
 }
 
 /**
- *  Create sub areas table for regions.
+ * Determine the size of the sub areas, so that the sub areas of all committed regions fit the
+ * backing store shared with the sweep heap sectioning.
  */
-void
-MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded)
+uintptr_t
+MM_CompactScheme::getSubAreaSize(MM_EnvironmentBase *env)
 {
 	/* finding whether there are memory limitations */
-	uintptr_t max_subarea_num = _subAreaTableSize / sizeof(_subAreaTable[0]);
+	uintptr_t max_subarea_num = _extensions->sweepHeapSectioning->getBackingStoreSize() / sizeof(SubAreaEntry);
 	uintptr_t necessary_subareas = 0;
 	uintptr_t min_subarea_size;
 
-	GC_HeapRegionIteratorStandard regionCounter(_rootManager);
+	GC_HeapRegionIteratorStandard regionCounter(_extensions->heap->getHeapRegionManager());
 	MM_HeapRegionDescriptorStandard *region = NULL;
 	uintptr_t number_of_regions = 0;
 	while(NULL != (region = regionCounter.nextRegion())) {
@@ -386,12 +433,28 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 	Assert_MM_true(max_subarea_num > 0);
 
 	if(max_subarea_num > necessary_subareas) {
-		min_subarea_size = _heap->getMaximumPhysicalRange() / (max_subarea_num - necessary_subareas);
+		min_subarea_size = _extensions->heap->getMaximumPhysicalRange() / (max_subarea_num - necessary_subareas);
 	} else {
-		min_subarea_size = _heap->getMaximumPhysicalRange();
+		min_subarea_size = _extensions->heap->getMaximumPhysicalRange();
 	}
-	uintptr_t size = (DESIRED_SUBAREA_SIZE >= min_subarea_size) ?  DESIRED_SUBAREA_SIZE : min_subarea_size;
+	return (DESIRED_SUBAREA_SIZE >= min_subarea_size) ?  DESIRED_SUBAREA_SIZE : min_subarea_size;
+}
+
+/**
+ *  Create sub areas table for regions.
+ */
+void
+MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded)
+{
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	uintptr_t size = 0;
 
+	if (_partialCompaction) {
+		/* Sub areas match the areas selected before marking, so that each is either evacuated or only fixed up */
+		size = (uintptr_t)1 << _partialCompactAreaShift;
+	} else {
+		size = getSubAreaSize(env);
+	}
 
 	/* Single threaded pass to set tentative sub area limits tentative limits are
 	 * listed in freeChunk field. This field will be reset during the third pass.
@@ -409,21 +472,33 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 			MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
 			intptr_t state = SubAreaEntry::init;
 
-			if (singleThreaded) {
-				size = areaSize;
-			}
 			_subAreaTable[i].firstObject = (omrobjectptr_t)lowAddress;
 
-			/* Calculate number of sub areas..take care to avoid overflow if size is large */
-			uintptr_t numSubAreas = ((areaSize - 1) / size) + 1;
+			if (_partialCompaction) {
+				uint8_t *p = (uint8_t *)lowAddress;
+				while (p < (uint8_t *)highAddress) {
+					_subAreaTable[i].freeChunk = (omrobjectptr_t)p;
+					_subAreaTable[i].memoryPool = memorySubSpace->getMemoryPool(p);
+					_subAreaTable[i].state = (0 != _partialCompactAreaTable[partialCompactAreaIndex(p)]) ? SubAreaEntry::init : SubAreaEntry::fixup_only;
+					_subAreaTable[i++].currentAction = SubAreaEntry::none;
+					p = (uint8_t *)MM_Math::roundToFloor(size, (uintptr_t)p - _partialCompactAreaBase) + _partialCompactAreaBase + size;
+				}
+			} else {
+				if (singleThreaded) {
+					size = areaSize;
+				}
+
+				/* Calculate number of sub areas..take care to avoid overflow if size is large */
+				uintptr_t numSubAreas = ((areaSize - 1) / size) + 1;
 
-			for( uintptr_t subAreaNum=0; subAreaNum < numSubAreas; subAreaNum++){
-				uint8_t *p = (uint8_t*)(((uintptr_t)lowAddress) + (subAreaNum * size));
+				for( uintptr_t subAreaNum=0; subAreaNum < numSubAreas; subAreaNum++){
+					uint8_t *p = (uint8_t*)(((uintptr_t)lowAddress) + (subAreaNum * size));
 
-				_subAreaTable[i].freeChunk = (omrobjectptr_t)p;
-				_subAreaTable[i].memoryPool = memorySubSpace->getMemoryPool(p);
-				_subAreaTable[i].state = state;
-				_subAreaTable[i++].currentAction = SubAreaEntry::none;
+					_subAreaTable[i].freeChunk = (omrobjectptr_t)p;
+					_subAreaTable[i].memoryPool = memorySubSpace->getMemoryPool(p);
+					_subAreaTable[i].state = state;
+					_subAreaTable[i++].currentAction = SubAreaEntry::none;
+				}
 			}
 			_subAreaTable[i].freeChunk = (omrobjectptr_t)highAddress;
 			_subAreaTable[i].memoryPool = NULL;
@@ -431,6 +506,7 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 			_subAreaTable[i].state = SubAreaEntry::end_segment;
 			_subAreaTable[i++].currentAction = SubAreaEntry::none;
 		}
+		Assert_MM_true(i < (_subAreaTableSize / sizeof(_subAreaTable[0])));
 		_subAreaTable[i].state = SubAreaEntry::end_heap;
 
 		env->_currentTask->releaseSynchronizedGCThreads(env);
@@ -506,13 +582,30 @@ MM_CompactScheme::completeSubAreaTable(MM_EnvironmentStandard *env)
 		 * rebuild of free list at end of compaction
 		 */
 		GC_HeapRegionIteratorStandard regionIterator2(_rootManager);
-		while(NULL != (region = regionIterator2.nextRegion())) {
-			if (!region->isCommitted()) {
-				continue;
+		if (_partialCompaction) {
+			/* Only the free entries of the evacuated sub areas are rebuilt, the rest of the free lists stay valid */
+			SubAreaEntry *subAreaTable = _subAreaTable;
+			while(NULL != (region = regionIterator2.nextRegion())) {
+				if (!region->isCommitted()) {
+					continue;
+				}
+				intptr_t i;
+				for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+					if (SubAreaEntry::init == subAreaTable[i].state) {
+						detachFreeEntriesForPartialCompact(env, region->getSubSpace(), subAreaTable[i].firstObject, subAreaTable[i + 1].firstObject);
+					}
+				}
+				subAreaTable += (i + 1);
+			}
+		} else {
+			while(NULL != (region = regionIterator2.nextRegion())) {
+				if (!region->isCommitted()) {
+					continue;
+				}
+				MM_MemorySubSpace *subspace = region->getSubSpace();
+				MM_MemoryPool *memoryPool = subspace->getMemoryPool();
+				memoryPool->reset(MM_MemoryPool::forCompact);
 			}
-			MM_MemorySubSpace *subspace = region->getSubSpace();
-			MM_MemoryPool *memoryPool = subspace->getMemoryPool();
-			memoryPool->reset(MM_MemoryPool::forCompact);
 		}
 
 		env->_currentTask->releaseSynchronizedGCThreads(env);
@@ -540,52 +633,107 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		_extensions->collectorLanguageInterface->compactScheme_verifyHeap(env, _markMap);
 #endif /* DEBUG */
 
-		/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
-		_extensions->heap->resetLargestFreeEntry();
+		/* A partial compaction is only sound if every object outside the selected areas which refers
+		 * into them was remembered while marking.  Aggressive compactions and contractions need the
+		 * whole heap compacted, so they fall back to a full compaction.
+		 */
+		_partialCompaction = _markingScheme->isPartialCompactArmed()
+			&& !_markingScheme->hasPartialCompactRememberedSetOverflowed()
+			&& !aggressive
+			&& (COMPACT_CONTRACT != _extensions->globalGCStats.compactStats._compactReason);
+
+		if (_partialCompaction) {
+			env->_compactStats._partialCompactAreas = _partialCompactAreaCount;
+		} else {
+			/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
+			_extensions->heap->resetLargestFreeEntry();
+		}
+
+		/* Sliding compaction renames objects on every GC thread, so leave compactions which must
+		 * report J9HOOK_MM_OMR_OBJECT_RENAME events on the master thread to the sub area mode.
+		 */
+		_slidingCompaction = _extensions->slidingCompaction
+			&& !_partialCompaction
+			&& !J9_EVENT_IS_HOOKED(_extensions->omrHookInterface, J9HOOK_MM_OMR_OBJECT_RENAME)
+			&& createSlidingBlockTable(env);
 
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
-	/* We force a single sub area compaction if:
-	 *  o the compaction is aggressive. We use a single sub area per segment to avoid potentially having
-	 *    multiple holes created per segment, thereby fragmenting the space. This will result in
-	 *    singlethreaded compaction per segment, and so should only be done in extreme OOM situations.
-	 *  o no slave GC threads
-	 *  o the J9HOOK_MM_OMR_OBJECT_RENAME hook has registered users. JVMPI does not support events being issued
-	 * 	  in parallel so we force single sub area compact to ensure all events issued under master GC thread.
-	 */
-	if (aggressive ||
-		1 == env->_currentTask->getThreadCount() ||
-		J9_EVENT_IS_HOOKED(_extensions->omrHookInterface, J9HOOK_MM_OMR_OBJECT_RENAME)) {
-		singleThreaded = true;
+	if (_slidingCompaction) {
+		env->_compactStats._summaryStartTime = omrtime_hires_clock();
+		summarizeSlidingBlocks(env);
+
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+			if (_slidingCompactionAborted) {
+				/* The mark map is still intact, so the sub area mode can take over */
+				freeSlidingBlockTable(env);
+				_slidingCompaction = false;
+			} else {
+				computeSlidingDestinations(env);
+			}
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+		env->_compactStats._summaryEndTime = omrtime_hires_clock();
 	}
 
-	env->_compactStats._setupStartTime = omrtime_hires_clock();
-	workerSetupForGC(env, singleThreaded);
-	env->_compactStats._setupEndTime = omrtime_hires_clock();
+	if (_slidingCompaction) {
+		env->_compactStats._slidingCompaction = true;
 
-	/* If a single threaded compaction force compact to run on master thread. Required
-	 * to ensure all events issued on master thread.
-	 */
-	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
 		env->_compactStats._moveStartTime = omrtime_hires_clock();
-		moveObjects(env, objectCount, byteCount, skippedObjectCount);
+		slideObjects(env, objectCount, byteCount);
 		env->_compactStats._moveEndTime = omrtime_hires_clock();
 
-		if (!singleThreaded) {
-			env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
-			MM_AtomicOperations::sync();
-		}
+		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+		MM_AtomicOperations::sync();
 
 		env->_compactStats._fixupStartTime = omrtime_hires_clock();
+		fixupSlidObjects(env, fixupObjectsCount);
+		env->_compactStats._fixupEndTime = omrtime_hires_clock();
+	} else {
+		/* We force a single sub area compaction if:
+		 *  o the compaction is aggressive. We use a single sub area per segment to avoid potentially having
+		 *    multiple holes created per segment, thereby fragmenting the space. This will result in
+		 *    singlethreaded compaction per segment, and so should only be done in extreme OOM situations.
+		 *  o no slave GC threads
+		 *  o the J9HOOK_MM_OMR_OBJECT_RENAME hook has registered users. JVMPI does not support events being issued
+		 * 	  in parallel so we force single sub area compact to ensure all events issued under master GC thread.
+		 */
+		if (aggressive ||
+			1 == env->_currentTask->getThreadCount() ||
+			J9_EVENT_IS_HOOKED(_extensions->omrHookInterface, J9HOOK_MM_OMR_OBJECT_RENAME)) {
+			singleThreaded = true;
+		}
 
-		fixupObjects(env, fixupObjectsCount);
+		env->_compactStats._setupStartTime = omrtime_hires_clock();
+		workerSetupForGC(env, singleThreaded);
+		env->_compactStats._setupEndTime = omrtime_hires_clock();
 
+		/* If a single threaded compaction force compact to run on master thread. Required
+		 * to ensure all events issued on master thread.
+		 */
+		if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+			env->_compactStats._moveStartTime = omrtime_hires_clock();
+			moveObjects(env, objectCount, byteCount, skippedObjectCount);
+			env->_compactStats._moveEndTime = omrtime_hires_clock();
+
+			if (!singleThreaded) {
+				env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+				MM_AtomicOperations::sync();
+			}
 
-		env->_compactStats._fixupEndTime = omrtime_hires_clock();
+			env->_compactStats._fixupStartTime = omrtime_hires_clock();
 
-		if (singleThreaded) {
-			env->_currentTask->releaseSynchronizedGCThreads(env);
+			fixupObjects(env, fixupObjectsCount);
+			if (_partialCompaction) {
+				fixupPartialCompactRememberedSet(env, fixupObjectsCount);
+			}
+
+			env->_compactStats._fixupEndTime = omrtime_hires_clock();
+
+			if (singleThreaded) {
+				env->_currentTask->releaseSynchronizedGCThreads(env);
+			}
 		}
 	}
 
@@ -596,8 +744,15 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 
 	MM_AtomicOperations::sync();
 
+	env->_compactStats._rebuildStartTime = omrtime_hires_clock();
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
-		rebuildFreelist(env);
+		if (_slidingCompaction) {
+			rebuildFreelistAfterSlide(env);
+		} else if (_partialCompaction) {
+			rebuildFreelistAfterPartialCompact(env);
+		} else {
+			rebuildFreelist(env);
+		}
 
 		MM_MemoryPool *memoryPool;
 		MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
@@ -611,9 +766,21 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	}
 
 	if (rebuildMarkBits) {
-		rebuildMarkbits(env);
+		if (_slidingCompaction) {
+			rebuildMarkbitsAfterSlide(env);
+		} else {
+			rebuildMarkbits(env);
+		}
 		MM_AtomicOperations::sync();
 	}
+	env->_compactStats._rebuildEndTime = omrtime_hires_clock();
+
+	if (_slidingCompaction) {
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+			freeSlidingBlockTable(env);
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+	}
 
 	_extensions->collectorLanguageInterface->compactScheme_workerCleanupAfterGC(env);
 
@@ -1344,6 +1511,10 @@ MM_CompactScheme::fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCou
 		}
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+        	/* A partial compaction fixes up the objects outside the evacuated areas from its remembered set */
+        	if (_partialCompaction && (SubAreaEntry::fixup_only == subAreaTable[i].state)) {
+        		continue;
+        	}
         	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_up)) {
         		fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, subAreaTable[i].state == SubAreaEntry::fixup_only, objectCount);
 			}
@@ -1405,7 +1576,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1455,6 +1626,11 @@ MM_CompactScheme::fixHeapForWalk(MM_EnvironmentBase *env)
 void
 MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
 {
+	/* A sliding compaction leaves every region compacted, with nothing to fix up */
+	if (_slidingCompaction) {
+		return;
+	}
+
 	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
 	GC_HeapRegionIteratorStandard regionIterator(regionManager);
 	MM_HeapRegionDescriptorStandard *region = NULL;
@@ -1509,4 +1685,487 @@ MM_CompactScheme::changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * en
 	return successful;
 }
 
+bool
+MM_CompactScheme::createSlidingBlockTable(MM_EnvironmentStandard *env)
+{
+	uintptr_t blockCount = 0;
+	GC_HeapRegionIteratorStandard regionCounter(_rootManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	while (NULL != (region = regionCounter.nextRegion())) {
+		if (!region->isCommitted()) {
+			continue;
+		}
+		/* Blocks must own whole compact table entries, which overlay the mark bits of a page */
+		if ((0 != pageOffset((omrobjectptr_t)region->getLowAddress())) || (0 != pageOffset((omrobjectptr_t)region->getHighAddress()))) {
+			return false;
+		}
+		blockCount += ((region->getSize() - 1) / SLIDING_COMPACT_BLOCK_SIZE) + 1;
+	}
+
+	_slidingBlockTable = (SlidingBlockEntry *)env->getForge()->allocate(blockCount * sizeof(SlidingBlockEntry), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _slidingBlockTable) {
+		return false;
+	}
+
+	uintptr_t i = 0;
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted()) {
+			continue;
+		}
+		uintptr_t regionBlockIndex = i;
+		uintptr_t high = (uintptr_t)region->getHighAddress();
+		for (uintptr_t low = (uintptr_t)region->getLowAddress(); low < high; low += SLIDING_COMPACT_BLOCK_SIZE) {
+			SlidingBlockEntry *block = &_slidingBlockTable[i++];
+			block->low = (omrobjectptr_t)low;
+			block->high = (omrobjectptr_t)OMR_MIN(low + SLIDING_COMPACT_BLOCK_SIZE, high);
+			block->region = region;
+			block->regionBlockIndex = regionBlockIndex;
+			block->sourceTop = NULL;
+			block->liveBytes = 0;
+			block->destination = NULL;
+			block->moved = 0;
+		}
+	}
+	Assert_MM_true(i == blockCount);
+
+	_slidingBlockCount = blockCount;
+	_slidingCompactionAborted = false;
+	return true;
+}
+
+void
+MM_CompactScheme::freeSlidingBlockTable(MM_EnvironmentStandard *env)
+{
+	env->getForge()->free(_slidingBlockTable);
+	_slidingBlockTable = NULL;
+	_slidingBlockCount = 0;
+}
+
+void
+MM_CompactScheme::summarizeSlidingBlocks(MM_EnvironmentStandard *env)
+{
+	for (uintptr_t i = 0; i < _slidingBlockCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			SlidingBlockEntry *block = &_slidingBlockTable[i];
+			MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)block->low, (uintptr_t *)block->high);
+			omrobjectptr_t objectPtr = NULL;
+			omrobjectptr_t sourceTop = NULL;
+			uintptr_t liveBytes = 0;
+			while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+				uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+				if (objectSize != _extensions->objectModel.getConsumedSizeInBytesWithHeaderForMove(objectPtr)) {
+					_slidingCompactionAborted = true;
+				}
+				liveBytes += objectSize;
+				sourceTop = (omrobjectptr_t)((uintptr_t)objectPtr + objectSize);
+			}
+			block->liveBytes = liveBytes;
+			block->sourceTop = sourceTop;
+		}
+	}
+}
+
+void
+MM_CompactScheme::computeSlidingDestinations(MM_EnvironmentStandard *env)
+{
+	uintptr_t destination = 0;
+	for (uintptr_t i = 0; i < _slidingBlockCount; i++) {
+		SlidingBlockEntry *block = &_slidingBlockTable[i];
+		if (block->regionBlockIndex == i) {
+			destination = (uintptr_t)block->low;
+		}
+		block->destination = (omrobjectptr_t)destination;
+		destination += block->liveBytes;
+	}
+
+	/* Every committed region may be forwarded */
+	_compactFrom = (omrobjectptr_t)_heap->getHeapBase();
+	_compactTo = (omrobjectptr_t)_heap->getHeapTop();
+
+	/* Reset the memory pools in preparation for rebuild of free list at end of compaction */
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted()) {
+			continue;
+		}
+		region->getSubSpace()->getMemoryPool()->reset(MM_MemoryPool::forCompact);
+	}
+}
+
+void
+MM_CompactScheme::slideObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	/* Work units are claimed in increasing order, so every block a thread waits for is already claimed */
+	for (uintptr_t i = 0; i < _slidingBlockCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			SlidingBlockEntry *block = &_slidingBlockTable[i];
+			if (NULL != block->sourceTop) {
+				waitForSlidingBlockSources(env, i);
+				slideBlock(env, block, objectCount, byteCount);
+			}
+			markSlidingBlockMoved(env, block);
+		}
+	}
+}
+
+void
+MM_CompactScheme::waitForSlidingBlockSources(MM_EnvironmentStandard *env, uintptr_t blockIndex)
+{
+	SlidingBlockEntry *block = &_slidingBlockTable[blockIndex];
+
+	/* Lower blocks of the region are in address order, so once one of them ends at or below our
+	 * destination none of the blocks below it can still occupy the destination range.
+	 */
+	for (uintptr_t i = blockIndex; i > block->regionBlockIndex; ) {
+		SlidingBlockEntry *lowerBlock = &_slidingBlockTable[--i];
+		if (NULL == lowerBlock->sourceTop) {
+			continue;
+		}
+		if (lowerBlock->sourceTop <= block->destination) {
+			break;
+		}
+		waitForSlidingBlockMoved(env, lowerBlock);
+	}
+	MM_AtomicOperations::loadSync();
+}
+
+void
+MM_CompactScheme::waitForSlidingBlockMoved(MM_EnvironmentStandard *env, SlidingBlockEntry *block)
+{
+	/* The block is usually being slid by another thread already, so spin briefly before blocking */
+	for (uintptr_t spin = 0; spin < SLIDING_BLOCK_SPIN_COUNT; spin++) {
+		if (0 != block->moved) {
+			return;
+		}
+		omrthread_yield();
+	}
+
+	omrthread_monitor_enter(_slidingBlockMonitor);
+	/* The count is published before moved is re-read, see markSlidingBlockMoved() */
+	MM_AtomicOperations::add(&_slidingBlockWaiterCount, 1);
+	while (0 == block->moved) {
+		omrthread_monitor_wait(_slidingBlockMonitor);
+	}
+	MM_AtomicOperations::subtract(&_slidingBlockWaiterCount, 1);
+	omrthread_monitor_exit(_slidingBlockMonitor);
+}
+
+void
+MM_CompactScheme::markSlidingBlockMoved(MM_EnvironmentStandard *env, SlidingBlockEntry *block)
+{
+	MM_AtomicOperations::storeSync();
+	block->moved = 1;
+	/* Either a waiter sees the flag before it waits, or we see the waiter and wake it under the monitor */
+	MM_AtomicOperations::sync();
+	if (0 != _slidingBlockWaiterCount) {
+		omrthread_monitor_enter(_slidingBlockMonitor);
+		omrthread_monitor_notify_all(_slidingBlockMonitor);
+		omrthread_monitor_exit(_slidingBlockMonitor);
+	}
+}
+
+void
+MM_CompactScheme::slideBlock(MM_EnvironmentStandard *env, SlidingBlockEntry *block, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)block->low, (uintptr_t *)block->high);
+	omrobjectptr_t destination = block->destination;
+	omrobjectptr_t objectPtr = NULL;
+	omrobjectptr_t nextObject = NULL;
+	intptr_t page = -1; /* invalid value */
+	intptr_t counter = 0; /* obj on page, first is zero */
+	CompactTableEntry entry;
+
+	for (objectPtr = markedObjectIterator.nextObject(); NULL != objectPtr; objectPtr = nextObject) {
+		nextObject = markedObjectIterator.nextObject();
+
+		uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+
+		/* Passed by reference: page, counter.  MODIFIED INSIDE the funcall. */
+		saveForwardingPtr(entry, objectPtr, destination, page, counter);
+
+		if (destination != objectPtr) {
+			objectCount++;
+			byteCount += objectSize;
+
+			_extensions->objectModel.preMove(env->getOmrVMThread(), objectPtr);
+			memmove(destination, objectPtr, objectSize);
+			_extensions->objectModel.postMove(env->getOmrVMThread(), destination);
+		}
+
+		destination = (omrobjectptr_t)((uintptr_t)destination + objectSize);
+	}
+
+	if (page != -1) {
+		_compactTable[page] = entry;
+	}
+
+	Assert_MM_true((uintptr_t)destination == ((uintptr_t)block->destination + block->liveBytes));
+}
+
+void
+MM_CompactScheme::fixupSlidObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount)
+{
+	MM_CompactSchemeFixupObject fixupObject(env, this);
+
+	for (uintptr_t i = 0; i < _slidingBlockCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			SlidingBlockEntry *block = &_slidingBlockTable[i];
+			if (0 != block->liveBytes) {
+				omrobjectptr_t destinationTop = (omrobjectptr_t)((uintptr_t)block->destination + block->liveBytes);
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, block->destination, destinationTop, false);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					objectCount++;
+					fixupObject.fixupObject(env, objectPtr);
+				}
+			}
+		}
+	}
+}
+
+void
+MM_CompactScheme::rebuildFreelistAfterSlide(MM_EnvironmentStandard *env)
+{
+	uintptr_t i = 0;
+	while (i < _slidingBlockCount) {
+		MM_HeapRegionDescriptorStandard *region = _slidingBlockTable[i].region;
+		MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
+		void *currentFreeBase = region->getLowAddress();
+
+		/* Everything above the objects slid into the region is free */
+		for (; (i < _slidingBlockCount) && (region == _slidingBlockTable[i].region); i++) {
+			currentFreeBase = (void *)((uintptr_t)_slidingBlockTable[i].destination + _slidingBlockTable[i].liveBytes);
+		}
+
+		MM_CompactMemoryPoolState poolStateObj;
+		MM_CompactMemoryPoolState *poolState = &poolStateObj;
+
+		/* Initialize current memory pool sweep chunk */
+		poolState->_memoryPool = memorySubSpace->getMemoryPool(region->getLowAddress());
+
+		uintptr_t currentFreeSize = (uintptr_t)region->getHighAddress() - (uintptr_t)currentFreeBase;
+		if (0 != currentFreeSize) {
+#if defined(DEBUG_PAINT_FREE)
+			memset(currentFreeBase, 0xBB, currentFreeSize);
+#endif /* DEBUG_PAINT_FREE */
+			addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, currentFreeSize);
+		}
+
+		if (NULL != poolState->_freeListHead) {
+			/* Terminate the free list with NULL*/
+			poolState->_memoryPool->createFreeEntry(env, poolState->_previousFreeEntry,
+													(uint8_t *)poolState->_previousFreeEntry + poolState->_previousFreeEntrySize);
+		}
+		flushPool(env, poolState);
+	}
+}
+
+void
+MM_CompactScheme::rebuildMarkbitsAfterSlide(MM_EnvironmentStandard *env)
+{
+	/* Blocks are page aligned, so they clear disjoint words of the mark map (and of the compact table) */
+	for (uintptr_t i = 0; i < _slidingBlockCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			_markMap->setBitsInRange(env, _slidingBlockTable[i].low, _slidingBlockTable[i].high, true);
+		}
+	}
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	/* Destination ranges are not aligned, so neighbouring blocks may share the words at their ends */
+	for (uintptr_t i = 0; i < _slidingBlockCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			SlidingBlockEntry *block = &_slidingBlockTable[i];
+			if (0 != block->liveBytes) {
+				omrobjectptr_t destinationTop = (omrobjectptr_t)((uintptr_t)block->destination + block->liveBytes);
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, block->destination, destinationTop, false);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					_markMap->atomicSetBit(objectPtr);
+				}
+			}
+		}
+	}
+}
+
+void
+MM_CompactScheme::selectPartialCompactAreas(MM_EnvironmentBase *env)
+{
+	if ((0 == _extensions->partialCompactAreaCount) || (NULL == _partialCompactAreaTable)) {
+		return;
+	}
+
+	/* The split free lists are rebuilt from scratch after a compaction, so they only support a full compaction */
+	if (_extensions->splitFreeListSplitAmount > 1) {
+		return;
+	}
+
+	/* Areas are aligned sub areas of the size a full compaction would use, rounded up to a power of two */
+	uintptr_t areaShift = MM_Math::floorLog2(getSubAreaSize(env));
+	if (((uintptr_t)1 << areaShift) < getSubAreaSize(env)) {
+		areaShift += 1;
+	}
+	uintptr_t areaBase = (uintptr_t)_extensions->heap->getHeapBase();
+	uintptr_t areaCount = (((uintptr_t)_extensions->heap->getHeapTop() - areaBase - 1) >> areaShift) + 1;
+	Assert_MM_true(areaCount <= _partialCompactAreaTableSize);
+
+	memset(_partialCompactAreaTable, 0, areaCount * sizeof(uint8_t));
+	memset(_partialCompactAreaScores, 0, areaCount * sizeof(uintptr_t));
+
+	/* Score each area by the free bytes it holds in entries too small for a full sized TLH.  The large object
+	 * threshold of the allocation profile is only a few hundred bytes, which misses most of the holes left
+	 * between small objects.
+	 */
+	uintptr_t fragmentThreshold = _extensions->tlhMaximumSize;
+	MM_MemoryPool *memoryPool = NULL;
+	MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+	while (NULL != (memoryPool = poolIterator.nextPool())) {
+		MM_HeapLinkedFreeHeader *freeEntry = (MM_HeapLinkedFreeHeader *)memoryPool->getFirstFreeStartingAddr(env);
+		while (NULL != freeEntry) {
+			uintptr_t freeEntrySize = freeEntry->getSize();
+			if (freeEntrySize < fragmentThreshold) {
+				_partialCompactAreaScores[((uintptr_t)freeEntry - areaBase) >> areaShift] += freeEntrySize;
+			}
+			freeEntry = (MM_HeapLinkedFreeHeader *)memoryPool->getNextFreeStartingAddr(env, freeEntry);
+		}
+	}
+
+	uintptr_t selectedCount = 0;
+	while (selectedCount < _extensions->partialCompactAreaCount) {
+		uintptr_t bestArea = 0;
+		uintptr_t bestScore = 0;
+		for (uintptr_t area = 0; area < areaCount; area++) {
+			if (_partialCompactAreaScores[area] > bestScore) {
+				bestArea = area;
+				bestScore = _partialCompactAreaScores[area];
+			}
+		}
+		if (0 == bestScore) {
+			break;
+		}
+		_partialCompactAreaTable[bestArea] = 1;
+		_partialCompactAreaScores[bestArea] = 0;
+		selectedCount += 1;
+	}
+
+	if (0 != selectedCount) {
+		_partialCompactAreaBase = areaBase;
+		_partialCompactAreaShift = areaShift;
+		_partialCompactAreaCount = selectedCount;
+		_partialCompactRememberedSet.clear(env);
+		_markingScheme->setPartialCompactAreas(_partialCompactAreaTable, (void *)areaBase, areaShift, &_partialCompactRememberedSet);
+	}
+}
+
+void
+MM_CompactScheme::clearPartialCompactAreas(MM_EnvironmentBase *env)
+{
+	if (0 != _partialCompactAreaCount) {
+		_markingScheme->clearPartialCompactAreas();
+		_partialCompactRememberedSet.clear(env);
+		_partialCompactAreaCount = 0;
+	}
+	_partialCompaction = false;
+}
+
+void
+MM_CompactScheme::detachFreeEntriesForPartialCompact(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, void *low, void *high)
+{
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+	while (low < high) {
+		/* The range may span the boundary of the large object area */
+		void *highAddr = NULL;
+		MM_MemoryPool *memoryPool = memorySubSpace->getMemoryPool(env, low, high, highAddr);
+		void *top = (NULL == highAddr) ? high : highAddr;
+
+		MM_HeapLinkedFreeHeader *freeListHead = NULL;
+		MM_HeapLinkedFreeHeader *freeListTail = NULL;
+		uintptr_t freeListMemoryCount = 0;
+		uintptr_t freeListMemorySize = 0;
+
+		/* Nothing is returned for a minimum size of UDATA_MAX, so the detached entries are simply abandoned */
+		memoryPool->removeFreeEntriesWithinRange(env, low, top, UDATA_MAX, freeListHead, freeListTail, freeListMemoryCount, freeListMemorySize);
+		low = top;
+	}
+#else /* OMR_GC_LARGE_OBJECT_AREA */
+	Assert_MM_unreachable();
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+}
+
+void
+MM_CompactScheme::fixupPartialCompactRememberedSet(MM_EnvironmentStandard *env, uintptr_t &objectCount)
+{
+	MM_CompactSchemeFixupObject fixupObject(env, this);
+	MM_SublistPuddle *puddle = NULL;
+	GC_SublistIterator rememberedSetIterator(&_partialCompactRememberedSet);
+
+	while (NULL != (puddle = rememberedSetIterator.nextList())) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
+			omrobjectptr_t *slotPtr = NULL;
+			while (NULL != (slotPtr = (omrobjectptr_t *)rememberedSetSlotIterator.nextSlot())) {
+				/* Unused slots of the thread local fragments are left NULL */
+				if (NULL != *slotPtr) {
+					/* Objects outside the evacuated areas did not move, and their mark bits are intact */
+					Assert_MM_true(_markMap->isBitSet(*slotPtr));
+					objectCount++;
+					fixupObject.fixupObject(env, *slotPtr);
+				}
+			}
+		}
+	}
+}
+
+void
+MM_CompactScheme::rebuildFreelistAfterPartialCompact(MM_EnvironmentStandard *env)
+{
+	GC_HeapRegionIteratorStandard regionIterator(_heap->getHeapRegionManager());
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while(NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted()) {
+			continue;
+		}
+		MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if ((SubAreaEntry::fixup_only == subAreaTable[i].state) || (NULL == subAreaTable[i].freeChunk)) {
+				continue;
+			}
+			/* Everything from the free chunk to the next sub area was vacated */
+			void *low = (void *)subAreaTable[i].freeChunk;
+			void *high = (void *)subAreaTable[i + 1].firstObject;
+			while (low < high) {
+				void *highAddr = NULL;
+				MM_MemoryPool *memoryPool = memorySubSpace->getMemoryPool(env, low, high, highAddr);
+				void *top = (NULL == highAddr) ? high : highAddr;
+				if (memoryPool->createFreeEntry(env, low, top)) {
+					MM_HeapLinkedFreeHeader *freeEntry = (MM_HeapLinkedFreeHeader *)low;
+					memoryPool->addFreeEntries(env, freeEntry, freeEntry, 1, (uintptr_t)top - (uintptr_t)low);
+				}
+				low = top;
+			}
+		}
+		subAreaTable += (i + 1);
+	}
+
+	/* Free bytes and entry counts were maintained above, but entries may have coalesced into a new largest one */
+	MM_MemoryPool *memoryPool = NULL;
+	MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+	while (NULL != (memoryPool = poolIterator.nextPool())) {
+		uintptr_t largestFreeEntry = 0;
+		MM_HeapLinkedFreeHeader *freeEntry = (MM_HeapLinkedFreeHeader *)memoryPool->getFirstFreeStartingAddr(env);
+		while (NULL != freeEntry) {
+			if (freeEntry->getSize() > largestFreeEntry) {
+				largestFreeEntry = freeEntry->getSize();
+			}
+			freeEntry = (MM_HeapLinkedFreeHeader *)memoryPool->getNextFreeStartingAddr(env, freeEntry);
+		}
+		memoryPool->setLargestFreeEntry(largestFreeEntry);
+	}
+}
+
 #endif /* OMR_GC_MODRON_COMPACTION */
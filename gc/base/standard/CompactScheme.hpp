@@ -31,6 +31,7 @@
 #include "MarkingScheme.hpp"
 #include "MarkMap.hpp"
 #include "SlotObject.hpp"
+#include "SublistPool.hpp"
 
 class MM_AllocateDescription;
 class MM_EnvironmentStandard;
@@ -116,6 +117,20 @@ private:
     	};
     };
 
+    /* A page aligned block of a committed region, the unit of work of a sliding compaction.
+     * Blocks never span regions, and destinations restart at the low address of every region.
+     */
+    struct SlidingBlockEntry {
+    	omrobjectptr_t low; /**< first address of the block */
+    	omrobjectptr_t high; /**< address following the block */
+    	MM_HeapRegionDescriptorStandard *region; /**< the region which contains the block */
+    	uintptr_t regionBlockIndex; /**< index of the first block of the region */
+    	omrobjectptr_t sourceTop; /**< end of the last marked object starting in the block, or NULL if no marked object starts in it */
+    	uintptr_t liveBytes; /**< total size of the marked objects starting in the block */
+    	omrobjectptr_t destination; /**< new address of the first marked object starting in the block */
+    	volatile uintptr_t moved; /**< non-zero once every object starting in the block is at its destination */
+    };
+
 protected:
     OMR_VM *_omrVM;
     MM_GCExtensionsBase *_extensions;
@@ -131,6 +146,20 @@ protected:
     SubAreaEntry *_subAreaTable;  /**< Reference to the subAreaTable which is shared data from the SweepHeapSectioning */
     omrobjectptr_t _compactFrom;
     omrobjectptr_t _compactTo;
+    bool _slidingCompaction; /**< true if the current compaction slides blocks rather than evacuating sub areas */
+    volatile bool _slidingCompactionAborted; /**< set during the summary if an object changes size when moved, which sliding compaction does not support */
+    uintptr_t _slidingBlockCount; /**< number of entries in _slidingBlockTable */
+    SlidingBlockEntry *_slidingBlockTable; /**< blocks of all committed regions, in address order, allocated for the duration of a sliding compaction */
+    omrthread_monitor_t _slidingBlockMonitor; /**< waited on by threads whose destination is still occupied once they are done spinning */
+    volatile uintptr_t _slidingBlockWaiterCount; /**< number of threads waiting on _slidingBlockMonitor */
+    bool _partialCompaction; /**< true if the current compaction only evacuates the areas selected before marking */
+    uintptr_t _partialCompactAreaTableSize; /**< number of entries in _partialCompactAreaTable, enough to cover the maximum heap at the smallest area size */
+    uint8_t *_partialCompactAreaTable; /**< non-zero for each heap area selected for a partial compaction, indexed by partialCompactAreaIndex() */
+    uintptr_t *_partialCompactAreaScores; /**< fragmented free bytes of each heap area, used while selecting areas */
+    uintptr_t _partialCompactAreaBase; /**< heap base at the time the areas were selected */
+    uintptr_t _partialCompactAreaShift; /**< log2 of the size of an area */
+    uintptr_t _partialCompactAreaCount; /**< number of areas selected for the current cycle, 0 if none */
+    MM_SublistPool _partialCompactRememberedSet; /**< objects outside the selected areas which referred into them when marked */
 public:
 
     /*
@@ -151,6 +180,12 @@ protected:
 	virtual void tearDown(MM_EnvironmentBase *env);
 
 
+    /**
+     * Return the size of a sub area for a compaction of the whole heap.
+     *
+     * @param env[in] the current thread
+     */
+    uintptr_t getSubAreaSize(MM_EnvironmentBase *env);
     void createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded);
     /**
      * Set the real limits for a specific subArea
@@ -293,6 +328,91 @@ protected:
      * @return true if the action was changed, or false if another thread already changed it to newAction
      */
     bool changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * entry, uintptr_t newAction);
+
+    /**
+     * Allocate and initialize the block table of a sliding compaction.
+     *
+     * @param env[in] the master thread
+     * @return true if the table was created, or false if sliding compaction cannot be used for this collection
+     */
+    bool createSlidingBlockTable(MM_EnvironmentStandard *env);
+    void freeSlidingBlockTable(MM_EnvironmentStandard *env);
+
+    /**
+     * Record the live bytes and the source top of every block from the mark map.  Blocks are
+     * independent so any thread may summarize any block.
+     *
+     * @param env[in] the current thread
+     */
+    void summarizeSlidingBlocks(MM_EnvironmentStandard *env);
+
+    /**
+     * Compute the destination of every block as the prefix sum of the live bytes of the blocks
+     * preceding it in its region, and prepare the memory pools for the free list rebuild.
+     *
+     * @param env[in] the master thread
+     */
+    void computeSlidingDestinations(MM_EnvironmentStandard *env);
+
+    /**
+     * Slide the objects of every block to their destination, recording forwarding addresses in the
+     * compact table.  A block only waits for the lower blocks of its region whose objects still
+     * occupy its destination range.
+     *
+     * @param env[in] the current thread
+     * @param[in/out] objectCount the number of objects moved (accumulated)
+     * @param[in/out] byteCount the number of bytes moved (accumulated)
+     */
+    void slideObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount);
+    void slideBlock(MM_EnvironmentStandard *env, SlidingBlockEntry *block, uintptr_t &objectCount, uintptr_t &byteCount);
+    void waitForSlidingBlockSources(MM_EnvironmentStandard *env, uintptr_t blockIndex);
+    void waitForSlidingBlockMoved(MM_EnvironmentStandard *env, SlidingBlockEntry *block);
+    void markSlidingBlockMoved(MM_EnvironmentStandard *env, SlidingBlockEntry *block);
+
+    /**
+     * Fix up all references in the objects slid into place by every block.
+     *
+     * @param env[in] the current thread
+     * @param[in/out] objectCount the number of objects fixed up (accumulated)
+     */
+    void fixupSlidObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount);
+    void rebuildFreelistAfterSlide(MM_EnvironmentStandard *env);
+    void rebuildMarkbitsAfterSlide(MM_EnvironmentStandard *env);
+
+    /**
+     * Return the index in _partialCompactAreaTable of the area containing an address
+     */
+    MMINLINE uintptr_t partialCompactAreaIndex(void *addr) const
+    {
+        return ((uintptr_t)addr - _partialCompactAreaBase) >> _partialCompactAreaShift;
+    }
+
+    /**
+     * Remove the free entries within a sub area to be evacuated by a partial compaction from the
+     * free lists of the memory pools which own them.  Free entries elsewhere are left in place.
+     *
+     * @param env[in] the master thread
+     * @param memorySubSpace[in] the subspace which contains the range
+     * @param low[in] the first address of the range
+     * @param high[in] the address following the range
+     */
+    void detachFreeEntriesForPartialCompact(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, void *low, void *high);
+
+    /**
+     * Fix up the references from the objects of the partial compaction remembered set into the
+     * evacuated areas.
+     *
+     * @param env[in] the current thread
+     * @param[in/out] objectCount the number of objects fixed up (accumulated)
+     */
+    void fixupPartialCompactRememberedSet(MM_EnvironmentStandard *env, uintptr_t &objectCount);
+
+    /**
+     * Return the space left free in the evacuated areas to the free lists of their memory pools.
+     *
+     * @param env[in] the master thread
+     */
+    void rebuildFreelistAfterPartialCompact(MM_EnvironmentStandard *env);
 public:
 	static MM_CompactScheme *newInstance(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme);
 	
@@ -314,6 +434,21 @@ public:
 	
 	MMINLINE void setMarkMap(MM_MarkMap *markMap) {	_markMap = markMap;}
 
+	/**
+	 * Select the most fragmented areas of the heap for a partial compaction, and arm the marking
+	 * scheme to remember the objects which refer into them.  Must be called before marking.
+	 *
+	 * @param env[in] the master thread
+	 */
+	void selectPartialCompactAreas(MM_EnvironmentBase *env);
+
+	/**
+	 * Discard the areas selected for a partial compaction and the remembered set built for them.
+	 *
+	 * @param env[in] the master thread
+	 */
+	void clearPartialCompactAreas(MM_EnvironmentBase *env);
+
 	/**
 	 * Create a CompactScheme object.
 	 */
@@ -326,6 +461,20 @@ public:
         , _markMap(markingScheme->getMarkMap())
         , _subAreaTableSize(0)
     	, _subAreaTable(NULL)
+    	, _slidingCompaction(false)
+    	, _slidingCompactionAborted(false)
+    	, _slidingBlockCount(0)
+    	, _slidingBlockTable(NULL)
+    	, _slidingBlockMonitor(NULL)
+    	, _slidingBlockWaiterCount(0)
+    	, _partialCompaction(false)
+    	, _partialCompactAreaTableSize(0)
+    	, _partialCompactAreaTable(NULL)
+    	, _partialCompactAreaScores(NULL)
+    	, _partialCompactAreaBase(0)
+    	, _partialCompactAreaShift(0)
+    	, _partialCompactAreaCount(0)
+    	, _partialCompactRememberedSet()
     {
     	_typeId = __FUNCTION__;
     }
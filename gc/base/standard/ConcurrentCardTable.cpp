@@ -30,6 +30,7 @@
 #include "EnvironmentStandard.hpp"
 #include "Heap.hpp"
 #include "HeapMapIterator.hpp"
+#include "HeapMapKernels.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "HeapRegionIterator.hpp"
 #include "MemorySpace.hpp"
@@ -488,6 +489,11 @@ MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *envModron, MM_Heap *heap)
 			(*mmPrivateHooks)->J9HookRegister(mmPrivateHooks, J9HOOK_MM_PRIVATE_CACHE_REFRESHED, tlhRefreshed, (void *)this);
 		}
 	
+		/* The card block summary lets final card cleaning skip blocks of clean cards */
+		if (_extensions->cardBlockSummary && !initializeCardBlockSummary(env)) {
+			return false;
+		}
+
 		/* Set default card cleaning masks used by getNextDirtycard */
 		_concurrentCardCleanMask = CONCURRENT_CARD_CLEAN_MASK;
 		_finalCardCleanMask = FINAL_CARD_CLEAN_MASK;
@@ -603,6 +609,7 @@ MM_ConcurrentCardTable::dirtyCardsInRange(MM_EnvironmentStandard *env, void *hea
 		/* If card not already dirty then dirty it */
 		if (*baseCard != (Card)CARD_DIRTY) {
 			*baseCard = (Card)CARD_DIRTY;
+			dirtyCardBlock(baseCard);
 		}
 		baseCard += 1;
 	}
@@ -788,6 +795,8 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentStandard *env, bool isMutator,
 	Card *nextDirtyCard;
 	uintptr_t cleanedSoFar;
 	uintptr_t cardsCleaned = 0;
+	uintptr_t cardsScanned = 0;
+	uintptr_t cardsSkipped = 0;
 	uintptr_t maxPushes;
 	uintptr_t gcCount = _extensions->globalGCStats.gcCount;
 
@@ -853,7 +862,7 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentStandard *env, bool isMutator,
 	while ( cleanedSoFar < sizeToDo && currentCleaningPhase == _cardCleanPhase ) {
 
 		/* Get next dirty card; if any */
-		nextDirtyCard = getNextDirtyCard(env, _concurrentCardCleanMask, true);
+		nextDirtyCard = getNextDirtyCard(env, _concurrentCardCleanMask, true, &cardsScanned, &cardsSkipped);
 
 		/* If no more cards or another thread waiting on exclusive access
 		 * we are done
@@ -906,6 +915,8 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentStandard *env, bool isMutator,
 	 * counts will be accurate enough for use currently made of them.
 	 */
  	incConcurrentCleanedCards(cardsCleaned, currentCleaningPhase);
+	_cardTableStats.incConcurrentScannedCards(cardsScanned);
+	_cardTableStats.incConcurrentSkippedCards(cardsSkipped);
 	env->_threadCleaningCards = false;
 
 	/* If we ran out of cards to clean ...*/
@@ -963,6 +974,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentStandard *env, Card *card,
 		if (env->isExclusiveAccessRequestWaiting()) {
 			/* Re-dirty the card as we did not finish cleaning it ... */
 			*card = (Card)CARD_DIRTY;
+			dirtyCardBlock(card);
 			/* ...and get out now */
 			return false;
 		}
@@ -1009,6 +1021,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentStandard *env, Card *card,
 	 */
 	if (rememberedObjectsFound && (env->getExtensions()->isRememberedSetInOverflowState())) {
 		*card = (Card)CARD_DIRTY;
+		dirtyCardBlock(card);
 	}
 
 	return true;
@@ -1056,6 +1069,8 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentStandard *env, uintptr_t *
 	omrobjectptr_t objectPtr;
 	uintptr_t objects;
 	uintptr_t cards = 0;
+	uintptr_t cardsScanned = 0;
+	uintptr_t cardsSkipped = 0;
 	bool phase2 = false;
 
 	/* Set upper limit of refs we push before returning to one packets worth */
@@ -1067,7 +1082,7 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentStandard *env, uintptr_t *
 	MM_MarkMap *markMap = _markingScheme->getMarkMap();
 	
 	for ( ;
-		(nextDirtyCard= getNextDirtyCard(env, _finalCardCleanMask, false)) != NULL;
+		(nextDirtyCard= getNextDirtyCard(env, _finalCardCleanMask, false, &cardsScanned, &cardsSkipped)) != NULL;
 		) {
 
 		/* Should never get EXCLUSIVE_VMACCESS_REQUESTED in final clean cards phase */
@@ -1106,9 +1121,11 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentStandard *env, uintptr_t *
 
 	/* We get here if we have pushed enough refs or we have cleaned all the cards
 	 *
-	 * First update number of dirty cards cleaned
+	 * First update number of dirty cards cleaned, and of cards scanned to find them
 	 */
 	incFinalCleanedCards(cards, phase2);
+	_cardTableStats.incFinalScannedCards(cardsScanned);
+	_cardTableStats.incFinalSkippedCards(cardsSkipped);
 
 	/* ..tell caller how many bytes we traced */
 	*bytesTraced = traceCount;
@@ -1600,17 +1617,21 @@ MM_ConcurrentCardTable::resetCleaningRanges(MM_EnvironmentStandard *env)
 /**
  * Get the next dirty card in card table.
  *
- * Find the next dirty card (as defined by cardmask) in the card table.
+ * Find the next dirty card (as defined by cardmask) in the card table. Runs of clean cards are
+ * skipped with the heap map kernels, and blocks of cards which the card block summary shows to be
+ * clean are not read at all.
  *
  * @param cardMask - mask to apply to cards to identify those cards the caller
  * 					 is interested in
+ * @param cardsScanned - incremented by the number of cards read by this call
+ * @param cardsSkipped - incremented by the number of cards skipped using the card block summary
  *
  * @return Routine either returns address of next dirty card, NULL if no
  * more dirty cards, EXCLUSIVE_VMACCESS_REQUESTED if another thread waiting
  * for exclusive VM access.
  */
 Card*
-MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentStandard *env, Card cardMask, bool concurrentCardClean)
+MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentStandard *env, Card cardMask, bool concurrentCardClean, uintptr_t *cardsScanned, uintptr_t *cardsSkipped)
 {
 	/* Get a local copy of next current range being cleaned */
 	CleaningRange *currentRange = (CleaningRange *)_currentCleaningRange;
@@ -1621,6 +1642,11 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentStandard *env, Card cardM
 		return NULL;
 	}
 
+	/* Blocks are only recorded as clean when their cards are cleared, so any card dirtied since
+	 * then has its block marked in the summary
+	 */
+	bool skipCleanBlocks = hasCardBlockSummary();
+
 	/* Get a local copy of next card to check */
 	Card *firstCard = (Card *)currentRange->nextCard;
 
@@ -1633,24 +1659,35 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentStandard *env, Card cardM
 		Card *lastCardInPhase = _lastCardInPhase;
 		Card *lastCardToClean = OMR_MIN(lastCardInPhase, currentRange->topCard);
 		Card *nextDirtyCard, *currentCard;
+		uintptr_t skipped = 0;
 
 		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
 
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
+			/* Skip over blocks of cards which have not been dirtied since they were last cleared */
+			if (skipCleanBlocks) {
+				while ((currentCard < lastCardToClean) && !isCardBlockDirty(currentCard)) {
+					Card *blockTop = OMR_MIN(getCardBlockTop(currentCard), lastCardToClean);
+					skipped += blockTop - currentCard;
+					currentCard = blockTop;
+				}
+
+				if (currentCard >= lastCardToClean) {
+					break;
+				}
+			}
+
+			/* Are we are on an uintptr_t boundary? If so scan the card table a vector
 	 		 * at a time until we find a slot which is non-zero or the end of card table
 	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
+	 		 * empty and scanning many cards at a time will reduce the time taken to
 	 		 * scan the card table.
 	 		 */
 			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
 				/* Last card may be in middle of a slot so only scan up to an including last
 				 * complete slots worth of cards; then go card at a time
 				 **/
 				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
+				uintptr_t *nextSlot = MM_HeapMapKernels::findNonZeroWord((uintptr_t *)currentCard, lastSlot);
 				/*
 			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
 				 */
@@ -1687,11 +1724,16 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentStandard *env, Card cardM
 											  							  (uintptr_t)currentCard)) {
 					break;
 				}
-				
+
+				*cardsScanned += (uintptr_t)(currentCard - firstCard) - skipped;
+				*cardsSkipped += skipped;
 				return nextDirtyCard;
 			}
 		} /* of currentCard < lastCardToClean */
 
+		*cardsScanned += (uintptr_t)(currentCard - firstCard) - skipped;
+		*cardsSkipped += skipped;
+
 		/* We get here if we break out of FOR loop when another thread beat us to next
 		 * dirty card or we reach then end of the card table.
 		 *
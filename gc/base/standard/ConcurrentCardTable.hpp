@@ -226,7 +226,7 @@ protected:
 	bool initialize(MM_EnvironmentBase *env, MM_Heap *heap);
 	
 	bool cleanSingleCard(MM_EnvironmentStandard *env, Card *card, uintptr_t bytesToClean, uintptr_t *totalBytesCleaned);
-	Card* getNextDirtyCard(MM_EnvironmentStandard *env, Card cardMask, bool concurrentCardClean);
+	Card* getNextDirtyCard(MM_EnvironmentStandard *env, Card cardMask, bool concurrentCardClean, uintptr_t *cardsScanned, uintptr_t *cardsSkipped);
 	
 	bool cardHasMarkedObjects(MM_EnvironmentStandard *env, Card *card);
 	
@@ -32,6 +32,7 @@
 #include "ConcurrentPrepareCardTableTask.hpp"
 #include "Debug.hpp"
 #include "Dispatcher.hpp"
+#include "HeapMapKernels.hpp"
 #include "MemorySubSpace.hpp"
 #include "WorkPackets.hpp"
 
@@ -356,18 +357,17 @@ MM_ConcurrentCardTableForWC::prepareCardTableChunk(MM_EnvironmentStandard *env,
 				endCard = prepareAddress + currentPrepareSize;
 				
 				for (Card *currentCard = firstCard; currentCard < endCard; currentCard++) {
-					/* Are we are on an uintptr_t boundary ?. If so scan the card table a uintptr_t
+					/* Are we are on an uintptr_t boundary ?. If so scan the card table a vector
 					 * at a time until we find a slot which is non-zero or the end of card table
 					 * found. This is based on the premise that the card table will be mostly
-					 * empty and scanning an uintptr_t at a time will reduce the time taken to
+					 * empty and scanning many cards at a time will reduce the time taken to
 					 * scan the card table.
 					 */
 					if (((Card)CARD_CLEAN == *currentCard) &&
 						((uintptr_t)currentCard % sizeof(uintptr_t) == 0)) {
-						 uintptr_t *nextSlot= (uintptr_t *)currentCard;
-						while ( ((Card *)nextSlot < endCard) && (*nextSlot == SLOT_ALL_CLEAN) ) {
-							nextSlot++;
-						}
+						/* Only scan complete slots; any cards after the last one are checked a card at a time */
+						uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)endCard);
+						uintptr_t *nextSlot = MM_HeapMapKernels::findNonZeroWord((uintptr_t *)currentCard, lastSlot);
 						
 						/*
 						 * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
@@ -394,6 +394,7 @@ MM_ConcurrentCardTableForWC::prepareCardTableChunk(MM_EnvironmentStandard *env,
 						assume0(action == MARK_SAFE_CARD_DIRTY);
 						if ((Card)CARD_CLEAN_SAFE == *currentCard) {
 							*currentCard = (Card)CARD_DIRTY;
+							dirtyCardBlock(currentCard);
 						}
 					}
 				}
@@ -37,6 +37,7 @@
 
 #include "AllocateDescription.hpp"
 #include "AtomicOperations.hpp"
+#include "CardCleanerForRememberedSetScan.hpp"
 #include "CollectorLanguageInterfaceImpl.hpp"
 #include "ConcurrentCardTable.hpp"
 #include "ConcurrentCardTableForWC.hpp"
@@ -67,6 +68,7 @@
 #include "MemorySubSpaceFlat.hpp"
 #include "MemorySubSpaceSemiSpace.hpp"
 #include "ObjectModel.hpp"
+#include "RememberedSetCardTable.hpp"
 #include "SpinLimiter.hpp"
 #include "SublistIterator.hpp"
 #include "SublistPuddle.hpp"
@@ -284,6 +286,12 @@ MM_ConcurrentGC::reportConcurrentFinalCardCleaningEnd(MM_EnvironmentStandard *en
 	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 
 	Trc_MM_ConcurrentCollectionCardCleaningEnd(env->getLanguageVMThread());
+	Trc_MM_ConcurrentCollectionCardCleaningScanned(env->getLanguageVMThread(),
+		cardTable->getCardTableStats()->getConcurrentScannedCards(),
+		cardTable->getCardTableStats()->getConcurrentSkippedCards(),
+		cardTable->getCardTableStats()->getFinalScannedCards(),
+		cardTable->getCardTableStats()->getFinalSkippedCards()
+	);
 	TRIGGER_J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END(
 		_extensions->privateHookInterface,
 		env->getOmrVMThread(),
@@ -3009,7 +3017,7 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 			_dispatcher->run(envStandard, &clearNewMarkBitsTask);
 
 			/* If remembered set if not empty then re-scan any objects in the remembered set */
-			if (!(_extensions->rememberedSet.isEmpty())) {
+			if (!(_extensions->rememberedSet.isEmpty()) || (NULL != _extensions->rememberedSetCardTable)) {
 				MM_ConcurrentScanRememberedSetTask scanRememberedSetTask(envStandard, _dispatcher, this, envStandard->_cycleState);
 				_dispatcher->run(envStandard, &scanRememberedSetTask);
 			}
@@ -3522,7 +3530,7 @@ MM_ConcurrentGC::scanRememberedSet(MM_EnvironmentStandard *env)
 {
 	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 	MM_SublistPuddle *puddle;
- 	omrobjectptr_t *slotPtr, objectPtr;
+ 	omrobjectptr_t *slotPtr;
  	uintptr_t RSObjects = 0;
  	uintptr_t bytesTraced = 0;
  	uintptr_t maxPushes = _markingScheme->getWorkPackets()->getSlotsInPacket() / 2;
@@ -3530,46 +3538,18 @@ MM_ConcurrentGC::scanRememberedSet(MM_EnvironmentStandard *env)
 	env->_workStack.reset(env, _markingScheme->getWorkPackets());
 	env->_workStack.clearPushCount();
 
-	GC_SublistIterator rememberedSetIterator(&_extensions->rememberedSet);
-	while((puddle = rememberedSetIterator.nextList()) != NULL) {
-		if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-			GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
-			while((slotPtr = (omrobjectptr_t*)rememberedSetSlotIterator.nextSlot()) != NULL) {
-				objectPtr = *slotPtr;
-				/* For all objects in remembered set that have been marked scan the object
-				 * unless its card is dirty in which case we leave it for later processing
-				 * by finalCleanCards()
-				 */
-				if((objectPtr >= _heapBase)
-					&& (objectPtr <  _heapAlloc)
-					&& _markingScheme->isMarkedOutline(objectPtr)
-					&& !_cardTable->isObjectInDirtyCardNoCheck(env,objectPtr)) {
-						RSObjects += 1;
-						if (_extensions->dirtCardDuringRSScan) {
-							_cardTable->dirtyCard(env, objectPtr);
-						} else {
-							/* VMDESIGN 2048 -- due to barrier elision optimizations, the JIT may not have dirtied
-							 * cards for some objects in the remembered set. Therefore we may discover references
-							 * to both nursery and tenure objects while scanning remembered objects.
-							 */
-
-							bytesTraced += _markingScheme->scanObjectWithSize(env,objectPtr, MM_CollectorLanguageInterface::SCAN_REASON_REMEMBERED_SET_SCAN, SCAN_MAX);
-
-							/* Have we pushed enough new references? */
-							if(env->_workStack.getPushCount() >= maxPushes) {
-								/* To reduce the chances of mark stack overflow, we do some marking
-								 * of what we have just pushed.
-								 *
-								 * WARNING. If we HALTED concurrent then we will process any remaining
-								 * workpackets at this point. This will make RS processing appear more
-								 * expensive than it really is.
-								 */
-								while(NULL != (objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env))) {
-									bytesTraced += _markingScheme->scanObjectWithSize(env, objectPtr, MM_CollectorLanguageInterface::SCAN_REASON_PACKET, SCAN_MAX);
-								}
-								env->_workStack.clearPushCount();
-							}
-						}
+	if (NULL != _extensions->rememberedSetCardTable) {
+		MM_CardCleanerForRememberedSetScan cardCleaner(this, _extensions->rememberedSetCardTable, maxPushes);
+		_extensions->rememberedSetCardTable->cleanCardTable(env, &cardCleaner);
+		RSObjects = cardCleaner.getRememberedObjectsScanned();
+		bytesTraced = cardCleaner.getBytesTraced();
+	} else {
+		GC_SublistIterator rememberedSetIterator(&_extensions->rememberedSet);
+		while((puddle = rememberedSetIterator.nextList()) != NULL) {
+			if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
+				while((slotPtr = (omrobjectptr_t*)rememberedSetSlotIterator.nextSlot()) != NULL) {
+					scanRememberedObject(env, *slotPtr, maxPushes, &RSObjects, &bytesTraced);
 				}
 			}
 		}
@@ -3590,6 +3570,47 @@ MM_ConcurrentGC::scanRememberedSet(MM_EnvironmentStandard *env)
 	_stats->incRSScanTraceCount(bytesTraced);
 }
 
+void
+MM_ConcurrentGC::scanRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t maxPushes, uintptr_t *rememberedObjectsScanned, uintptr_t *bytesTraced)
+{
+	/* For all objects in remembered set that have been marked scan the object
+	 * unless its card is dirty in which case we leave it for later processing
+	 * by finalCleanCards()
+	 */
+	if((objectPtr >= _heapBase)
+		&& (objectPtr <  _heapAlloc)
+		&& _markingScheme->isMarkedOutline(objectPtr)
+		&& !_cardTable->isObjectInDirtyCardNoCheck(env,objectPtr)) {
+			*rememberedObjectsScanned += 1;
+			if (_extensions->dirtCardDuringRSScan) {
+				_cardTable->dirtyCard(env, objectPtr);
+			} else {
+				/* VMDESIGN 2048 -- due to barrier elision optimizations, the JIT may not have dirtied
+				 * cards for some objects in the remembered set. Therefore we may discover references
+				 * to both nursery and tenure objects while scanning remembered objects.
+				 */
+
+				*bytesTraced += _markingScheme->scanObjectWithSize(env,objectPtr, MM_CollectorLanguageInterface::SCAN_REASON_REMEMBERED_SET_SCAN, SCAN_MAX);
+
+				/* Have we pushed enough new references? */
+				if(env->_workStack.getPushCount() >= maxPushes) {
+					/* To reduce the chances of mark stack overflow, we do some marking
+					 * of what we have just pushed.
+					 *
+					 * WARNING. If we HALTED concurrent then we will process any remaining
+					 * workpackets at this point. This will make RS processing appear more
+					 * expensive than it really is.
+					 */
+					omrobjectptr_t pushedObjectPtr = NULL;
+					while(NULL != (pushedObjectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env))) {
+						*bytesTraced += _markingScheme->scanObjectWithSize(env, pushedObjectPtr, MM_CollectorLanguageInterface::SCAN_REASON_PACKET, SCAN_MAX);
+					}
+					env->_workStack.clearPushCount();
+				}
+			}
+	}
+}
+
 /**
  * Process object removed from remembered set.
  * The scavenger has removed an object from the remembered set because
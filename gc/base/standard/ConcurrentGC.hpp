@@ -380,6 +380,15 @@ protected:
 	virtual void internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode);
 	virtual void internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
 
+	/**
+	 * A collection which completed a concurrent cycle was its final phase, one which aborted the cycle (or
+	 * found none in progress) was a full stop-the-world collection.
+	 */
+	virtual uintptr_t getPauseType(MM_EnvironmentBase *env)
+	{
+		return (CONCURRENT_TRACE_ONLY <= _stats->getExecutionModeAtGC()) ? OMR_GC_PAUSE_TYPE_CONCURRENT_FINAL : OMR_GC_PAUSE_TYPE_GLOBAL;
+	}
+
 public:
 	virtual uintptr_t getVMStateID() { return J9VMSTATE_GC_COLLECTOR_CONCURRENTGC; };
 
@@ -427,6 +436,15 @@ public:
 	void completeTracing(MM_EnvironmentStandard *env);
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	void scanRememberedSet(MM_EnvironmentStandard *env);
+	/**
+	 * Rescan an object of the remembered set if it has been marked and its card is not dirty.
+	 * @param env[in] the current thread
+	 * @param objectPtr[in] the remembered object
+	 * @param maxPushes[in] number of references pushed after which the work stack is drained
+	 * @param rememberedObjectsScanned[in/out] incremented if the object is rescanned
+	 * @param bytesTraced[in/out] incremented by the number of bytes traced
+	 */
+	void scanRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t maxPushes, uintptr_t *rememberedObjectsScanned, uintptr_t *bytesTraced);
 	void objectRemovedFromRememberedSet(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
 #endif /* OMR_GC_MODRON_SCAVENGER */
 	
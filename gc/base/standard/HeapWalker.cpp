@@ -25,6 +25,7 @@
 #include "Dispatcher.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapIterator.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "MemorySubSpace.hpp"
@@ -32,6 +33,7 @@
 #include "ObjectIterator.hpp"
 #include "ObjectModel.hpp"
 #include "OMRVMInterface.hpp"
+#include "RememberedSetCardTable.hpp"
 #include "SlotObject.hpp"
 #include "SublistIterator.hpp"
 #include "SublistSlotIterator.hpp"
@@ -138,14 +140,31 @@ MM_HeapWalker::rememberedObjectSlotsDo(MM_EnvironmentBase *env, MM_HeapWalkerSlo
 	omrobjectptr_t* slotPtr = NULL;
 	MM_SublistPuddle *puddle = NULL;
 	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+	MM_GCExtensionsBase *extensions = env->getExtensions();
 
-	GC_SublistIterator remSetIterator(&(env->getExtensions()->rememberedSet));
-	while ((puddle = remSetIterator.nextList()) != NULL) {
-		if (!parallel || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-			GC_SublistSlotIterator remSetSlotIterator(puddle);
-			while ((slotPtr = (omrobjectptr_t*)remSetSlotIterator.nextSlot()) != NULL) {
-				if (*slotPtr != NULL) {
-					heapWalkerObjectSlotDo(omrVMThread, NULL, *slotPtr, &slotObjectDoUserData);
+	if (NULL != extensions->rememberedSetCardTable) {
+		/* walk the remembered object bits of each region */
+		MM_HeapMap *rememberedObjectMap = extensions->rememberedSetCardTable->getRememberedObjectMap();
+		GC_HeapRegionIterator regionIterator(extensions->heap->getHeapRegionManager());
+		MM_HeapRegionDescriptor *region = NULL;
+		while (NULL != (region = regionIterator.nextRegion())) {
+			if (!parallel || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				MM_HeapMapIterator rememberedObjectIterator(extensions, rememberedObjectMap, (uintptr_t *)region->getLowAddress(), (uintptr_t *)region->getHighAddress(), false);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = rememberedObjectIterator.nextObject())) {
+					heapWalkerObjectSlotDo(omrVMThread, region, objectPtr, &slotObjectDoUserData);
+				}
+			}
+		}
+	} else {
+		GC_SublistIterator remSetIterator(&(extensions->rememberedSet));
+		while ((puddle = remSetIterator.nextList()) != NULL) {
+			if (!parallel || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				GC_SublistSlotIterator remSetSlotIterator(puddle);
+				while ((slotPtr = (omrobjectptr_t*)remSetSlotIterator.nextSlot()) != NULL) {
+					if (*slotPtr != NULL) {
+						heapWalkerObjectSlotDo(omrVMThread, NULL, *slotPtr, &slotObjectDoUserData);
+					}
 				}
 			}
 		}
@@ -36,7 +36,10 @@
 #include "EnvironmentBase.hpp"
 #include "GlobalAllocationManager.hpp"
 #include "Heap.hpp"
+#include "HeapRegionDescriptorStandard.hpp"
+#include "HeapRegionIteratorStandard.hpp"
 #include "MarkingScheme.hpp"
+#include "MarkMapClearer.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "MemorySubSpaceSemiSpace.hpp"
@@ -53,6 +56,7 @@
 #include "ParallelSweepScheme.hpp"
 #include "ParallelTask.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER)
+#include "RememberedSetCardTable.hpp"
 #include "Scavenger.hpp"
 #endif /* OMR_GC_MODRON_SCAVENGER */
 #include "WorkPackets.hpp"
@@ -118,6 +122,23 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 	}
 	_cli->parallelGlobalGC_setMarkingScheme(env, _markingScheme);
 
+	if (_extensions->backgroundMarkMapClear) {
+		/* concurrent mark and concurrent sweep use the mark map between collections, so it can not be cleared behind them */
+		bool markMapInUseBetweenCollections = false;
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		markMapInUseBetweenCollections = markMapInUseBetweenCollections || _extensions->concurrentMark;
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+		markMapInUseBetweenCollections = markMapInUseBetweenCollections || _extensions->concurrentSweep;
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+		if (!markMapInUseBetweenCollections) {
+			if(NULL == (_markMapClearer = MM_MarkMapClearer::newInstance(env))) {
+				goto error_no_memory;
+			}
+			_markingScheme->setMarkMapClearer(_markMapClearer);
+		}
+	}
+
 	_sweepScheme = createSweepScheme(env, this);
 	if(NULL == _sweepScheme) {
 		goto error_no_memory;
@@ -173,6 +194,11 @@ MM_ParallelGlobalGC::tearDown(MM_EnvironmentBase *env)
 	
 	_cli->parallelGlobalGC_destroyHeapWalker(env);
 
+	if(NULL != _markMapClearer) {
+		_markMapClearer->kill(env);
+		_markMapClearer = NULL;
+	}
+
 	if(NULL != _markingScheme) {
 		_markingScheme->kill(env);
 		_markingScheme = NULL;
@@ -244,6 +270,15 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 	uintptr_t regionSize = _extensions->regionSize;
 	Assert_MM_true((0 != regionSize) && (0 == (heapBase % regionSize)));
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/* The free lists still describe the heap as of the last sweep, so pick the areas a partial compaction
+	 * would evacuate now.  A concurrent mark did not record the objects referring into them, so is excluded.
+	 */
+	if (initMarkMap) {
+		_compactScheme->selectPartialCompactAreas(env);
+	}
+#endif /* OMR_GC_MODRON_COMPACTION */
+
 	/* Reset memory pools of associated memory spaces */
 	_extensions->heap->resetSpacesForGarbageCollect(env);
 	
@@ -265,6 +300,12 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 	masterThreadReportObjectEvents(env);
 
 	_cli->parallelGlobalGC_postMarkProcessing(env);
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetCardTable) {
+		masterThreadForgetUnmarkedRememberedObjects(env);
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 	
 	sweep(env, allocDescription, rebuildMarkBits);
 
@@ -281,6 +322,11 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 		}
 
 		masterThreadCompact(env, allocDescription, rebuildMarkBits);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		if (NULL != _extensions->rememberedSetCardTable) {
+			masterThreadRebuildRememberedSetCardTable(env);
+		}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 		_collectionStatistics._tenureFragmentation = NO_FRAGMENTATION;
 	} else {
 		/* If a compaction was prevented, report the reason */
@@ -298,6 +344,7 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 			_collectionStatistics._tenureFragmentation |= MACRO_FRAGMENTATION;
 		}
 	}
+	_compactScheme->clearPartialCompactAreas(env);
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */	
 
 	bool didCompact = false;
@@ -615,6 +662,7 @@ MM_ParallelGlobalGC::sweep(MM_EnvironmentBase *env, MM_AllocateDescription *allo
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	sweepStats->_endTime = omrtime_hires_clock();
+	_extensions->pauseTimeStats.recordPause(env, OMR_GC_PAUSE_TYPE_SWEEP, sweepStats->_startTime, sweepStats->_endTime);
 	reportSweepEnd(env);
 }
 
@@ -661,15 +709,31 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 	}
 
 	/* run the mark */
-	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState, _markThreadCount.getRecommendedThreadCount());
+	uint64_t markTaskStartTime = omrtime_hires_clock();
 	_dispatcher->run(env, &markTask);
+	uint64_t markTaskEndTime = omrtime_hires_clock();
+
+	uint64_t stallTime = 0;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	stallTime = markStats->getStallTime() + _extensions->globalGCStats.workPacketStats.getStallTime();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	/* the bytes scanned by this mark are the best guess at the bytes the next one will scan */
+	_markThreadCount.recordTask(env, markTask.getThreadCount(), markStats->_bytesScanned, markTaskStartTime, markTaskEndTime, stallTime);
 	
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
+	if ((NULL != _markMapClearer) && _markMapClearer->isArmed()) {
+		/* the mark task finished clearing the map, so its ranges have been consumed */
+		markStats->_markMapBytesClearedConcurrently = _markMapClearer->getBytesClearedConcurrently();
+		_markMapClearer->disarm();
+	}
+
 	/* Do any post mark checks */
 	postMark(env);
 	_markingScheme->masterCleanupAfterGC(env);
 	markStats->_endTime = omrtime_hires_clock();
+	_extensions->pauseTimeStats.recordPause(env, OMR_GC_PAUSE_TYPE_MARK, markStats->_startTime, markStats->_endTime);
 	reportMarkEnd(env);
 }
 
@@ -708,6 +772,7 @@ MM_ParallelGlobalGC::masterThreadCompact(MM_EnvironmentBase *env, MM_AllocateDes
 	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, env->_cycleState->_gcCode.shouldAggressivelyCompact());
 	_dispatcher->run(env, &compactTask);
 	compactStats->_endTime = omrtime_hires_clock();
+	_extensions->pauseTimeStats.recordPause(env, OMR_GC_PAUSE_TYPE_COMPACT, compactStats->_startTime, compactStats->_endTime);
 	reportCompactEnd(env);
 	
 	/* Remember the gc count of the last compaction */ 
@@ -720,6 +785,35 @@ MM_ParallelGlobalGC::masterThreadCompact(MM_EnvironmentBase *env, MM_AllocateDes
 }
 #endif /* OMR_GC_MODRON_COMPACTION */
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+void
+MM_ParallelGlobalGC::masterThreadForgetUnmarkedRememberedObjects(MM_EnvironmentBase *env)
+{
+	MM_MarkMap *markMap = _markingScheme->getMarkMap();
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	GC_HeapRegionIteratorStandard regionIterator(_extensions->heap->getHeapRegionManager());
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if ((NULL != region->getSubSpace()) && (MEMORY_TYPE_OLD == (region->getTypeFlags() & MEMORY_TYPE_OLD))) {
+			_extensions->rememberedSetCardTable->forgetUnmarkedObjects(env, markMap, region->getLowAddress(), region->getHighAddress());
+		}
+	}
+}
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+void
+MM_ParallelGlobalGC::masterThreadRebuildRememberedSetCardTable(MM_EnvironmentBase *env)
+{
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	GC_HeapRegionIteratorStandard regionIterator(_extensions->heap->getHeapRegionManager());
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if ((NULL != region->getSubSpace()) && (MEMORY_TYPE_OLD == (region->getTypeFlags() & MEMORY_TYPE_OLD))) {
+			_extensions->rememberedSetCardTable->rebuildForRange(env, region->getLowAddress(), region->getHighAddress());
+		}
+	}
+}
+#endif /* OMR_GC_MODRON_COMPACTION */
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 void
 MM_ParallelGlobalGC::masterThreadRestartAllocationCaches(MM_EnvironmentBase *env)
 {
@@ -766,6 +860,11 @@ MM_ParallelGlobalGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	GC_OMRVMInterface::flushCachesForGC(env);
 	
 	_markingScheme->getMarkMap()->setMarkMapValid(false);
+
+	if (NULL != _markMapClearer) {
+		/* the mark map is about to be used, stop the background clearer (anything it did not get to is cleared by the mark task) */
+		_markMapClearer->pauseClearing(env);
+	}
 	
 	if (_extensions->processLargeAllocateStats) {
 		processLargeAllocateStatsBeforeGC(env);
@@ -799,6 +898,11 @@ MM_ParallelGlobalGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSp
 	objectMap->setMarkMap(markMap);
 #endif
 
+	if (NULL != _markMapClearer) {
+		/* nothing needs the mark bits until the next collection, so clear the map while the mutators run */
+		_markMapClearer->startClearing(env, _markingScheme->getMarkMap());
+	}
+
 	env->_cycleState->_activeSubSpace = NULL;
 
 	/* Clear overflow flag regardless */
@@ -910,6 +1014,11 @@ MM_ParallelGlobalGC::prepareHeapForWalk(MM_EnvironmentBase *env)
 {
 	GC_OMRVMInterface::flushCachesForGC(env);
 
+	if (NULL != _markMapClearer) {
+		/* the walk leaves its marks in the map, so the next collection has to clear all of it */
+		_markMapClearer->cancelClearing(env);
+	}
+
 	_markingScheme->masterSetupForWalk(env);
 	
 	/* Run a parallel mark */
@@ -920,12 +1029,31 @@ MM_ParallelGlobalGC::prepareHeapForWalk(MM_EnvironmentBase *env)
 	_cli->parallelGlobalGC_postPrepareHeapForWalk(env);
 }
 
+/* (non-doxygen)
+ * @see MM_GlobalCollector::abortCollection()
+ */
+void
+MM_ParallelGlobalGC::abortCollection(MM_EnvironmentBase* env, CollectionAbortReason reason)
+{
+	if (NULL != _markMapClearer) {
+		/* the mark map may be taken over (e.g. by a scavenger remembered set overflow), stop clearing it */
+		_markMapClearer->cancelClearing(env);
+	}
+
+	MM_GlobalCollector::abortCollection(env, reason);
+}
+
 /* (non-doxygen)
  * @see MM_GlobalCollector::heapAddRange()
  */
 bool
 MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress)
 {
+	if (NULL != _markMapClearer) {
+		/* the committed ranges the clearer was armed with are about to change */
+		_markMapClearer->cancelClearing(env);
+	}
+
 	bool result = _markingScheme->heapAddRange(env, subspace, size, lowAddress, highAddress);
 	if (0 == result) {
 		goto markingScheme_failed_heapAddRange;
@@ -943,6 +1071,15 @@ MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 	}
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetCardTable) {
+		result = _extensions->rememberedSetCardTable->heapAddRange(env, subspace, size, lowAddress, highAddress);
+		if (0 == result) {
+			goto rememberedSetCardTable_failed_heapAddRange;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 	result = _cli->parallelGlobalGC_heapAddRange(env, subspace, size, lowAddress, highAddress);
 	if (0 == result) {
 		goto parallelGlobalGC_failed_heapAddRange;
@@ -953,6 +1090,12 @@ MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 	}
 
 parallelGlobalGC_failed_heapAddRange:
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetCardTable) {
+		_extensions->rememberedSetCardTable->heapRemoveRange(env, subspace, size, lowAddress, highAddress, NULL, NULL);
+	}
+rememberedSetCardTable_failed_heapAddRange:
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #if defined(OMR_GC_OBJECT_MAP)
 	_extensions->getObjectMap()->heapRemoveRange(env, subspace, size, lowAddress, highAddress, NULL, NULL);
 objectMap_failed_heapAddRange:
@@ -972,8 +1115,17 @@ end:
 bool
 MM_ParallelGlobalGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace,uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
 {
+	if (NULL != _markMapClearer) {
+		_markMapClearer->cancelClearing(env);
+	}
+
 	bool result = _markingScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 	result = result && _sweepScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetCardTable) {
+		result = result && _extensions->rememberedSetCardTable->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 
 	result = result && _cli->parallelGlobalGC_heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 
@@ -998,12 +1150,18 @@ MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 		extensions->scavenger->collectorStartup(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	if ((NULL != _markMapClearer) && !_markMapClearer->startup()) {
+		return false;
+	}
 	return true;
 }
 
 void
 MM_ParallelGlobalGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+	if (NULL != _markMapClearer) {
+		_markMapClearer->shutdown();
+	}
 #if defined(J9VM_GC_MODRON_SCAVENGER)
 	if (extensions->scavengerEnabled && (NULL != extensions->scavenger)) {
 		extensions->scavenger->collectorShutdown(extensions);
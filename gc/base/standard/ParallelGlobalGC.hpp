@@ -22,6 +22,7 @@
 #include "omrcfg.h"
 #include "modronopt.h"
 
+#include "AdaptiveThreadCount.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 #include "ConcurrentSweepScheme.hpp"
@@ -39,6 +40,7 @@ class MM_CollectionStatisticsStandard;
 class MM_CompactScheme;
 class MM_Dispatcher;
 class MM_MarkingScheme;
+class MM_MarkMapClearer;
 class MM_MemorySubSpace;
 
 /**
@@ -62,8 +64,10 @@ private:
 
 protected:
 	MM_MarkingScheme *_markingScheme;
+	MM_MarkMapClearer *_markMapClearer; /**< Clears the mark map between collections, NULL unless backgroundMarkMapClear is enabled */
 	MM_ParallelSweepScheme *_sweepScheme;
 	MM_Dispatcher *_dispatcher;
+	MM_AdaptiveThreadCount _markThreadCount; /**< thread count recommended for the mark task when adaptiveGCThreading is enabled */
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
 public:
@@ -162,6 +166,20 @@ private:
 	void masterThreadCompact(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool rebuildMarkBits);
 #endif /* OMR_GC_MODRON_COMPACTION */
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * Forget the objects in the remembered set card table which the global mark found to be dead.
+	 */
+	void masterThreadForgetUnmarkedRememberedObjects(MM_EnvironmentBase *env);
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/**
+	 * Rebuild the remembered set card table from the remembered bits of the objects left in tenure space by compaction.
+	 */
+	void masterThreadRebuildRememberedSetCardTable(MM_EnvironmentBase *env);
+#endif /* OMR_GC_MODRON_COMPACTION */
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 	/**
 	 *  Fixes up all unloaded objects so that the heap can be walked and only live objects returned
 	 *  @param reason fix heap reason
@@ -261,6 +279,8 @@ public:
 
 	virtual void prepareHeapForWalk(MM_EnvironmentBase *env);
 
+	virtual void abortCollection(MM_EnvironmentBase* env, CollectionAbortReason reason);
+
 	void workThreadGarbageCollect(MM_EnvironmentBase *env);
 
 	virtual bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
@@ -308,8 +328,10 @@ public:
 		, _compactThisCycle(false)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, _markingScheme(NULL)
+		, _markMapClearer(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _markThreadCount(_extensions->adaptiveGCThreadingBytesPerThread)
 		, _cycleState()
 		, _collectionStatistics()
 	{
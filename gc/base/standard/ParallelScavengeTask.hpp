@@ -39,6 +39,7 @@ class MM_ParallelScavengeTask : public MM_ParallelTask
 protected:
 	MM_Scavenger *_collector;
 	MM_CycleState *_cycleState;  /**< Collection cycle state active for the task */
+	uintptr_t _recommendedThreads; /**< thread count recommended by the collector, UDATA_MAX for none */
 
 public:
 	virtual UDATA getVMStateID() { return J9VMSTATE_GC_SCAVENGE; };
@@ -47,6 +48,11 @@ public:
 	virtual void setup(MM_EnvironmentBase *env);
 	virtual void cleanup(MM_EnvironmentBase *env);
 
+	/**
+	 * @see MM_Task::getRecommendedWorkingThreads()
+	 */
+	virtual uintptr_t getRecommendedWorkingThreads() { return _recommendedThreads; }
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/**
 	 * Override to collect stall time statistics.
@@ -70,10 +76,11 @@ public:
 	/**
 	 * Create a ParallelScavengeTask object.
 	 */
-	MM_ParallelScavengeTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_Scavenger *collector,MM_CycleState *cycleState) :
+	MM_ParallelScavengeTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_Scavenger *collector,MM_CycleState *cycleState, uintptr_t recommendedThreads = UDATA_MAX) :
 		MM_ParallelTask(env, dispatcher)
 		,_collector(collector)
 		,_cycleState(cycleState)
+		,_recommendedThreads(recommendedThreads)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -24,11 +24,13 @@
 #include <string.h>
 
 #include "AllocateDescription.hpp"
+#include "AtomicOperations.hpp"
 #include "Bits.hpp"
 #include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapKernels.hpp"
 #include "HeapMemoryPoolIterator.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "MemoryPool.hpp"
@@ -337,14 +339,8 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		/* skip the run of empty mark map words */
+		markMapCurrent = MM_HeapMapKernels::findNonZeroWord(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -590,6 +586,35 @@ MM_ParallelSweepScheme::prepareAllChunks(MM_EnvironmentBase *env)
 	return _sweepHeapSectioning->reassignChunks(env);
 }
 
+/**
+ * Sweep a chunk claimed by the current thread.
+ * Flushes and initializes the free entry size class statistics if the chunk belongs to a different memory pool than the
+ * previously swept chunk.
+ *
+ * @param chunk the chunk to sweep
+ * @param prevChunk the chunk previously swept by this thread, or NULL if this is the first
+ */
+void
+MM_ParallelSweepScheme::sweepClaimedChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk, MM_ParallelSweepChunk *prevChunk)
+{
+	/* if we are changing memory pool, flush the thread local stats to appropriate (previous) pool */
+	if ((NULL != prevChunk) && (prevChunk->memoryPool != chunk->memoryPool)) {
+		prevChunk->memoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+	}
+
+	/* if we are starting or changing memory pool, setup frequent allocation sizes in free entry stats for the pool we are about to sweep */
+	if ((NULL == prevChunk) || (prevChunk->memoryPool != chunk->memoryPool)) {
+		MM_MemoryPool *topLevelMemoryPool = chunk->memoryPool->getParent();
+		if (NULL == topLevelMemoryPool) {
+			topLevelMemoryPool = chunk->memoryPool;
+		}
+		env->_freeEntrySizeClassStats.initializeFrequentAllocation(topLevelMemoryPool->getLargeObjectAllocateStats());
+	}
+
+	/* Sweep the chunk */
+	sweepChunk(env, chunk);
+}
+
 /**
  * Sweep all chunks.
  * 
@@ -598,6 +623,11 @@ MM_ParallelSweepScheme::prepareAllChunks(MM_EnvironmentBase *env)
 void
 MM_ParallelSweepScheme::sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalChunkCount)
 {
+	if (_extensions->numaAwareGCWork && (0 != _extensions->_numaManager.getAffinityLeaderCount())) {
+		sweepAllChunksByNumaNode(env, totalChunkCount);
+		return;
+	}
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t chunksProcessed = 0; /* Chunks processed by this thread */
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
@@ -617,23 +647,8 @@ MM_ParallelSweepScheme::sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalC
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)                           
 			chunksProcessed += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
- 
- 			/* if we are changing memory pool, flush the thread local stats to appropriate (previous) pool */
-			if ((NULL != prevChunk) && (prevChunk->memoryPool != chunk->memoryPool)) {
-				prevChunk->memoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
-			}
 
- 			/* if we are starting or changing memory pool, setup frequent allocation sizes in free entry stats for the pool we are about to sweep */
-			if ((NULL == prevChunk) || (prevChunk->memoryPool != chunk->memoryPool)) {
-				MM_MemoryPool *topLevelMemoryPool = chunk->memoryPool->getParent();
-				if (NULL == topLevelMemoryPool) {
-					topLevelMemoryPool = chunk->memoryPool;
-				}
-				env->_freeEntrySizeClassStats.initializeFrequentAllocation(topLevelMemoryPool->getLargeObjectAllocateStats());
-			}
- 
-        	/* Sweep the chunk */
-			sweepChunk(env, chunk);
+			sweepClaimedChunk(env, chunk, prevChunk);
 
 			prevChunk = chunk;
 		}	
@@ -650,6 +665,61 @@ MM_ParallelSweepScheme::sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalC
 	}
 }
 
+/**
+ * Sweep all chunks, preferring chunks backed by the NUMA node of the current thread.
+ * A first pass claims chunks on the thread's own node (or with no node affinity), and only once those
+ * are exhausted does the thread help with chunks belonging to other nodes.
+ * Chunks are claimed individually since the shared work unit counter cannot express affinity.
+ * 
+ * @param totalChunkCount total number of chunks to be swept
+ */
+void
+MM_ParallelSweepScheme::sweepAllChunksByNumaNode(MM_EnvironmentBase *env, uintptr_t totalChunkCount)
+{
+	uintptr_t numaNode = _extensions->_numaManager.getAffinityLeaderForGCThread(env->getSlaveID());
+	uintptr_t chunksLocal = 0;
+	uintptr_t chunksRemote = 0;
+	MM_ParallelSweepChunk *prevChunk = NULL;
+
+	for (uintptr_t pass = 0; pass < 2; pass++) {
+		bool localPass = (0 == pass);
+		MM_SweepHeapSectioningIterator sectioningIterator(_sweepHeapSectioning);
+
+		for (uintptr_t chunkNum = 0; chunkNum < totalChunkCount; chunkNum++) {
+			MM_ParallelSweepChunk *chunk = sectioningIterator.nextChunk();
+			Assert_MM_true(chunk != NULL);  /* Should never return NULL */
+
+			bool isLocal = (0 == chunk->_numaNode) || (numaNode == chunk->_numaNode);
+			if ((isLocal == localPass)
+				&& (0 == chunk->_sweepClaimed)
+				&& (0 == MM_AtomicOperations::lockCompareExchange(&chunk->_sweepClaimed, 0, 1))
+			) {
+				if (isLocal) {
+					chunksLocal += 1;
+				} else {
+					chunksRemote += 1;
+				}
+
+				sweepClaimedChunk(env, chunk, prevChunk);
+
+				prevChunk = chunk;
+			}
+		}
+	}
+
+	env->_sweepStats._sweepChunksLocal = chunksLocal;
+	env->_sweepStats._sweepChunksRemote = chunksRemote;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	env->_sweepStats.sweepChunksProcessed = chunksLocal + chunksRemote;
+	env->_sweepStats.sweepChunksTotal = totalChunkCount;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	/* flush the remaining stats (since the the last pool switch) */
+	if (NULL != prevChunk) {
+		prevChunk->memoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+	}
+}
+
 /**
  * Connect a chunk into the free list.
  * Given a previously swept chunk, connect its data to the free list of the associated memory subspace.
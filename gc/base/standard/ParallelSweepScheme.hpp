@@ -123,7 +123,9 @@ protected:
 	void sweepMarkMapTail(uintptr_t *markMapCurrent, uintptr_t *markMapChunkTop, uintptr_t &heapSlotFreeCount);
 
 	bool sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *sweepChunk);
+	void sweepClaimedChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk, MM_ParallelSweepChunk *prevChunk);
 	void sweepAllChunks(MM_EnvironmentBase *env, uintptr_t totalChunkCount);
+	void sweepAllChunksByNumaNode(MM_EnvironmentBase *env, uintptr_t totalChunkCount);
 	uintptr_t prepareAllChunks(MM_EnvironmentBase *env);
 	
 	virtual void connectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk);
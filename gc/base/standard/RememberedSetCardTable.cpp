@@ -0,0 +1,142 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "RememberedSetCardTable.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapMapIterator.hpp"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
+#include "ObjectModel.hpp"
+
+MM_RememberedSetCardTable *
+MM_RememberedSetCardTable::newInstance(MM_EnvironmentBase *env, MM_Heap *heap)
+{
+	MM_RememberedSetCardTable *cardTable = (MM_RememberedSetCardTable *)env->getForge()->allocate(sizeof(MM_RememberedSetCardTable), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != cardTable) {
+		new(cardTable) MM_RememberedSetCardTable();
+		if (!cardTable->initialize(env, heap)) {
+			cardTable->kill(env);
+			cardTable = NULL;
+		}
+	}
+	return cardTable;
+}
+
+bool
+MM_RememberedSetCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
+{
+	if (!MM_CardTable::initialize(env, heap)) {
+		return false;
+	}
+
+	_rememberedObjectMap = MM_MarkMap::newInstance(env, heap->getMaximumPhysicalRange());
+	return NULL != _rememberedObjectMap;
+}
+
+void
+MM_RememberedSetCardTable::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _rememberedObjectMap) {
+		_rememberedObjectMap->kill(env);
+		_rememberedObjectMap = NULL;
+	}
+	MM_CardTable::tearDown(env);
+}
+
+bool
+MM_RememberedSetCardTable::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress)
+{
+	_heapAlloc = env->getExtensions()->heap->getHeapTop();
+
+	bool result = commitCardTableMemory(env, heapAddrToCardAddr(env, lowAddress), heapAddrToCardAddr(env, highAddress));
+	if (result) {
+		result = _rememberedObjectMap->heapAddRange(env, size, lowAddress, highAddress);
+		if (result) {
+			/* memory may have been in use before a previous contraction */
+			clearCardsInRange(env, lowAddress, highAddress);
+			_rememberedObjectMap->setBitsInRange(env, lowAddress, highAddress, true);
+		}
+	}
+	return result;
+}
+
+bool
+MM_RememberedSetCardTable::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
+{
+	Card *lowValidCard = NULL;
+	if (NULL != lowValidAddress) {
+		lowValidCard = heapAddrToCardAddr(env, lowValidAddress);
+	}
+	Card *highValidCard = NULL;
+	if (NULL != highValidAddress) {
+		highValidCard = heapAddrToCardAddr(env, highValidAddress);
+	}
+
+	bool result = decommitCardTableMemory(env, heapAddrToCardAddr(env, lowAddress), heapAddrToCardAddr(env, highAddress), lowValidCard, highValidCard);
+	result = result && _rememberedObjectMap->heapRemoveRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+
+	_heapAlloc = env->getExtensions()->heap->getHeapTop();
+	return result;
+}
+
+bool
+MM_RememberedSetCardTable::hasRememberedObjects(MM_EnvironmentBase *env, void *lowAddress, void *highAddress)
+{
+	MM_HeapMapIterator rememberedObjectIterator(env->getExtensions(), _rememberedObjectMap, (uintptr_t *)lowAddress, (uintptr_t *)highAddress, false);
+	return NULL != rememberedObjectIterator.nextObject();
+}
+
+void
+MM_RememberedSetCardTable::forgetUnmarkedObjects(MM_EnvironmentBase *env, MM_MarkMap *markMap, void *lowAddress, void *highAddress)
+{
+	/* both maps cover the maximum physical range of the heap, so their slots line up */
+	uintptr_t slotIndex = _rememberedObjectMap->getSlotIndex((omrobjectptr_t)lowAddress);
+	uintptr_t topSlotIndex = _rememberedObjectMap->getSlotIndex((omrobjectptr_t)highAddress);
+	for (; slotIndex < topSlotIndex; slotIndex++) {
+		uintptr_t rememberedSlot = _rememberedObjectMap->getSlot(slotIndex);
+		if (0 != rememberedSlot) {
+			_rememberedObjectMap->setSlot(slotIndex, rememberedSlot & markMap->getSlot(slotIndex));
+		}
+	}
+}
+
+void
+MM_RememberedSetCardTable::rebuildForRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	clearCardsInRange(env, lowAddress, highAddress);
+	_rememberedObjectMap->setBitsInRange(env, lowAddress, highAddress, true);
+
+	GC_ObjectHeapIteratorAddressOrderedList objectIterator(extensions, (omrobjectptr_t)lowAddress, (omrobjectptr_t)highAddress, false);
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = objectIterator.nextObject())) {
+		if (extensions->objectModel.isRemembered(objectPtr)) {
+			_rememberedObjectMap->setBit(objectPtr);
+			dirtyCard(env, objectPtr);
+		}
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(REMEMBEREDSETCARDTABLE_HPP_)
+#define REMEMBEREDSETCARDTABLE_HPP_
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "CardTable.hpp"
+#include "MarkMap.hpp"
+
+class MM_EnvironmentBase;
+class MM_Heap;
+class MM_MemorySubSpace;
+
+/**
+ * Card table used by the scavenger in place of the remembered set sublist (see scavengerCardRememberedSet).
+ * The card holding the header of each remembered tenured object is dirtied, and the start of the object is
+ * recorded in a bit map, since there is no way to find the objects on a card of tenure space from the card alone.
+ * Neither structure can overflow, so the scavenger never has to walk tenure space to find remembered objects.
+ * A card is left dirty for as long as a remembered object starts on it.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_RememberedSetCardTable : public MM_CardTable
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	MM_MarkMap *_rememberedObjectMap; /**< One bit for the start of each remembered object */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_RememberedSetCardTable *newInstance(MM_EnvironmentBase *env, MM_Heap *heap);
+
+	/**
+	 * Commit and clear the cards and bits backing a range of memory added to the heap.
+	 * @return true if the memory could be committed
+	 */
+	bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
+
+	/**
+	 * Decommit the cards and bits backing a range of memory removed from the heap.
+	 * @return true if the memory could be decommitted
+	 */
+	bool heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Add a tenured object to the remembered set.  The object must already have its remembered bits set.
+	 * The bit is set before the card is dirtied so that a thread which cleans the card concurrently and then
+	 * rechecks its bits (see hasRememberedObjects()) can not miss the object.
+	 * @param env[in] the current thread
+	 * @param objectPtr[in] the object to remember
+	 */
+	MMINLINE void
+	rememberObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+	{
+		_rememberedObjectMap->atomicSetBit(objectPtr);
+		dirtyCard(env, objectPtr);
+	}
+
+	/**
+	 * Remove a tenured object from the remembered set.  The card holding it is left as is.
+	 * @param objectPtr[in] the object to forget
+	 */
+	MMINLINE void forgetObject(omrobjectptr_t objectPtr) { _rememberedObjectMap->atomicClearBit(objectPtr); }
+
+	/**
+	 * @return the bit map holding the start of each remembered object
+	 */
+	MMINLINE MM_MarkMap *getRememberedObjectMap() { return _rememberedObjectMap; }
+
+	/**
+	 * @param lowAddress[in] base of a heap range, typically the span of a card
+	 * @param highAddress[in] top of the heap range
+	 * @return true if a remembered object starts in the range
+	 */
+	bool hasRememberedObjects(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
+
+	/**
+	 * Forget the remembered objects in a range that a global mark found to be dead, before the range is swept
+	 * and their memory reused.  The cards holding them are left as is, to be cleaned by the next scavenge.
+	 * @param markMap[in] the mark map of the completed global mark
+	 * @param lowAddress[in] base of the range
+	 * @param highAddress[in] top of the range
+	 */
+	void forgetUnmarkedObjects(MM_EnvironmentBase *env, MM_MarkMap *markMap, void *lowAddress, void *highAddress);
+
+	/**
+	 * Rebuild the cards and bits of a range of tenure space whose objects were moved by compaction,
+	 * remembering each object with its remembered bits set.  The range must be walkable.
+	 * @param lowAddress[in] base of the range
+	 * @param highAddress[in] top of the range
+	 */
+	void rebuildForRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
+
+	/**
+	 * Create a RememberedSetCardTable object.
+	 */
+	MM_RememberedSetCardTable()
+		: MM_CardTable()
+		, _rememberedObjectMap(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, MM_Heap *heap);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+private:
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+#endif /* REMEMBEREDSETCARDTABLE_HPP_ */
@@ -42,6 +42,7 @@
 
 #include "AllocateDescription.hpp"
 #include "AtomicOperations.hpp"
+#include "CardCleanerForScavenge.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "Collector.hpp"
 #include "CollectorLanguageInterface.hpp"
@@ -54,6 +55,7 @@
 #include "ForwardedHeader.hpp"
 #include "IndexableObjectScanner.hpp"
 #include "Heap.hpp"
+#include "HeapMapIterator.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
@@ -72,6 +74,7 @@
 #include "OMRVMThreadListIterator.hpp"
 #include "ParallelScavengeTask.hpp"
 #include "PhysicalSubArena.hpp"
+#include "RememberedSetCardTable.hpp"
 #include "RSOverflow.hpp"
 #include "Scavenger.hpp"
 #include "ScavengerBackOutScanner.hpp"
@@ -240,6 +243,11 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		/* deferred cache is only needed for hierarchical scanning */
 		_cachesPerThread = FLIP_TENURE_LARGE_SCAN_DEFERRED;
 		break;
+	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DEPTH_FIRST:
+		/* depth first copying only adds to the objects copied while scanning hierarchically */
+		_cachesPerThread = FLIP_TENURE_LARGE_SCAN_DEFERRED;
+		_depthFirstCopyLimit = _extensions->scavengerDepthFirstCopyLimit;
+		break;
 	default:
 		Assert_MM_unreachable();
 		break;
@@ -266,6 +274,14 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (_extensions->scavengerCardRememberedSet) {
+		/* the card table is committed as memory is added to the heap (see MM_ParallelGlobalGC::heapAddRange()) */
+		_extensions->rememberedSetCardTable = MM_RememberedSetCardTable::newInstance(env, _extensions->heap);
+		if (NULL == _extensions->rememberedSetCardTable) {
+			return false;
+		}
+	}
+
 	_cacheLineAlignment = CACHE_LINE_SIZE;
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -295,6 +311,11 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 		_freeCacheMonitor = NULL;
 	}
 
+	if (NULL != _extensions->rememberedSetCardTable) {
+		_extensions->rememberedSetCardTable->kill(env);
+		_extensions->rememberedSetCardTable = NULL;
+	}
+
 	J9HookInterface** mmOmrHooks = J9_HOOK_INTERFACE(_extensions->omrHookInterface);
 	/* Unregister hook for global GC end. */
 	(*mmOmrHooks)->J9HookUnregister(mmOmrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, hookGlobalCollectionStart, (void *)this);
@@ -431,6 +452,9 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	/* Clear the worker hot field statistics */
 	clearHotFieldStats(env);
 
+	/* Clear the root scan times recorded by the root range set */
+	env->_rootScannerStats.clear();
+
 	/* Clear local language-specific stats */
 	_cli->scavenger_workerSetupForGC_clearEnvironmentLangStats(env);
 
@@ -464,9 +488,20 @@ void
 MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 {
 	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
-	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState, _adaptiveThreadCount.getRecommendedThreadCount());
+	uint64_t startTime = omrtime_hires_clock();
 	_dispatcher->run(env, &scavengeTask);
 
+	uint64_t endTime = omrtime_hires_clock();
+	uint64_t stallTime = 0;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	stallTime = scavengerStats->getStallTime();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	/* the bytes copied by this scavenge are the best guess at the bytes the next one will copy */
+	_adaptiveThreadCount.recordTask(env, scavengeTask.getThreadCount(), scavengerStats->_flipBytes + scavengerStats->_tenureAggregateBytes, startTime, endTime, stallTime);
+
 	/* remove all scan caches temporary allocated in Heap */
 	_scavengeCacheFreeList.removeAllHeapAllocatedChunks(env);
 
@@ -707,6 +742,7 @@ MM_Scavenger::mergeGCStats(MM_EnvironmentStandard *env)
 											 finalGCStats->_failedTenureLargest);
 	finalGCStats->_failedFlipCount += scavStats->_failedFlipCount;
 	finalGCStats->_failedFlipBytes += scavStats->_failedFlipBytes;
+	finalGCStats->_depthFirstCopyCount += scavStats->_depthFirstCopyCount;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	finalGCStats->_acquireFreeListCount += scavStats->_acquireFreeListCount;
@@ -731,6 +767,8 @@ MM_Scavenger::mergeGCStats(MM_EnvironmentStandard *env)
 	finalGCStats->_tenureSpaceAllocationCountLarge += scavStats->_tenureSpaceAllocationCountLarge;
 	finalGCStats->_tenureSpaceAllocationCountSmall += scavStats->_tenureSpaceAllocationCountSmall;
 
+	finalGCStats->_rootScannerStats.merge(&env->_rootScannerStats);
+
 	if (env->isMasterThread()) {
 		finalGCStats->getFlipHistory(0)->_tenureMask = _tenureMask;
 		uintptr_t tenureAge = 0;
@@ -1657,7 +1695,22 @@ MM_Scavenger::incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobj
 				hotFieldStats->setHotnessOfField(slotObject->readAddressFromSlot(), objectScanner->getHotFieldsDescriptor());
 				hotFieldStats->updateStats(isParentInNewSpace, isSlotObjectInNewSpace, slotObject->readReferenceFromSlot());
 			}
-			*nextScanCache = aliasToCopyCache(env, slotObject, scanCache, *copyCache);
+			if ((0 != _depthFirstCopyLimit) && !objectScanner->isIndexableObject()
+				&& (MM_ScavengerHotFieldStats::Hot == MM_ScavengerHotFieldStats::getHotnessOfField(objectPtr, slotObject->readAddressFromSlot(), objectScanner->getHotFieldsDescriptor()))
+			) {
+				/* copy the hot descendants of the child behind it, then restore the cache that received the child for the aliasing check */
+				MM_CopyScanCacheStandard *childCopyCache = *copyCache;
+				depthFirstCopyHotDescendants(env, slotObject->readReferenceFromSlot());
+				if ((childCopyCache == env->_survivorCopyScanCache) || (childCopyCache == env->_tenureCopyScanCache)) {
+					*copyCache = childCopyCache;
+				} else {
+					/* the cache that received the child filled up and was released to the scan list, so it can not be aliased */
+					*copyCache = NULL;
+				}
+			}
+			if (NULL != *copyCache) {
+				*nextScanCache = aliasToCopyCache(env, slotObject, scanCache, *copyCache);
+			}
 			/* alias and switch to nextScanCache if it was selected */
 			if (NULL != *nextScanCache) {
 				updateCopyScanCounts(env, slotsScanned, slotsCopied);
@@ -1686,6 +1739,35 @@ MM_Scavenger::incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobj
 	}
 }
 
+MMINLINE void
+MM_Scavenger::depthFirstCopyHotDescendants(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	GC_ObjectScannerState objectScannerState;
+	uintptr_t depth = 0;
+	while ((NULL != objectPtr) && (depth < _depthFirstCopyLimit)) {
+		GC_ObjectScanner *objectScanner = _cli->scavenger_getObjectScanner(env, objectPtr, (void *) &objectScannerState, GC_ObjectScanner::scanHeap);
+		if ((NULL == objectScanner) || objectScanner->isLeafObject() || objectScanner->isIndexableObject()) {
+			break;
+		}
+		omrobjectptr_t hotChildPtr = NULL;
+		GC_SlotObject *slotObject = NULL;
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			if (MM_ScavengerHotFieldStats::Hot == MM_ScavengerHotFieldStats::getHotnessOfField(objectPtr, slotObject->readAddressFromSlot(), objectScanner->getHotFieldsDescriptor())) {
+				/* only the first hot field is followed, which bounds the work to one object per generation */
+				copyAndForward(env, slotObject);
+				if (NULL != env->_effectiveCopyScanCache) {
+					/* copied by this thread, so it is complete and its slots can be read */
+					hotChildPtr = slotObject->readReferenceFromSlot();
+					env->_scavengerStats._depthFirstCopyCount += 1;
+				}
+				break;
+			}
+		}
+		objectPtr = hotChildPtr;
+		depth += 1;
+	}
+}
+
 /****************************************
  * Scan completion routines
  ****************************************
@@ -1958,6 +2040,7 @@ MM_Scavenger::completeScan(MM_EnvironmentStandard *env)
 			completeScanCache(env);
 			break;
 		case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL:
+		case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DEPTH_FIRST:
 			incrementalScanCacheBySlot(env);
 			break;
 		default:
@@ -1994,10 +2077,21 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 	 * So scavenge Remembered Set right away
 	 */
 	MM_ScavengerRootScanner rootScanner(env, this);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	bool recordPauses = env->isMasterThread();
 
+	uint64_t phaseStartTime = omrtime_hires_clock();
 	rootScanner.scavengeRememberedSet(env);
+	uint64_t phaseEndTime = omrtime_hires_clock();
+	if (recordPauses) {
+		_extensions->pauseTimeStats.recordPause(env, OMR_GC_PAUSE_TYPE_REMEMBERED_SET_SCAN, phaseStartTime, phaseEndTime);
+	}
 
+	phaseStartTime = phaseEndTime;
 	rootScanner.scanRoots(env);
+	if (recordPauses) {
+		_extensions->pauseTimeStats.recordPause(env, OMR_GC_PAUSE_TYPE_ROOT_SCAN, phaseStartTime, omrtime_hires_clock());
+	}
 
 	if(completeScan(env)) {
 #if !defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -2077,6 +2171,12 @@ MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectp
 	Assert_MM_true(!isObjectInNewSpace(objectPtr));
 	Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
 
+	if (NULL != _extensions->rememberedSetCardTable) {
+		/* The card table can not overflow */
+		_extensions->rememberedSetCardTable->rememberObject(env, objectPtr);
+		return ;
+	}
+
 	if(env->_scavengerRememberedSet.fragmentCurrent >= env->_scavengerRememberedSet.fragmentTop) {
 		/* There wasn't enough room in the current fragment - allocate a new one */
 		if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
@@ -2274,7 +2374,9 @@ MM_Scavenger::flushRememberedSet(MM_EnvironmentStandard *env)
 void
 MM_Scavenger::pruneRememberedSet(MM_EnvironmentStandard *env)
 {
-	if(isRememberedSetInOverflowState()) {
+	if (NULL != _extensions->rememberedSetCardTable) {
+		pruneRememberedSetCards(env);
+	} else if(isRememberedSetInOverflowState()) {
 		pruneRememberedSetOverflow(env);
 	} else {
 		pruneRememberedSetList(env);
@@ -2421,6 +2523,69 @@ MM_Scavenger::pruneRememberedSetList(MM_EnvironmentStandard *env)
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
 }
 
+void
+MM_Scavenger::pruneRememberedSetCards(MM_EnvironmentStandard *env)
+{
+	MM_CardCleanerForScavenge cardCleaner(this, MM_CardCleanerForScavenge::prune);
+	_extensions->rememberedSetCardTable->cleanCardTable(env, &cardCleaner);
+}
+
+void
+MM_Scavenger::pruneRememberedSetCard(MM_EnvironmentStandard *env, void *lowAddress, void *highAddress, Card *card)
+{
+	MM_RememberedSetCardTable *cardTable = _extensions->rememberedSetCardTable;
+
+	/* Clean the card before pruning its objects, so that an object remembered meanwhile is either seen by the
+	 * check below or dirties the card again itself
+	 */
+	*card = (Card)CARD_CLEAN;
+	MM_AtomicOperations::sync();
+
+	MM_HeapMapIterator rememberedObjectIterator(_extensions, cardTable->getRememberedObjectMap(), (uintptr_t *)lowAddress, (uintptr_t *)highAddress, false);
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = rememberedObjectIterator.nextObject())) {
+		bool shouldBeRemembered = shouldRememberObject(env, objectPtr);
+#if !defined(OMR_GC_CONCURRENT_SCAVENGER)
+		if (processRememberedThreadReference(env, objectPtr)) {
+			/* the object was tenured from the stack on a previous scavenge -- keep it around for a bit longer */
+			Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+			shouldBeRemembered = true;
+		}
+#endif /* !OMR_GC_CONCURRENT_SCAVENGER */
+
+		if (!shouldBeRemembered) {
+			cardTable->forgetObject(objectPtr);
+			_extensions->objectModel.clearRemembered(objectPtr);
+
+			/* Inform interested parties that an object has been removed from the remembered set */
+			TRIGGER_J9HOOK_MM_PRIVATE_OBJECT_REMOVED_FROM_REMEMBERED_SET(_extensions->privateHookInterface, env->getOmrVMThread(), objectPtr);
+		}
+	}
+
+	if (cardTable->hasRememberedObjects(env, lowAddress, highAddress)) {
+		cardTable->dirtyCardRange(env, lowAddress, highAddress);
+	}
+}
+
+void
+MM_Scavenger::scavengeRememberedSetCards(MM_EnvironmentStandard *env)
+{
+	MM_CardCleanerForScavenge cardCleaner(this, MM_CardCleanerForScavenge::scavenge);
+	_extensions->rememberedSetCardTable->cleanCardTable(env, &cardCleaner);
+}
+
+void
+MM_Scavenger::scavengeRememberedSetCard(MM_EnvironmentStandard *env, void *lowAddress, void *highAddress)
+{
+	/* Cards are left dirty, whether their objects still need remembering is only decided once the scavenge has succeeded */
+	MM_HeapMapIterator rememberedObjectIterator(_extensions, _extensions->rememberedSetCardTable->getRememberedObjectMap(), (uintptr_t *)lowAddress, (uintptr_t *)highAddress, false);
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = rememberedObjectIterator.nextObject())) {
+		Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+		scavengeRememberedObject(env, objectPtr);
+	}
+}
+
 void
 MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 {
@@ -2473,7 +2638,9 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 void
 MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 {
-	if (_isRememberedSetInOverflowAtTheBeginning) {
+	if (NULL != _extensions->rememberedSetCardTable) {
+		scavengeRememberedSetCards(env);
+	} else if (_isRememberedSetInOverflowAtTheBeginning) {
 		env->_scavengerStats._rememberedSetOverflow = 1;
 		scavengeRememberedSetOverflow(env);
 	} else {
@@ -3142,6 +3309,26 @@ MM_Scavenger::backoutFixupAndReverseForwardPointersInSurvivor(MM_EnvironmentStan
 #endif /* defined (OMR_INTERP_COMPRESSED_OBJECT_HEADER) */
 }
 
+void
+MM_Scavenger::backOutRememberedSetCard(MM_EnvironmentStandard *env, void *lowAddress, void *highAddress)
+{
+	MM_RememberedSetCardTable *cardTable = _extensions->rememberedSetCardTable;
+	MM_HeapMapIterator rememberedObjectIterator(_extensions, cardTable->getRememberedObjectMap(), (uintptr_t *)lowAddress, (uintptr_t *)highAddress, false);
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = rememberedObjectIterator.nextObject())) {
+		if (MM_ForwardedHeader(objectPtr, OMR_OBJECT_METADATA_SLOT_OFFSET).isReverseForwardedPointer()) {
+			/* a tenured copy which has been backed out */
+#if defined(OMR_SCAVENGER_TRACE_BACKOUT)
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			omrtty_printf("{SCAV: Back out remove RS object %p[%p]}\n", objectPtr, *objectPtr);
+#endif /* OMR_SCAVENGER_TRACE_BACKOUT */
+			cardTable->forgetObject(objectPtr);
+		} else {
+			backOutObjectScan(env, objectPtr);
+		}
+	}
+}
+
 void
 MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 {
@@ -3253,39 +3440,49 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 			 */
 			backoutFixupAndReverseForwardPointersInSurvivor(env);
 
-			/* Walk the remembered set removing any tagged entries (back out of a tenured copy that is remembered)
-			 * and scanning remembered objects for reverse fwd info
-			 */
-			omrobjectptr_t *slotPtr;
-			omrobjectptr_t objectPtr;
-			MM_SublistPuddle *puddle;
+			if (NULL != _extensions->rememberedSetCardTable) {
+#if defined(OMR_SCAVENGER_TRACE_BACKOUT)
+				omrtty_printf("{SCAV: Back out RS cards}\n");
+#endif /* OMR_SCAVENGER_TRACE_BACKOUT */
+
+				/* Only the master thread is active here, so it visits every dirty card */
+				MM_CardCleanerForScavenge cardCleaner(this, MM_CardCleanerForScavenge::backOut);
+				_extensions->rememberedSetCardTable->cleanCardTable(env, &cardCleaner);
+			} else {
+				/* Walk the remembered set removing any tagged entries (back out of a tenured copy that is remembered)
+				 * and scanning remembered objects for reverse fwd info
+				 */
+				omrobjectptr_t *slotPtr;
+				omrobjectptr_t objectPtr;
+				MM_SublistPuddle *puddle;
 
 #if defined(OMR_SCAVENGER_TRACE_BACKOUT)
-			omrtty_printf("{SCAV: Back out RS list}\n");
+				omrtty_printf("{SCAV: Back out RS list}\n");
 #endif /* OMR_SCAVENGER_TRACE_BACKOUT */
 
-			GC_SublistIterator remSetIterator(&(_extensions->rememberedSet));
-			while((puddle = remSetIterator.nextList()) != NULL) {
-				GC_SublistSlotIterator remSetSlotIterator(puddle);
-				while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
-					/* clear any remove pending flags */
-					*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
-					objectPtr = *slotPtr;
+				GC_SublistIterator remSetIterator(&(_extensions->rememberedSet));
+				while((puddle = remSetIterator.nextList()) != NULL) {
+					GC_SublistSlotIterator remSetSlotIterator(puddle);
+					while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
+						/* clear any remove pending flags */
+						*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+						objectPtr = *slotPtr;
 
-					if(objectPtr) {
-						if (MM_ForwardedHeader(objectPtr, OMR_OBJECT_METADATA_SLOT_OFFSET).isReverseForwardedPointer()) {
+						if(objectPtr) {
+							if (MM_ForwardedHeader(objectPtr, OMR_OBJECT_METADATA_SLOT_OFFSET).isReverseForwardedPointer()) {
 #if defined(OMR_SCAVENGER_TRACE_BACKOUT)
-							omrtty_printf("{SCAV: Back out remove RS object %p[%p]}\n", objectPtr, *objectPtr);
+								omrtty_printf("{SCAV: Back out remove RS object %p[%p]}\n", objectPtr, *objectPtr);
 #endif /* OMR_SCAVENGER_TRACE_BACKOUT */
-							remSetSlotIterator.removeSlot();
-						} else {
+								remSetSlotIterator.removeSlot();
+							} else {
 #if defined(OMR_SCAVENGER_TRACE_BACKOUT)
-							omrtty_printf("{SCAV: Back out fixup RS object %p[%p]}\n", objectPtr, *objectPtr);
+								omrtty_printf("{SCAV: Back out fixup RS object %p[%p]}\n", objectPtr, *objectPtr);
 #endif /* OMR_SCAVENGER_TRACE_BACKOUT */
-							backOutObjectScan(env, objectPtr);
+								backOutObjectScan(env, objectPtr);
+							}
+						} else {
+							remSetSlotIterator.removeSlot();
 						}
-					} else {
-						remSetSlotIterator.removeSlot();
 					}
 				}
 			}
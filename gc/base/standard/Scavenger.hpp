@@ -25,7 +25,9 @@
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
 #include "omrcomp.h"
+#include "omrmodroncore.h"
 
+#include "AdaptiveThreadCount.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "Collector.hpp"
 #include "CopyScanCacheList.hpp"
@@ -67,6 +69,7 @@ private:
 	MM_GCExtensionsBase *_extensions;
 	
 	MM_Dispatcher *_dispatcher;
+	MM_AdaptiveThreadCount _adaptiveThreadCount; /**< thread count recommended for the scavenge task when adaptiveGCThreading is enabled */
 
 	volatile uintptr_t _doneIndex; /**< sequence ID of completeScan loop, which we may have a few during one GC cycle */
 
@@ -96,6 +99,7 @@ private:
 	MM_CopyScanCacheList _scavengeCacheScanList; /**< scan lists */
 	volatile uintptr_t _cachedEntryCount; /**< non-empty scanCacheList count (not the total count of caches in the lists) */
 	uintptr_t _cachesPerThread; /**< maximum number of copy and scan caches required per thread at any one time */
+	uintptr_t _depthFirstCopyLimit; /**< maximum number of hot descendants copied behind each copied object (0 unless scan ordering is depth first) */
 	omrthread_monitor_t _scanCacheMonitor; /**< monitor to synchronize threads on scan lists */
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
 	volatile uintptr_t _waitingCount; /**< count of threads waiting  on scan cache queues (blocked via _scanCacheMonitor); threads never wait on _freeCacheMonitor */
@@ -195,12 +199,23 @@ private:
 	MMINLINE bool scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *scanCache, omrobjectptr_t objectPtr, uintptr_t flags, omrobjectptr_t *rememberedSetSlot);
 	MMINLINE void incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, MM_CopyScanCacheStandard* scanCache, MM_CopyScanCacheStandard **nextScanCache);
 
+	/**
+	 * Copy the chain of first hot fields below a newly copied object, so that each descendant is copied
+	 * next to its parent.  The chain ends at the depth first copy limit, at a leaf or indexable object, or
+	 * at an object that has already been copied.  The copied objects are scanned later as usual.
+	 * @param env The environment.
+	 * @param objectPtr The object just copied by this thread.
+	 */
+	MMINLINE void depthFirstCopyHotDescendants(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
 	MMINLINE bool scavengeRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
 	void scavengeRememberedSetList(MM_EnvironmentStandard *env);
 	void scavengeRememberedSetOverflow(MM_EnvironmentStandard *env);
 	MMINLINE void flushRememberedSet(MM_EnvironmentStandard *env);
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
 	void pruneRememberedSetOverflow(MM_EnvironmentStandard *env);
+	void scavengeRememberedSetCards(MM_EnvironmentStandard *env);
+	void pruneRememberedSetCards(MM_EnvironmentStandard *env);
 	/**
 	 * Checks if the  Object should be remembered or not
 	 * @param env Standard Environment
@@ -591,6 +606,37 @@ public:
 	 */
 	void addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Scavenge the objects remembered on one dirty card of the remembered set card table.
+	 * Called by MM_CardCleanerForScavenge, the card is left dirty.
+	 *
+	 * @param env[in] the current thread
+	 * @param lowAddress[in] base of the heap range covered by the card
+	 * @param highAddress[in] top of the heap range covered by the card
+	 */
+	void scavengeRememberedSetCard(MM_EnvironmentStandard *env, void *lowAddress, void *highAddress);
+
+	/**
+	 * Forget the objects remembered on one dirty card of the remembered set card table which no longer
+	 * refer to new space, cleaning the card if none remain.  Called by MM_CardCleanerForScavenge.
+	 *
+	 * @param env[in] the current thread
+	 * @param lowAddress[in] base of the heap range covered by the card
+	 * @param highAddress[in] top of the heap range covered by the card
+	 * @param card[in] the card
+	 */
+	void pruneRememberedSetCard(MM_EnvironmentStandard *env, void *lowAddress, void *highAddress, Card *card);
+
+	/**
+	 * Back out the objects remembered on one dirty card of the remembered set card table, forgetting
+	 * tenured copies made by the failed scavenge.  Called by MM_CardCleanerForScavenge.
+	 *
+	 * @param env[in] the current thread
+	 * @param lowAddress[in] base of the heap range covered by the card
+	 * @param highAddress[in] top of the heap range covered by the card
+	 */
+	void backOutRememberedSetCard(MM_EnvironmentStandard *env, void *lowAddress, void *highAddress);
+
 	/**
 	 * Provide public (out-of-line) access to private (inline) copyAndForward(), copy() for client language
 	 * runtime. Slot holding reference will be updated with new address for referent on return.
@@ -651,6 +697,7 @@ public:
 		, _isRememberedSetInOverflowAtTheBeginning(false)
 		, _extensions(env->getExtensions())
 		, _dispatcher(_extensions->dispatcher)
+		, _adaptiveThreadCount(_extensions->adaptiveGCThreadingBytesPerThread)
 		, _doneIndex(0)
 		, _activeSubSpace(NULL)
 		, _evacuateMemorySubSpace(NULL)
@@ -671,6 +718,7 @@ public:
 		, _collectionStatistics()
 		, _cachedEntryCount(0)
 		, _cachesPerThread(0)
+		, _depthFirstCopyLimit(0)
 		, _scanCacheMonitor(NULL)
 		, _freeCacheMonitor(NULL)
 		, _waitingCount(0)
@@ -94,6 +94,11 @@ MM_SweepHeapSectioningSegmented::calculateActualChunkNumbers() const
 
 			totalChunkCount += MM_Math::roundToCeiling(_extensions->parSweepChunkSize, region->getSize()) / _extensions->parSweepChunkSize;
 
+			/* Add extra chunks for the NUMA stripe boundaries within the region (see reassignChunks()) */
+			if (_extensions->numaAwareGCWork && (0 == region->getNumaNode())) {
+				totalChunkCount += MM_Math::roundToCeiling(NUMA_GC_WORK_STRIPE_SIZE, region->getSize()) / NUMA_GC_WORK_STRIPE_SIZE;
+			}
+
 			/* Add extra chunks if more than one memory pool */
 			totalChunkCount += (poolCount - 1);
 		}
@@ -122,7 +127,8 @@ MM_SweepHeapSectioningSegmented::reassignChunks(MM_EnvironmentBase *env)
 	totalChunkCount = 0;
 	previousChunk = NULL;
 
-	MM_HeapRegionManager *regionManager = _extensions->getHeap()->getHeapRegionManager();
+	MM_Heap *heap = _extensions->getHeap();
+	MM_HeapRegionManager *regionManager = heap->getHeapRegionManager();
 	GC_HeapRegionIterator regionIterator(regionManager);
 	MM_HeapRegionDescriptor *region = NULL;
 
@@ -131,6 +137,8 @@ MM_SweepHeapSectioningSegmented::reassignChunks(MM_EnvironmentBase *env)
 			/* TODO:  this must be rethought for Tarok since it treats all regions identically but some might require different sweep logic */
 			uintptr_t *heapChunkBase = (uintptr_t *)region->getLowAddress();  /* Heap chunk base pointer */
 			uintptr_t *regionHighAddress = (uintptr_t *)region->getHighAddress();
+			/* Unless the region is bound to a node of its own, NUMA aware GC work finds the node backing a chunk from the heap stripe holding it */
+			bool splitAtNumaStripes = _extensions->numaAwareGCWork && (0 == region->getNumaNode());
 
 			while (heapChunkBase < regionHighAddress) {
 				void *poolHighAddr;
@@ -152,6 +160,15 @@ MM_SweepHeapSectioningSegmented::reassignChunks(MM_EnvironmentBase *env)
 					heapChunkTop = (uintptr_t *)((uintptr_t)heapChunkBase + _extensions->parSweepChunkSize);
 				}
 
+				uintptr_t numaNode = region->getNumaNode();
+				if (splitAtNumaStripes) {
+					/* end the chunk at the stripe boundary so that a single node backs all of it */
+					uintptr_t heapOffset = heap->calculateOffsetFromHeapBase(heapChunkBase);
+					uintptr_t *stripeTop = (uintptr_t *)((uintptr_t)heapChunkBase - (heapOffset % NUMA_GC_WORK_STRIPE_SIZE) + NUMA_GC_WORK_STRIPE_SIZE);
+					heapChunkTop = (heapChunkTop > stripeTop ? stripeTop : heapChunkTop);
+					numaNode = _extensions->_numaManager.getAffinityLeaderForHeapOffset(heapOffset);
+				}
+
 				/* Find out if the range of memory we are considering spans 2 different pools.  If it does,
 				 * the current chunk can only be attributed to one, so we limit the upper range of the chunk
 				 * to the first pool and will continue the assignment at the upper address range.
@@ -169,6 +186,7 @@ MM_SweepHeapSectioningSegmented::reassignChunks(MM_EnvironmentBase *env)
 				chunk->chunkBase = (void *)heapChunkBase;
 				chunk->chunkTop = (void *)heapChunkTop;
 				chunk->memoryPool = pool;
+				chunk->_numaNode = numaNode;
 				chunk->_coalesceCandidate = (heapChunkBase != region->getLowAddress());
 				chunk->_previous= previousChunk;
 				if(NULL != previousChunk) {
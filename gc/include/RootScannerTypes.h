@@ -57,6 +57,7 @@ typedef enum RootScannerEntity {
 	RootScannerEntity_MonitorLookupCaches,
 	RootScannerEntity_MonitorLookupCachesComplete,
 	RootScannerEntity_MonitorReferenceObjectsComplete,
+	RootScannerEntity_GlobalReferences,
 
 	/* Must be last, do not use this entity! */
 	RootScannerEntity_Count
@@ -46,6 +46,21 @@ omrobjectptr_t OMR_GC_AllocateNoGC(OMR_VMThread * omrVMThread, uintptr_t allocat
 
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
+/* Pause times of one OMR_GC_PAUSE_TYPE_* recorded since the heap was initialized, in microseconds. Percentiles are
+ * rounded up by less than 1/16 of their value.
+ */
+typedef struct OMR_GC_PauseTimeStats {
+	uint64_t count;
+	uint64_t totalMicros;
+	uint64_t p50Micros;
+	uint64_t p90Micros;
+	uint64_t p99Micros;
+	uint64_t p999Micros;
+	uint64_t maximumMicros;
+} OMR_GC_PauseTimeStats;
+
+omr_error_t OMR_GC_GetPauseTimeStats(OMR_VMThread* omrVMThread, uintptr_t pauseType, OMR_GC_PauseTimeStats *stats);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -77,3 +77,22 @@ OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode)
 	}
 	return result;
 }
+
+omr_error_t
+OMR_GC_GetPauseTimeStats(OMR_VMThread* omrVMThread, uintptr_t pauseType, OMR_GC_PauseTimeStats *stats)
+{
+	if ((OMR_GC_PAUSE_TYPE_COUNT <= pauseType) || (NULL == stats)) {
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_PauseTimeHistogram *histogram = env->getExtensions()->pauseTimeStats.getHistogram(pauseType);
+	stats->count = histogram->getCount();
+	stats->totalMicros = histogram->getTotal();
+	stats->p50Micros = histogram->getPercentile(50.0);
+	stats->p90Micros = histogram->getPercentile(90.0);
+	stats->p99Micros = histogram->getPercentile(99.0);
+	stats->p999Micros = histogram->getPercentile(99.9);
+	stats->maximumMicros = histogram->getMaximum();
+	return OMR_ERROR_NONE;
+}
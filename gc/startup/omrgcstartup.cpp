@@ -307,6 +307,10 @@ OMR_GC_ShutdownCollector(OMR_VMThread* omrVMThread)
 		globalCollector->collectorShutdown(extensions);
 	}
 
+	if (extensions->dumpPauseTimeStats) {
+		extensions->pauseTimeStats.report(env);
+	}
+
 	if ((NULL != extensions) && (NULL != extensions->heap)) {
 		MM_MemorySpace *defaultSpace = extensions->heap->getDefaultMemorySpace();
 		if (NULL != defaultSpace) {
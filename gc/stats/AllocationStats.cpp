@@ -30,6 +30,10 @@ MM_AllocationStats::clear()
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhStashRefreshCount = 0;
+	_tlhLockedRefreshCount = 0;
+	_tlhLockContendedCount = 0;
+	_tlhLockedRefreshTime = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
@@ -63,6 +67,10 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 		MM_AtomicOperations::lockCompareExchange(
 			&_tlhMaxAbandonedListSize, prevMax, stats->_tlhMaxAbandonedListSize);
 	}
+	MM_AtomicOperations::add(&_tlhStashRefreshCount, stats->_tlhStashRefreshCount);
+	MM_AtomicOperations::add(&_tlhLockedRefreshCount, stats->_tlhLockedRefreshCount);
+	MM_AtomicOperations::add(&_tlhLockContendedCount, stats->_tlhLockContendedCount);
+	MM_AtomicOperations::addU64(&_tlhLockedRefreshTime, stats->_tlhLockedRefreshTime);
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
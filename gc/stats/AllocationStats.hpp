@@ -37,6 +37,10 @@ public:
 	uintptr_t _tlhRequestedBytes; /**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; /**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhStashRefreshCount; /**< Number of fresh TLHs taken from a per-CPU refill stash without locking the memory pool. */
+	uintptr_t _tlhLockedRefreshCount; /**< Number of fresh TLH refreshes which locked the memory pool (stash empty or disabled). */
+	uintptr_t _tlhLockContendedCount; /**< Number of locked TLH refreshes which found the memory pool lock held by another thread. */
+	uint64_t _tlhLockedRefreshTime; /**< Hi-res ticks spent in locked TLH refreshes, including waiting for the lock. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
@@ -84,6 +88,10 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhStashRefreshCount(0),
+		_tlhLockedRefreshCount(0),
+		_tlhLockContendedCount(0),
+		_tlhLockedRefreshTime(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 #if defined(OMR_GC_ARRAYLETS)
 		_arrayletLeafAllocationCount(0),
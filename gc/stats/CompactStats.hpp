@@ -46,14 +46,20 @@ public:
 	uintptr_t _movedObjects;
 	uintptr_t _movedBytes;
 	uintptr_t _fixupObjects;
+	bool _slidingCompaction; /**< true if the objects were slid in address order within their regions rather than evacuated by sub area */
+	uintptr_t _partialCompactAreas; /**< number of areas evacuated by a partial compaction, 0 for a compaction of the whole heap */
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
+	uint64_t _summaryStartTime; /**< start of the live byte summary and forwarding computation of a sliding compaction */
+	uint64_t _summaryEndTime; /**< end of the live byte summary and forwarding computation of a sliding compaction */
 	uint64_t _moveStartTime;
 	uint64_t _moveEndTime;
 	uint64_t _fixupStartTime;
 	uint64_t _fixupEndTime;
 	uint64_t _rootFixupStartTime;
 	uint64_t _rootFixupEndTime;
+	uint64_t _rebuildStartTime; /**< start of the free list and mark map rebuild */
+	uint64_t _rebuildEndTime; /**< end of the free list and mark map rebuild */
 		
 	/* Remember gc count on last compaction of heap */
 	uintptr_t _lastHeapCompaction;
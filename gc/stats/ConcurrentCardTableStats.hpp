@@ -45,6 +45,11 @@ public:
 	volatile uintptr_t finalCleanedCardsPhase2;
 	
 	volatile uintptr_t concurrentCleanedCardsPhase3;
+
+	volatile uintptr_t concurrentScannedCards; /**< cards read while searching for dirty cards during concurrent card cleaning */
+	volatile uintptr_t concurrentSkippedCards; /**< cards in clean card blocks which concurrent card cleaning did not read */
+	volatile uintptr_t finalScannedCards; /**< cards read while searching for dirty cards during final card cleaning */
+	volatile uintptr_t finalSkippedCards; /**< cards in clean card blocks which final card cleaning did not read */
 	
 	MMINLINE void setCount(volatile uintptr_t &counter, uintptr_t count) 
 	{ 
@@ -71,6 +76,12 @@ public:
 		/* Final card cleaning counts */
 		setCount(finalCleanedCardsPhase1, 0);
 		setCount(finalCleanedCardsPhase2, 0);
+
+		/* Card scanning counts */
+		setCount(concurrentScannedCards, 0);
+		setCount(concurrentSkippedCards, 0);
+		setCount(finalScannedCards, 0);
+		setCount(finalSkippedCards, 0);
 	}
 	
 	MMINLINE void setCardCleaningPhase1Kickoff(uintptr_t kickoff) { _cardCleaningPhase1Kickoff = kickoff; };
@@ -115,6 +126,30 @@ public:
 		incrementCount(finalCleanedCardsPhase2, numCards);	
 	};
 	
+	MMINLINE uintptr_t getConcurrentScannedCards() { return concurrentScannedCards; };
+	MMINLINE void incConcurrentScannedCards(uintptr_t numCards)
+	{
+		incrementCount(concurrentScannedCards, numCards);
+	};
+
+	MMINLINE uintptr_t getConcurrentSkippedCards() { return concurrentSkippedCards; };
+	MMINLINE void incConcurrentSkippedCards(uintptr_t numCards)
+	{
+		incrementCount(concurrentSkippedCards, numCards);
+	};
+
+	MMINLINE uintptr_t getFinalScannedCards() { return finalScannedCards; };
+	MMINLINE void incFinalScannedCards(uintptr_t numCards)
+	{
+		incrementCount(finalScannedCards, numCards);
+	};
+
+	MMINLINE uintptr_t getFinalSkippedCards() { return finalSkippedCards; };
+	MMINLINE void incFinalSkippedCards(uintptr_t numCards)
+	{
+		incrementCount(finalSkippedCards, numCards);
+	};
+
 	/**
 	 * Create a CardTableStats object.
 	 */   
@@ -125,7 +160,11 @@ public:
 		finalCleanedCardsPhase1(0),
 		concurrentCleanedCardsPhase2(0),
 		finalCleanedCardsPhase2(0),
-		concurrentCleanedCardsPhase3(0)
+		concurrentCleanedCardsPhase3(0),
+		concurrentScannedCards(0),
+		concurrentSkippedCards(0),
+		finalScannedCards(0),
+		finalSkippedCards(0)
 	{};
 };
 
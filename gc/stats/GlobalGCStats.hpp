@@ -28,6 +28,7 @@
 #endif /* OMR_GC_MODRON_COMPACTION */
 #include "MarkStats.hpp"
 #include "MetronomeStats.hpp"
+#include "RootScannerStats.hpp"
 #include "SweepStats.hpp"
 #include "WorkPacketStats.hpp"
 
@@ -50,6 +51,7 @@ public:
 	MM_MarkStats markStats;
 	MM_ClassUnloadStats classUnloadStats;
 	MM_MetronomeStats metronomeStats; /**< Stats collected during one GC increment (quantum) */
+	MM_RootScannerStats rootScannerStats; /**< Time spent scanning each root scanner entity, merged from all marking threads */
 
 	uintptr_t finalizableCount; /**< count of objects pushed for finalization during one GC cycle */
 
@@ -69,6 +71,7 @@ public:
 		markStats.clear();
 		classUnloadStats.clear();
 		metronomeStats.clearStart();
+		rootScannerStats.clear();
 
 		finalizableCount = 0;
 	};
@@ -85,6 +88,7 @@ public:
 		, markStats()
 		, classUnloadStats()
 		, metronomeStats()
+		, rootScannerStats()
 		, finalizableCount(0) {};
 };
 
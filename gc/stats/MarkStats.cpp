@@ -31,6 +31,8 @@ MM_MarkStats::clear()
 	_objectsMarked = 0;
 	_objectsScanned = 0;
 	_bytesScanned = 0;
+	_markMapBytesClearedConcurrently = 0;
+	_markMapBytesClearedInPause = 0;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_syncStallCount = 0;
@@ -46,6 +48,8 @@ MM_MarkStats::merge(MM_MarkStats *statsToMerge)
 	_objectsMarked += statsToMerge->_objectsMarked;
 	_objectsScanned += statsToMerge->_objectsScanned;
 	_bytesScanned += statsToMerge->_bytesScanned;
+	_markMapBytesClearedConcurrently += statsToMerge->_markMapBytesClearedConcurrently;
+	_markMapBytesClearedInPause += statsToMerge->_markMapBytesClearedInPause;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
@@ -44,6 +44,8 @@ public:
 	uintptr_t _objectsMarked;  /**< The number of objects found through scanning during marking */
 	uintptr_t _objectsScanned;  /**< The number of objects popped and scanned during marking (e.g., non-base type arrays) */
 	uintptr_t _bytesScanned; /**< The number of bytes scanned by the owning thread (or globally) during marking */
+	uintptr_t _markMapBytesClearedConcurrently; /**< The number of mark map bytes cleared by the background clearer before the collection (global only) */
+	uintptr_t _markMapBytesClearedInPause; /**< The number of mark map bytes the owning thread (or all threads) cleared after the background clearer was paused */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t _syncStallCount; /**< The number of times the thread stalled at a sync point */
@@ -104,6 +106,8 @@ public:
 		,_objectsMarked(0)
 		,_objectsScanned(0)
 		,_bytesScanned(0)
+		,_markMapBytesClearedConcurrently(0)
+		,_markMapBytesClearedInPause(0)
 		,_startTime(0)
 		,_endTime(0)
 	{
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "PauseTimeHistogram.hpp"
+
+void
+MM_PauseTimeHistogram::clear()
+{
+	memset(_buckets, 0, sizeof(_buckets));
+	_count = 0;
+	_total = 0;
+	_maximum = 0;
+}
+
+uintptr_t
+MM_PauseTimeHistogram::getBucketIndex(uint64_t pauseTime)
+{
+	/* The first 2 * SUB_BUCKETS buckets hold one value each, after which each power of two is split into SUB_BUCKETS */
+	uintptr_t shift = 0;
+	while ((pauseTime >> shift) >= (2 * SUB_BUCKETS)) {
+		shift += 1;
+	}
+	if (shift > MAXIMUM_SHIFT) {
+		return BUCKET_COUNT - 1;
+	}
+	return (shift * SUB_BUCKETS) + (uintptr_t)(pauseTime >> shift);
+}
+
+uint64_t
+MM_PauseTimeHistogram::getBucketLimit(uintptr_t index)
+{
+	if (index < (2 * SUB_BUCKETS)) {
+		return index;
+	}
+	uintptr_t shift = (index / SUB_BUCKETS) - 1;
+	uint64_t mantissa = index - (shift * SUB_BUCKETS);
+	return ((mantissa + 1) << shift) - 1;
+}
+
+void
+MM_PauseTimeHistogram::addPause(uint64_t pauseTime)
+{
+	_buckets[getBucketIndex(pauseTime)] += 1;
+	_count += 1;
+	_total += pauseTime;
+	_maximum = OMR_MAX(_maximum, pauseTime);
+}
+
+uint64_t
+MM_PauseTimeHistogram::getPercentile(double percentile) const
+{
+	uint64_t count = _count;
+	if (0 == count) {
+		return 0;
+	}
+
+	/* The rank of the pause at the percentile, rounded up */
+	double exactRank = (percentile * (double)count) / 100.0;
+	uint64_t rank = (uint64_t)exactRank;
+	if ((double)rank < exactRank) {
+		rank += 1;
+	}
+	rank = OMR_MAX(rank, (uint64_t)1);
+
+	uint64_t seen = 0;
+	for (uintptr_t i = 0; i < BUCKET_COUNT; i++) {
+		seen += _buckets[i];
+		if (seen >= rank) {
+			return OMR_MIN(getBucketLimit(i), _maximum);
+		}
+	}
+	return _maximum;
+}
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(PAUSETIMEHISTOGRAM_HPP_)
+#define PAUSETIMEHISTOGRAM_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+
+/**
+ * Distribution of pause times, in microseconds.  Times are counted in a fixed number of logarithmic buckets,
+ * SUB_BUCKETS per power of two, so recording a pause takes constant time and space however many are recorded, and
+ * a percentile is exact below 2 * SUB_BUCKETS microseconds and otherwise rounded up by less than 1/SUB_BUCKETS.
+ * @note Pauses are recorded by the master GC thread only.  Readers may see a histogram which is being updated.
+ * @ingroup GC_Stats
+ */
+class MM_PauseTimeHistogram : public MM_Base
+{
+public:
+	enum {
+		SUB_BUCKETS = 16, /**< buckets per power of two */
+		MAXIMUM_SHIFT = 36, /**< pauses of (2 * SUB_BUCKETS) << MAXIMUM_SHIFT microseconds (about 25 days) or more share the last bucket */
+		BUCKET_COUNT = SUB_BUCKETS * (MAXIMUM_SHIFT + 2)
+	};
+
+private:
+	uint64_t _buckets[BUCKET_COUNT];
+	uint64_t _count; /**< pauses recorded */
+	uint64_t _total; /**< sum of the pauses recorded, in microseconds */
+	uint64_t _maximum; /**< longest pause recorded, in microseconds */
+
+public:
+	void clear();
+
+	/**
+	 * Record a pause.
+	 * @param[in] pauseTime the pause, in microseconds
+	 */
+	void addPause(uint64_t pauseTime);
+
+	/**
+	 * @param[in] percentile between 0 and 100
+	 * @return the time, in microseconds, which percentile percent of the pauses recorded did not exceed (0 if none)
+	 */
+	uint64_t getPercentile(double percentile) const;
+
+	MMINLINE uint64_t getCount() const { return _count; }
+	MMINLINE uint64_t getTotal() const { return _total; }
+	MMINLINE uint64_t getMaximum() const { return _maximum; }
+
+	MM_PauseTimeHistogram()
+		: MM_Base()
+	{
+		clear();
+	}
+
+private:
+	static uintptr_t getBucketIndex(uint64_t pauseTime);
+	static uint64_t getBucketLimit(uintptr_t index);
+};
+
+#endif /* PAUSETIMEHISTOGRAM_HPP_ */
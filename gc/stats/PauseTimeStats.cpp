@@ -0,0 +1,90 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+
+#include "EnvironmentBase.hpp"
+
+#include "PauseTimeStats.hpp"
+
+const char *
+MM_PauseTimeStats::getPauseTypeName(uintptr_t pauseType)
+{
+	switch (pauseType) {
+	case OMR_GC_PAUSE_TYPE_SCAVENGE:
+		return "scavenge";
+	case OMR_GC_PAUSE_TYPE_GLOBAL:
+		return "global";
+	case OMR_GC_PAUSE_TYPE_CONCURRENT_FINAL:
+		return "concurrent final";
+	case OMR_GC_PAUSE_TYPE_ROOT_SCAN:
+		return "root scan";
+	case OMR_GC_PAUSE_TYPE_MARK:
+		return "mark";
+	case OMR_GC_PAUSE_TYPE_SWEEP:
+		return "sweep";
+	case OMR_GC_PAUSE_TYPE_COMPACT:
+		return "compact";
+	case OMR_GC_PAUSE_TYPE_REMEMBERED_SET_SCAN:
+		return "rs scan";
+	default:
+		return "unknown";
+	}
+}
+
+void
+MM_PauseTimeStats::recordPause(MM_EnvironmentBase *env, uintptr_t pauseType, uint64_t startTime, uint64_t endTime)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	/* (protect from malicious clock jitters) */
+	uint64_t pauseTime = 0;
+	if (endTime > startTime) {
+		pauseTime = omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	}
+	_histograms[pauseType].addPause(pauseTime);
+}
+
+void
+MM_PauseTimeStats::report(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	omrtty_printf("GC pause times (microseconds)\n");
+	omrtty_printf("%-16s %10s %10s %10s %10s %10s %10s\n", "pause", "count", "p50", "p90", "p99", "p99.9", "max");
+	for (uintptr_t i = 0; i < OMR_GC_PAUSE_TYPE_COUNT; i++) {
+		MM_PauseTimeHistogram *histogram = &_histograms[i];
+		if (0 != histogram->getCount()) {
+			omrtty_printf("%-16s %10llu %10llu %10llu %10llu %10llu %10llu\n",
+				getPauseTypeName(i),
+				histogram->getCount(),
+				histogram->getPercentile(50.0),
+				histogram->getPercentile(90.0),
+				histogram->getPercentile(99.0),
+				histogram->getPercentile(99.9),
+				histogram->getMaximum());
+		}
+	}
+}
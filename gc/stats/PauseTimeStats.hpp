@@ -0,0 +1,83 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(PAUSETIMESTATS_HPP_)
+#define PAUSETIMESTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "omrgcconsts.h"
+
+#include "Base.hpp"
+#include "PauseTimeHistogram.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Always-on histograms of the pause times of each type of collection (scavenge, global, concurrent final phase)
+ * and of each of their phases (root scan, mark, sweep, compact, remembered set scan), indexed by
+ * OMR_GC_PAUSE_TYPE_*.  They are kept for the life of the heap, and can be queried with OMR_GC_GetPauseTimeStats()
+ * or printed on shutdown (-Xgc:dumpPauseTimeStats).
+ * @note This class is intended to have a single global instance
+ * @ingroup GC_Stats
+ */
+class MM_PauseTimeStats : public MM_Base
+{
+private:
+	MM_PauseTimeHistogram _histograms[OMR_GC_PAUSE_TYPE_COUNT];
+
+public:
+	/**
+	 * Record a pause.  Called by the master GC thread.
+	 * @param[in] pauseType OMR_GC_PAUSE_TYPE_* of the pause
+	 * @param[in] startTime hires clock at the start of the pause
+	 * @param[in] endTime hires clock at the end of the pause
+	 */
+	void recordPause(MM_EnvironmentBase *env, uintptr_t pauseType, uint64_t startTime, uint64_t endTime);
+
+	/**
+	 * Print the count, percentiles and maximum of each type of pause recorded.
+	 */
+	void report(MM_EnvironmentBase *env);
+
+	MMINLINE MM_PauseTimeHistogram *getHistogram(uintptr_t pauseType) { return &_histograms[pauseType]; }
+
+	/**
+	 * @return the number of collection pauses (scavenge, global and concurrent final) recorded
+	 */
+	MMINLINE uint64_t getCollectionCount()
+	{
+		return _histograms[OMR_GC_PAUSE_TYPE_SCAVENGE].getCount()
+			+ _histograms[OMR_GC_PAUSE_TYPE_GLOBAL].getCount()
+			+ _histograms[OMR_GC_PAUSE_TYPE_CONCURRENT_FINAL].getCount();
+	}
+
+	static const char *getPauseTypeName(uintptr_t pauseType);
+
+	MM_PauseTimeStats()
+		: MM_Base()
+	{}
+};
+
+#endif /* PAUSETIMESTATS_HPP_ */
@@ -31,6 +31,8 @@ MM_RootScannerStats::clear()
 {
 	for (uintptr_t i = 0; i < RootScannerEntity_Count; i++) {
 		_entityScanTime[i] = 0;
+		_entityScanTimeMax[i] = 0;
+		_entitySlicesScanned[i] = 0;
 	}
 }
 
@@ -39,5 +41,7 @@ MM_RootScannerStats::merge(MM_RootScannerStats *statsToMerge)
 {
 	for (uintptr_t i = 0; i < RootScannerEntity_Count; i++) {
 		_entityScanTime[i] += statsToMerge->_entityScanTime[i];
+		_entityScanTimeMax[i] = OMR_MAX(_entityScanTimeMax[i], statsToMerge->_entityScanTimeMax[i]);
+		_entitySlicesScanned[i] += statsToMerge->_entitySlicesScanned[i];
 	}
 }
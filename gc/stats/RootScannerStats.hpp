@@ -26,6 +26,7 @@
 
 #include "omrcfg.h"
 #include "omrcomp.h"
+#include "modronbase.h"
 
 #include "Base.hpp"
 #include "RootScannerTypes.h"
@@ -35,9 +36,31 @@ class MM_RootScannerStats : public MM_Base
 /* Data Members */
 public:
 	uint64_t _entityScanTime[RootScannerEntity_Count]; /**< Time spent scanning each root scanner entity per thread.  Values of 0 indicate no time (regardless of clock resolution) spent scanning. */
+	uint64_t _entityScanTimeMax[RootScannerEntity_Count]; /**< Longest time a single thread spent scanning each root scanner entity.  Compared with the average of _entityScanTime, shows which roots are scanned unevenly. */
+	uintptr_t _entitySlicesScanned[RootScannerEntity_Count]; /**< Number of root range slices of each root scanner entity scanned (see MM_RootRangeSet) */
 	
 /* Function Members */
 public:
+	/**
+	 * Record the time a thread spent scanning a root scanner entity.
+	 *
+	 * @param[in] entity		the root scanner entity scanned
+	 * @param[in] startTime		hires clock time the scan started
+	 * @param[in] endTime		hires clock time the scan ended
+	 * @param[in] slicesScanned	number of root range slices scanned
+	 */
+	MMINLINE void
+	addToEntityScanTime(RootScannerEntity entity, uint64_t startTime, uint64_t endTime, uintptr_t slicesScanned)
+	{
+		/* a scan shorter than the clock resolution is still recorded as having taken some time */
+		_entityScanTime[entity] += (endTime > startTime) ? (endTime - startTime) : 1;
+		_entitySlicesScanned[entity] += slicesScanned;
+		/* these are the stats of a single thread, so its total is also the longest time of any thread */
+		if (_entityScanTime[entity] > _entityScanTimeMax[entity]) {
+			_entityScanTimeMax[entity] = _entityScanTime[entity];
+		}
+	}
+
 	/**
 	 * Reset the root scanner statistics to their initial state.  Statistics should
 	 * be reset each for each local or global GC.
@@ -142,19 +142,36 @@ public:
 			/* did not have a parent or cannot calculate hotness here, can only assume it is hot */
 			clearHotnessOfField();
 		} else {
-			/* get the slot index into the hot bit vector */
-			fomrobject_t *startOfObjectAfterHeader = (fomrobject_t*)(_objectPtr + 1);
-			/* NOTE: pointer math means that slotIndex is calculated in terms of sizeof(fomrobject_t) */
-			uintptr_t slotIndex = (uintptr_t) (slotPtr - startOfObjectAfterHeader);
-	
-			/* x >> y is undefined if y >= #bits in word, but we know it should be zero! This feature of right shift caught me out! */
-			if (slotIndex >= sizeof(hotFieldsDescriptor)*8) {
-				hotFieldsDescriptor = 0;
-			} else {
-				hotFieldsDescriptor >>= slotIndex;
-			}
-			_hotness = (uint8_t)(hotFieldsDescriptor & 1);
+			_hotness = getHotnessOfField(_objectPtr, slotPtr, hotFieldsDescriptor);
+		}
+#endif /* J9VM_INTERP_NATIVE_SUPPORT */
+	}
+
+	/**
+	 * Determines the hotness of a reference slot of a scalar object from its instance hot fields descriptor.
+	 * Without language support for hot fields every field is assumed to be hot.
+	 * @param objectPtr pointer to the object containing the slot
+	 * @param slotPtr pointer to slot in object
+	 * @param hotFieldsDescriptor instance hot fields descriptor
+	 * @return Hot or Cold
+	 */
+	MMINLINE static uint8_t
+	getHotnessOfField(omrobjectptr_t objectPtr, fomrobject_t *slotPtr, uintptr_t hotFieldsDescriptor) {
+#if defined(J9VM_INTERP_NATIVE_SUPPORT)
+		/* get the slot index into the hot bit vector */
+		fomrobject_t *startOfObjectAfterHeader = (fomrobject_t*)(objectPtr + 1);
+		/* NOTE: pointer math means that slotIndex is calculated in terms of sizeof(fomrobject_t) */
+		uintptr_t slotIndex = (uintptr_t) (slotPtr - startOfObjectAfterHeader);
+
+		/* x >> y is undefined if y >= #bits in word, but we know it should be zero! This feature of right shift caught me out! */
+		if (slotIndex >= sizeof(hotFieldsDescriptor)*8) {
+			hotFieldsDescriptor = 0;
+		} else {
+			hotFieldsDescriptor >>= slotIndex;
 		}
+		return (uint8_t)(hotFieldsDescriptor & 1);
+#else /* J9VM_INTERP_NATIVE_SUPPORT */
+		return Hot;
 #endif /* J9VM_INTERP_NATIVE_SUPPORT */
 	}
 
@@ -40,6 +40,7 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_failedFlipCount(0)
 	,_failedFlipBytes(0)
 	,_tenureAge(0)
+	,_depthFirstCopyCount(0)
 	,_startTime(0)
 	,_endTime(0)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -83,7 +84,7 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
-
+	,_rootScannerStats()
 	,_flipHistoryNewIndex(0)
 {
 	memset(_flipHistory, 0, sizeof(_flipHistory));
@@ -135,6 +136,7 @@ MM_ScavengerStats::clear()
 	_failedFlipCount = 0;
 	_failedFlipBytes = 0;
 	_tenureAge = 0;
+	_depthFirstCopyCount = 0;
 	_nextScavengeWillPercolate = false;
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_releaseScanListCount = 0;
@@ -174,4 +176,6 @@ MM_ScavengerStats::clear()
 	_copy_cachesize_sum = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+
+	_rootScannerStats.clear();
 };
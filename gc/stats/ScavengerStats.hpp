@@ -29,6 +29,7 @@ class MM_EnvironmentBase;
 #include "objectdescription.h"
 
 #include "Math.hpp"
+#include "RootScannerStats.hpp"
 
 #define OMR_SCAVENGER_DISTANCE_BINS 32
 #define OMR_SCAVENGER_CACHESIZE_BINS 16
@@ -71,6 +72,7 @@ public:
 	uintptr_t _failedFlipCount;
 	uintptr_t _failedFlipBytes;
 	uintptr_t _tenureAge;
+	uintptr_t _depthFirstCopyCount; /**< number of objects copied depth first behind their parent (depth first scan ordering only) */
 	uint64_t _startTime;
 	uint64_t _endTime;
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -132,6 +134,8 @@ public:
 	uint64_t _slotsCopied; /**< The number of slots copied by the thread since _slotsScanned was last sampled and reset */
 	uint64_t _slotsScanned; /**< The number of slots scanned by the thread since _slotsCopied was last sampled and reset */
 
+	MM_RootScannerStats _rootScannerStats; /**< Time spent scanning each root scanner entity, merged from all threads */
+
 
 protected:
 
@@ -31,6 +31,9 @@
 void
 MM_SweepStats::clear()
 {
+	_sweepChunksLocal = 0;
+	_sweepChunksRemote = 0;
+
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	sweepHeapBytesTotal = 0;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
@@ -45,6 +48,9 @@ MM_SweepStats::clear()
 void
 MM_SweepStats::merge(MM_SweepStats *statsToMerge)
 {
+	_sweepChunksLocal += statsToMerge->_sweepChunksLocal;
+	_sweepChunksRemote += statsToMerge->_sweepChunksRemote;
+
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	sweepHeapBytesTotal += statsToMerge->sweepHeapBytesTotal;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
@@ -35,6 +35,8 @@ class MM_SweepStats : public MM_Base
 {
 public:
 	uintptr_t _gcCount; /**< The GC cycle in which these stats were collected */
+	uintptr_t _sweepChunksLocal; /**< Chunks swept by a thread bound to the NUMA node backing them (NUMA aware sweep only) */
+	uintptr_t _sweepChunksRemote; /**< Chunks swept by a thread bound to a different NUMA node than the one backing them (NUMA aware sweep only) */
 	
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	uintptr_t sweepHeapBytesTotal;  /**< Number of heap bytes processed during the sweep phase */
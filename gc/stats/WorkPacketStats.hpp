@@ -39,6 +39,8 @@ class MM_WorkPacketStats
 {
 public:
 	uintptr_t _gcCount;  /**< Count of the number of GC cycles that have occurred */
+	uintptr_t _stealAttempts; /**< The number of times the thread tried to steal a packet from another thread's deque (work stealing mode only) */
+	uintptr_t _packetsStolen; /**< The number of packets the thread successfully stole from another thread's deque (work stealing mode only) */
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t workPacketsAcquired;
 	uintptr_t workPacketsReleased;
@@ -61,6 +63,8 @@ public:
 		_stwWorkStackOverflowCount = 0;
 		_stwWorkStackOverflowOccured = false;
 		_stwWorkpacketCountAtOverflow = 0;
+		_stealAttempts = 0;
+		_packetsStolen = 0;
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		_workStallCount = 0;
 		_completeStallCount = 0;
@@ -77,6 +81,8 @@ public:
 		_stwWorkStackOverflowCount += statsToMerge->_stwWorkStackOverflowCount;
 		_stwWorkStackOverflowOccured = (_stwWorkStackOverflowOccured || statsToMerge->_stwWorkStackOverflowOccured);
 		_stwWorkpacketCountAtOverflow = OMR_MAX(_stwWorkpacketCountAtOverflow, statsToMerge->_stwWorkpacketCountAtOverflow);
+		_stealAttempts += statsToMerge->_stealAttempts;
+		_packetsStolen += statsToMerge->_packetsStolen;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		/* It may not ever be useful to merge these stats, but do it anyways */
@@ -140,6 +146,8 @@ public:
 
 	MM_WorkPacketStats() :
 		_gcCount(UDATA_MAX)
+		,_stealAttempts(0)
+		,_packetsStolen(0)
 		,workPacketsAcquired(0)
 		,workPacketsReleased(0)
 		,workPacketsExchanged(0)
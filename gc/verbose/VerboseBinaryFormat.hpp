@@ -0,0 +1,218 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+/*
+ * Layout of the binary verbose GC log, which MM_VerboseWriterFileLoggingAsynchronous writes with -Xgc:binaryLogging and
+ * the vgcconvert tool turns back into the XML described by schema.xsd.  The tool includes this header too, so it only
+ * depends on the C library.
+ *
+ * A file starts with the VERBOSEGC_BINARY_MAGIC bytes, VERBOSEGC_BINARY_VERSION as a uint32_t and the size of a pointer
+ * as a uint32_t, followed by records.  Each record is a VerboseBinaryRecord followed by length bytes of payload.
+ * Numbers are in the byte order of the machine which wrote the file.
+ *
+ * An event record holds the arguments of its format in the order of the conversions of the format: an 8 byte integer
+ * for an integer or pointer conversion (sign extended for %d and %i), an 8 byte double for a floating point conversion,
+ * and the NUL terminated string for a %s conversion.  Only the formatting of the event is deferred, the XML is the same
+ * as that written by the other writers.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#define VERBOSEGC_BINARY_MAGIC "OMRVGCB\n"
+#define VERBOSEGC_BINARY_MAGIC_LENGTH 8
+#define VERBOSEGC_BINARY_VERSION 1
+
+/* Format ids are below this, so a reader can reject the id of a corrupt record before making room for it */
+#define VERBOSEGC_BINARY_FORMAT_COUNT 1024
+
+/* Indentation of each indent level of a line */
+#define VERBOSEGC_INDENT_SPACER "  "
+
+/* What a NULL %s argument is printed as */
+#define VERBOSEGC_NULL_STRING "<NULL>"
+
+/* The longest conversion (e.g. "%03.3llu") which is recorded rather than formatted, including the '%' */
+#define VERBOSEGC_CONVERSION_MAX_LENGTH 15
+
+typedef enum {
+	VERBOSEGC_BINARY_TEXT = 0, /**< text to copy to the XML as is, such as the header and the footer */
+	VERBOSEGC_BINARY_FORMAT, /**< a uint32_t format id followed by the NUL terminated format, defining the id for the rest of the file */
+	VERBOSEGC_BINARY_EVENT /**< a uint32_t format id and a uint32_t indent level, followed by the arguments of the format */
+} VerboseBinaryRecordType;
+
+typedef struct VerboseBinaryRecord {
+	uint32_t type; /**< one of VerboseBinaryRecordType */
+	uint32_t length; /**< bytes of payload following the record */
+} VerboseBinaryRecord;
+
+/**
+ * The type of the argument taken by a conversion, which is the type it is passed to printf as.
+ */
+typedef enum {
+	VERBOSEGC_ARGUMENT_NONE = 0, /**< no argument, the end of the format or %% */
+	VERBOSEGC_ARGUMENT_INT, /**< an integer conversion without a length modifier, or with h or hh */
+	VERBOSEGC_ARGUMENT_LONG, /**< an integer conversion with l */
+	VERBOSEGC_ARGUMENT_LONG_LONG, /**< an integer conversion with ll or j */
+	VERBOSEGC_ARGUMENT_SIZE, /**< an integer conversion with z or t */
+	VERBOSEGC_ARGUMENT_POINTER, /**< %p */
+	VERBOSEGC_ARGUMENT_DOUBLE, /**< a floating point conversion */
+	VERBOSEGC_ARGUMENT_STRING, /**< %s */
+	VERBOSEGC_ARGUMENT_UNSUPPORTED /**< e.g. a '*' width or precision, or long double, which can not be recorded */
+} VerboseArgumentType;
+
+/**
+ * Find the next conversion in a format.
+ * @param[in] format the rest of the format, after the last conversion
+ * @param[out] start the '%' of the conversion, or the end of the format if there is none
+ * @param[out] length the characters of the conversion, from the '%' to the conversion character
+ * @return the type of the argument of the conversion
+ */
+inline VerboseArgumentType
+verboseNextConversion(const char *format, const char **start, uintptr_t *length)
+{
+	const char *cursor = strchr(format, '%');
+	if (NULL == cursor) {
+		*start = format + strlen(format);
+		*length = 0;
+		return VERBOSEGC_ARGUMENT_NONE;
+	}
+	*start = cursor;
+	cursor += 1;
+
+	/* flags, width and precision only change how the argument is printed */
+	while (('\0' != *cursor) && (NULL != strchr("-+ #0123456789.", *cursor))) {
+		cursor += 1;
+	}
+
+	VerboseArgumentType integerType = VERBOSEGC_ARGUMENT_INT;
+	bool modified = true;
+	switch (*cursor) {
+	case 'h':
+		cursor += ('h' == cursor[1]) ? 2 : 1;
+		break;
+	case 'l':
+		if ('l' == cursor[1]) {
+			integerType = VERBOSEGC_ARGUMENT_LONG_LONG;
+			cursor += 2;
+		} else {
+			integerType = VERBOSEGC_ARGUMENT_LONG;
+			cursor += 1;
+		}
+		break;
+	case 'j':
+		integerType = VERBOSEGC_ARGUMENT_LONG_LONG;
+		cursor += 1;
+		break;
+	case 'z':
+	case 't':
+		integerType = VERBOSEGC_ARGUMENT_SIZE;
+		cursor += 1;
+		break;
+	default:
+		modified = false;
+		break;
+	}
+
+	VerboseArgumentType type = VERBOSEGC_ARGUMENT_UNSUPPORTED;
+	switch (*cursor) {
+	case 'd':
+	case 'i':
+	case 'o':
+	case 'u':
+	case 'x':
+	case 'X':
+	case 'c':
+		type = integerType;
+		break;
+	case 'f':
+	case 'F':
+	case 'e':
+	case 'E':
+	case 'g':
+	case 'G':
+		type = VERBOSEGC_ARGUMENT_DOUBLE;
+		break;
+	case 'p':
+		type = modified ? VERBOSEGC_ARGUMENT_UNSUPPORTED : VERBOSEGC_ARGUMENT_POINTER;
+		break;
+	case 's':
+		type = modified ? VERBOSEGC_ARGUMENT_UNSUPPORTED : VERBOSEGC_ARGUMENT_STRING;
+		break;
+	case '%':
+		type = VERBOSEGC_ARGUMENT_NONE;
+		break;
+	default:
+		/* '*', L, n and anything unknown */
+		return VERBOSEGC_ARGUMENT_UNSUPPORTED;
+	}
+
+	*length = (cursor + 1) - *start;
+	if (VERBOSEGC_CONVERSION_MAX_LENGTH < *length) {
+		type = VERBOSEGC_ARGUMENT_UNSUPPORTED;
+	}
+	return type;
+}
+
+/**
+ * @return true if the integer conversion found by verboseNextConversion() is signed, so its argument is sign extended
+ */
+inline bool
+verboseIsSignedConversion(const char *start, uintptr_t length)
+{
+	char conversion = start[length - 1];
+	return ('d' == conversion) || ('i' == conversion);
+}
+
+/**
+ * Copy a conversion found by verboseNextConversion() to a NUL terminated string.  The length modifier of an integer
+ * conversion other than %c is replaced by ll, so that the conversion is printed from the 8 byte integer of the binary
+ * format as a long long.
+ * @param[out] spec the copy, at least VERBOSEGC_CONVERSION_MAX_LENGTH + 3 characters
+ */
+inline void
+verboseCopyConversion(char *spec, const char *start, uintptr_t length, VerboseArgumentType type)
+{
+	char conversion = start[length - 1];
+	uintptr_t specLength = 0;
+	for (uintptr_t i = 0; i < (length - 1); i++) {
+		if (NULL == strchr("hljzt", start[i])) {
+			spec[specLength++] = start[i];
+		}
+	}
+	switch (type) {
+	case VERBOSEGC_ARGUMENT_INT:
+	case VERBOSEGC_ARGUMENT_LONG:
+	case VERBOSEGC_ARGUMENT_LONG_LONG:
+	case VERBOSEGC_ARGUMENT_SIZE:
+		if ('c' != conversion) {
+			spec[specLength++] = 'l';
+			spec[specLength++] = 'l';
+		}
+		break;
+	default:
+		break;
+	}
+	spec[specLength++] = conversion;
+	spec[specLength] = '\0';
+}
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
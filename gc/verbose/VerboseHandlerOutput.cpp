@@ -724,6 +724,14 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		if (0 != _extensions->tlhRefillStashSize) {
+			uint64_t lockedTimeUs = omrtime_hires_delta(0, systemStats->_tlhLockedRefreshTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			writer->formatAndOutput(env, 1, "<tlh-refresh stash=\"%zu\" locked=\"%zu\" contended=\"%zu\" lockedtimems=\"%llu.%03.3llu\" />",
+					systemStats->_tlhStashRefreshCount, systemStats->_tlhLockedRefreshCount, systemStats->_tlhLockContendedCount,
+					lockedTimeUs / 1000, lockedTimeUs % 1000);
+		}
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
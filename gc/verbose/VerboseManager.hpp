@@ -112,6 +112,12 @@ public:
 	 */
 	virtual void closeStreams(MM_EnvironmentBase *env);
 
+	/**
+	 * Wait until the output so far has reached the output mechanisms on the receiver, e.g. to read a log file while it is being written.
+	 * @param env vm thread.
+	 */
+	virtual void flushStreams(MM_EnvironmentBase *env);
+
 	MMINLINE MM_VerboseWriterChain* getWriterChain() { return _writerChain; }
 	
 	virtual void handleFileOpenError(MM_EnvironmentBase *env, char *fileName) {}
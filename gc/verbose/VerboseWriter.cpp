@@ -64,6 +64,25 @@ MM_VerboseWriter::setNextWriter(MM_VerboseWriter* writer)
 	_nextWriter = writer;
 }
 
+void
+MM_VerboseWriter::flushStream(MM_EnvironmentBase *env)
+{
+	/* default implementation writes output as it is produced */
+}
+
+bool
+MM_VerboseWriter::recordsEvents()
+{
+	return false;
+}
+
+void
+MM_VerboseWriter::outputEvent(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	/* only writers which record events are given them */
+	Assert_VGC_true(false);
+}
+
 void
 MM_VerboseWriter::tearDown(MM_EnvironmentBase* env)
 {
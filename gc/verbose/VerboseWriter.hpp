@@ -31,7 +31,8 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS = 6
 } WriterType;
 
 /**
@@ -71,6 +72,24 @@ public:
 
 	virtual void closeStream(MM_EnvironmentBase *env) = 0;
 
+	/**
+	 * Wait until all the output so far has reached the writer's stream.
+	 */
+	virtual void flushStream(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if the writer takes each line of output unformatted, through outputEvent(), rather than as text
+	 */
+	virtual bool recordsEvents();
+
+	/**
+	 * Output a line which the writer formats later, outside of the caller.  Only called if recordsEvents().
+	 * @param indent[in] the indent level of the line
+	 * @param format[in] the format of the line, see omrstr_printf
+	 * @param args[in] the arguments of the format
+	 */
+	virtual void outputEvent(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
 	MMINLINE WriterType getType(void) { return _type; }
 
 	MMINLINE bool isActive(void) { return _isActive; }
@@ -16,8 +16,11 @@
  *    Multiple authors (IBM Corp.) - initial implementation and documentation
  *******************************************************************************/
 
+#include "omrstdarg.h"
+
 #include "VerboseWriterChain.hpp"
 
+#include "VerboseBinaryFormat.hpp"
 #include "VerboseBuffer.hpp"
 #include "VerboseWriter.hpp"
 
@@ -28,8 +31,6 @@
 #undef UT_MODULE_UNLOADED
 #include "ut_j9vgc.h"
 
-#define INDENT_SPACER "  "
-
 MM_VerboseWriterChain::MM_VerboseWriterChain()
 	: MM_Base()
 	,_buffer(NULL)
@@ -58,8 +59,22 @@ MM_VerboseWriterChain::formatAndOutputV(MM_EnvironmentBase *env, uintptr_t inden
 	/* Ensure we have a  buffer. */
 	Assert_VGC_true(NULL != _buffer);
 
+	/* writers which record events format them later, which keeps the formatting out of GC pauses.  Anything already
+	 * in the buffer has to go out first, so that the lines stay in order.
+	 */
+	if (('\0' == _buffer->contents()[0]) && recordsEvents()) {
+		MM_VerboseWriter* writer = _writers;
+		while (NULL != writer) {
+			va_list argsCopy;
+			COPY_VA_LIST(argsCopy, args);
+			writer->outputEvent(env, indent, format, argsCopy);
+			writer = writer->getNextWriter();
+		}
+		return;
+	}
+
 	for (uintptr_t i = 0; i < indent; ++i) {
-		_buffer->add(env, INDENT_SPACER);
+		_buffer->add(env, VERBOSEGC_INDENT_SPACER);
 	}
 	
 	_buffer->vprintf(env, format, args);
@@ -76,6 +91,18 @@ MM_VerboseWriterChain::formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent
 	va_end(args);
 }
 
+bool
+MM_VerboseWriterChain::recordsEvents()
+{
+	bool result = (NULL != _writers);
+	MM_VerboseWriter* writer = _writers;
+	while (result && (NULL != writer)) {
+		result = writer->recordsEvents();
+		writer = writer->getNextWriter();
+	}
+	return result;
+}
+
 void
 MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
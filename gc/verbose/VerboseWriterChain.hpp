@@ -51,6 +51,11 @@ public:
 	void formatAndOutputV(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
 	void flush(MM_EnvironmentBase *env);
 
+	/**
+	 * @return true if there are writers and they all record events, so output need not be formatted as it is produced
+	 */
+	bool recordsEvents();
+
 	/**
 	 * Add a new verbose writer to the list of active output writers.
 	 * @param writer[in] New writer to add to list.
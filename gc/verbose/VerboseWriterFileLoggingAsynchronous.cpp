@@ -0,0 +1,839 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omr.h"
+#include "omrstdarg.h"
+#include "omrutil.h"
+#include "modronapicore.hpp"
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseBuffer.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "GCExtensionsBase.hpp"
+#include "EnvironmentBase.hpp"
+#include "Math.hpp"
+
+#include <string.h>
+
+#undef _UTE_MODULE_HEADER_
+#undef UT_MODULE_LOADED
+#undef UT_MODULE_UNLOADED
+#include "ut_j9vgc.h"
+
+/* Bytes of output which can be waiting for the writer thread before the thread reporting GC events has to wait (a power of two) */
+#define ASYNCHRONOUS_RING_SIZE ((uintptr_t)1024 * 1024)
+
+/* Formats which can be given an id in a binary file (a power of two), lines with any other format are written as text */
+#define ASYNCHRONOUS_FORMAT_COUNT ((uintptr_t)VERBOSEGC_BINARY_FORMAT_COUNT)
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_omrVM(env->getOmrVM())
+	,_monitor(NULL)
+	,_state(STATE_ERROR)
+	,_ring(NULL)
+	,_ringSize(0)
+	,_writeCursor(0)
+	,_readCursor(0)
+	,_logFileStream(NULL)
+	,_logFileIndex(0)
+	,_binary(false)
+	,_formats(NULL)
+	,_eventBuffer(NULL)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance and starts its writer thread.
+ * The first file is opened on the calling thread, so that a file which cannot be opened is reported at once.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_VerboseWriterFileLoggingAsynchronous")) {
+		return false;
+	}
+
+	_ringSize = ASYNCHRONOUS_RING_SIZE;
+	_ring = (char *)extensions->getForge()->allocate(_ringSize, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _ring) {
+		return false;
+	}
+
+	_eventBuffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+	if (NULL == _eventBuffer) {
+		return false;
+	}
+
+	_binary = extensions->binaryLogging;
+	if (_binary) {
+		_formats = (char **)extensions->getForge()->allocate(ASYNCHRONOUS_FORMAT_COUNT * sizeof(char *), MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _formats) {
+			return false;
+		}
+		memset(_formats, 0, ASYNCHRONOUS_FORMAT_COUNT * sizeof(char *));
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	/* hold the monitor over start-up of the thread so that it can not notify us of its start-up state before we wait */
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		writer_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _state) {
+			omrthread_monitor_wait(_monitor);
+		}
+	} else {
+		_state = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return (STATE_RUNNING == _state);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Writes out any output not yet written and stops the writer thread.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	if (STATE_ERROR != _state) {
+		/* tell the thread to stop once the ring is empty and then wait for it to exit */
+		omrthread_monitor_enter(_monitor);
+		while (STATE_TERMINATED != _state) {
+			_state = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify_all(_monitor);
+			omrthread_monitor_wait(_monitor);
+		}
+		omrthread_monitor_exit(_monitor);
+		_state = STATE_ERROR;
+	}
+
+	/* the file is still open, and there may be output left in the ring, if the thread could not be started */
+	if ((NULL != _ring) && (_writeCursor != _readCursor)) {
+		writeRecords(env);
+	}
+	closeLogFile(env);
+
+	if (NULL != _ring) {
+		extensions->getForge()->free(_ring);
+		_ring = NULL;
+	}
+
+	if (NULL != _formats) {
+		clearFormats(env);
+		extensions->getForge()->free(_formats);
+		_formats = NULL;
+	}
+
+	if (NULL != _eventBuffer) {
+		_eventBuffer->kill(env);
+		_eventBuffer = NULL;
+	}
+
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the current file on the calling thread.  Only called while the writer thread is not running or is idle.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env)
+{
+	return openFile(env, _currentFile);
+}
+
+/**
+ * Queues the closing of the file being written, behind the output already added to the ring.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase *env)
+{
+	addRecord(env, RECORD_CLOSE, NULL, 0);
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * @param[in] fileIndex the rotating file to open
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env, uintptr_t fileIndex)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, fileIndex);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(NULL == _logFileStream) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (NULL == _logFileStream) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+	_logFileIndex = fileIndex;
+
+	if (_binary) {
+		uint32_t fileHeader[2] = { VERBOSEGC_BINARY_VERSION, (uint32_t)sizeof(uintptr_t) };
+		omrfilestream_write(_logFileStream, VERBOSEGC_BINARY_MAGIC, VERBOSEGC_BINARY_MAGIC_LENGTH);
+		omrfilestream_write(_logFileStream, fileHeader, sizeof(fileHeader));
+		/* each file defines the formats it uses, so that it can be converted on its own */
+		clearFormats(env);
+	}
+
+	_eventBuffer->reset();
+	eventBufferPrintf(env, getHeader(env), version);
+	writeText(env, _eventBuffer->contents(), _eventBuffer->currentSize());
+	_eventBuffer->reset();
+
+	return true;
+}
+
+/**
+ * Prints the footer and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeLogFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(NULL != _logFileStream) {
+		writeText(env, getFooter(env), strlen(getFooter(env)));
+		writeText(env, "\n", strlen("\n"));
+		omrfilestream_close(_logFileStream);
+		_logFileStream = NULL;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	uintptr_t length = strlen(string);
+	uintptr_t maximumLength = (_ringSize / 2) - sizeof(RecordHeader);
+
+	while (0 != length) {
+		uintptr_t recordLength = OMR_MIN(length, maximumLength);
+		addRecord(env, RECORD_TEXT, string, recordLength);
+		string += recordLength;
+		length -= recordLength;
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::recordsEvents()
+{
+	return true;
+}
+
+/**
+ * Copies the format and its arguments to the ring, for the writer thread to format or to write to the binary file.
+ * A line whose arguments can not be recorded is formatted here and added as text.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputEvent(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	uintptr_t formatLength = strlen(format) + 1;
+	uintptr_t length = formatLength;
+	bool recordable = true;
+	const char *cursor = format;
+	const char *start = NULL;
+	uintptr_t conversionLength = 0;
+
+	/* the first pass finds the size of the record */
+	va_list sizeArgs;
+	COPY_VA_LIST(sizeArgs, args);
+	while (recordable) {
+		VerboseArgumentType type = verboseNextConversion(cursor, &start, &conversionLength);
+		if (0 == conversionLength) {
+			break;
+		}
+		cursor = start + conversionLength;
+		switch (type) {
+		case VERBOSEGC_ARGUMENT_NONE:
+			break;
+		case VERBOSEGC_ARGUMENT_INT:
+			va_arg(sizeArgs, int);
+			length += sizeof(uint64_t);
+			break;
+		case VERBOSEGC_ARGUMENT_LONG:
+			va_arg(sizeArgs, long);
+			length += sizeof(uint64_t);
+			break;
+		case VERBOSEGC_ARGUMENT_LONG_LONG:
+			va_arg(sizeArgs, long long);
+			length += sizeof(uint64_t);
+			break;
+		case VERBOSEGC_ARGUMENT_SIZE:
+			va_arg(sizeArgs, uintptr_t);
+			length += sizeof(uint64_t);
+			break;
+		case VERBOSEGC_ARGUMENT_POINTER:
+			va_arg(sizeArgs, void *);
+			length += sizeof(uint64_t);
+			break;
+		case VERBOSEGC_ARGUMENT_DOUBLE:
+			va_arg(sizeArgs, double);
+			length += sizeof(double);
+			break;
+		case VERBOSEGC_ARGUMENT_STRING:
+		{
+			const char *string = va_arg(sizeArgs, const char *);
+			length += strlen((NULL == string) ? VERBOSEGC_NULL_STRING : string) + 1;
+			break;
+		}
+		default:
+			recordable = false;
+			break;
+		}
+	}
+
+	if (!recordable || (length > ((_ringSize / 2) - sizeof(RecordHeader)))) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uintptr_t spacerLength = strlen(VERBOSEGC_INDENT_SPACER);
+		va_list textArgs;
+		COPY_VA_LIST(textArgs, args);
+		/* the size includes the NUL, which leaves room for the newline */
+		uintptr_t textLength = (indent * spacerLength) + omrstr_vprintf(NULL, 0, format, textArgs);
+		char *text = (char *)env->getForge()->allocate(textLength + 1, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL != text) {
+			char *textCursor = text;
+			for (uintptr_t i = 0; i < indent; i++) {
+				memcpy(textCursor, VERBOSEGC_INDENT_SPACER, spacerLength);
+				textCursor += spacerLength;
+			}
+			COPY_VA_LIST(textArgs, args);
+			textCursor += omrstr_vprintf(textCursor, textLength - (textCursor - text), format, textArgs);
+			strcpy(textCursor, "\n");
+			outputString(env, text);
+			env->getForge()->free(text);
+		}
+		return;
+	}
+
+	/* the second pass copies the format and the arguments into the record, as they are laid out in the binary file */
+	RecordHeader *header = reserveRecord(env, RECORD_EVENT, length);
+	header->indent = (uint32_t)indent;
+	char *payload = (char *)(header + 1);
+	memcpy(payload, format, formatLength);
+	payload += formatLength;
+	cursor = format;
+	for (;;) {
+		VerboseArgumentType type = verboseNextConversion(cursor, &start, &conversionLength);
+		if (0 == conversionLength) {
+			break;
+		}
+		cursor = start + conversionLength;
+		bool isSigned = verboseIsSignedConversion(start, conversionLength);
+		uint64_t value = 0;
+		switch (type) {
+		case VERBOSEGC_ARGUMENT_NONE:
+			continue;
+		case VERBOSEGC_ARGUMENT_INT:
+			value = isSigned ? (uint64_t)(int64_t)va_arg(args, int) : (uint64_t)va_arg(args, unsigned int);
+			break;
+		case VERBOSEGC_ARGUMENT_LONG:
+			value = isSigned ? (uint64_t)(int64_t)va_arg(args, long) : (uint64_t)va_arg(args, unsigned long);
+			break;
+		case VERBOSEGC_ARGUMENT_LONG_LONG:
+			value = (uint64_t)va_arg(args, unsigned long long);
+			break;
+		case VERBOSEGC_ARGUMENT_SIZE:
+			value = isSigned ? (uint64_t)(int64_t)va_arg(args, intptr_t) : (uint64_t)va_arg(args, uintptr_t);
+			break;
+		case VERBOSEGC_ARGUMENT_POINTER:
+			value = (uint64_t)(uintptr_t)va_arg(args, void *);
+			break;
+		case VERBOSEGC_ARGUMENT_DOUBLE:
+		{
+			double doubleValue = va_arg(args, double);
+			memcpy(payload, &doubleValue, sizeof(doubleValue));
+			payload += sizeof(doubleValue);
+			continue;
+		}
+		case VERBOSEGC_ARGUMENT_STRING:
+		{
+			const char *string = va_arg(args, const char *);
+			if (NULL == string) {
+				string = VERBOSEGC_NULL_STRING;
+			}
+			uintptr_t stringLength = strlen(string) + 1;
+			memcpy(payload, string, stringLength);
+			payload += stringLength;
+			continue;
+		}
+		default:
+			Assert_VGC_true(false);
+			break;
+		}
+		memcpy(payload, &value, sizeof(value));
+		payload += sizeof(value);
+	}
+	Assert_VGC_true(payload == ((char *)(header + 1) + length));
+	publishRecord(env, header);
+}
+
+/**
+ * Rotates the files if necessary, then wakes the writer thread to write out the cycle.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	MM_VerboseWriterFileLogging::endOfCycle(env);
+
+	omrthread_monitor_enter(_monitor);
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_monitor_exit(_monitor);
+}
+
+/**
+ * Waits until all the output so far has been written to the file.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::flushStream(MM_EnvironmentBase *env)
+{
+	waitForWriterThread(env);
+}
+
+/**
+ * Closes the file once all the output so far has been written to it.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeStream(MM_EnvironmentBase *env)
+{
+	closeFile(env);
+	waitForWriterThread(env);
+}
+
+/**
+ * Reconfigures the agent according to the parameters passed, once all the output so far has been written to the current file.
+ * The writer thread keeps running and is idle while the new file is opened.
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	closeStream(env);
+	return MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::addRecord(MM_EnvironmentBase *env, uint32_t type, const char *text, uintptr_t length)
+{
+	RecordHeader *header = reserveRecord(env, type, length);
+	if (0 != length) {
+		memcpy(header + 1, text, length);
+	}
+	publishRecord(env, header);
+}
+
+MM_VerboseWriterFileLoggingAsynchronous::RecordHeader *
+MM_VerboseWriterFileLoggingAsynchronous::reserveRecord(MM_EnvironmentBase *env, uint32_t type, uintptr_t length)
+{
+	uintptr_t recordSize = MM_Math::roundToCeiling(sizeof(RecordHeader), sizeof(RecordHeader) + length);
+	uintptr_t offset = _writeCursor & (_ringSize - 1);
+	/* a record which does not fit before the end of the ring starts at the beginning, after a pad record */
+	uintptr_t padSize = ((_ringSize - offset) < recordSize) ? (_ringSize - offset) : 0;
+
+	if ((_ringSize - (_writeCursor - _readCursor)) < (padSize + recordSize)) {
+		omrthread_monitor_enter(_monitor);
+		while ((_ringSize - (_writeCursor - _readCursor)) < (padSize + recordSize)) {
+			if (isWriterThreadRunning()) {
+				omrthread_monitor_notify_all(_monitor);
+				omrthread_monitor_wait(_monitor);
+			} else {
+				/* nothing else will make space, so write out the ring on this thread rather than overwrite it */
+				writeRecords(env);
+			}
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+
+	if (0 != padSize) {
+		RecordHeader *pad = (RecordHeader *)(_ring + offset);
+		pad->type = RECORD_PAD;
+		pad->fileIndex = 0;
+		pad->length = 0;
+		pad->indent = 0;
+		MM_AtomicOperations::writeBarrier();
+		_writeCursor += padSize;
+		offset = 0;
+	}
+
+	RecordHeader *header = (RecordHeader *)(_ring + offset);
+	header->type = type;
+	header->fileIndex = (uint32_t)_currentFile;
+	header->length = (uint32_t)length;
+	header->indent = 0;
+	return header;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::publishRecord(MM_EnvironmentBase *env, RecordHeader *header)
+{
+	/* the record must be complete before the writer thread can see it */
+	MM_AtomicOperations::writeBarrier();
+	_writeCursor += MM_Math::roundToCeiling(sizeof(RecordHeader), sizeof(RecordHeader) + header->length);
+
+	if ((_writeCursor - _readCursor) > (_ringSize / 2)) {
+		/* don't leave it to the end of the cycle to make space */
+		omrthread_monitor_enter(_monitor);
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::waitForWriterThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	uintptr_t writeCursor = _writeCursor;
+	while (0 < (intptr_t)(writeCursor - _readCursor)) {
+		if (isWriterThreadRunning()) {
+			omrthread_monitor_notify_all(_monitor);
+			omrthread_monitor_wait(_monitor);
+		} else {
+			writeRecords(env);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsynchronous::writer_thread_proc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	/* run the writing loop until shutdown.  This method will NOT return */
+	writer->writerThreadEntryPoint();
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writerThreadEntryPoint()
+{
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_RUNNING;
+	omrthread_monitor_notify_all(_monitor);
+	for (;;) {
+		if (_writeCursor != _readCursor) {
+			/* write outside of the monitor so that the thread reporting GC events only waits for it when the ring is full */
+			omrthread_monitor_exit(_monitor);
+			writeRecords(&env);
+			omrthread_monitor_enter(_monitor);
+			/* wake threads waiting for space in the ring or for their output to be written */
+			omrthread_monitor_notify_all(_monitor);
+		} else if (STATE_TERMINATION_REQUESTED == _state) {
+			break;
+		} else {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	closeLogFile(&env);
+	_state = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeRecords(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t writeCursor = _writeCursor;
+	uintptr_t readCursor = _readCursor;
+
+	/* see the records up to writeCursor as the producer wrote them */
+	MM_AtomicOperations::readBarrier();
+
+	while (readCursor != writeCursor) {
+		uintptr_t offset = readCursor & (_ringSize - 1);
+		RecordHeader *header = (RecordHeader *)(_ring + offset);
+		uintptr_t recordSize = sizeof(RecordHeader);
+
+		switch (header->type) {
+		case RECORD_TEXT:
+		case RECORD_EVENT:
+			if ((NULL != _logFileStream) && (header->fileIndex != _logFileIndex)) {
+				closeLogFile(env);
+			}
+			if (NULL == _logFileStream) {
+				/* we open the file when there is output for it so can't have a final empty file at the end of a run */
+				openFile(env, header->fileIndex);
+			}
+			if (RECORD_TEXT == header->type) {
+				writeText(env, (const char *)(header + 1), header->length);
+			} else {
+				writeEvent(env, header);
+			}
+			recordSize += header->length;
+			break;
+		case RECORD_CLOSE:
+			closeLogFile(env);
+			break;
+		case RECORD_PAD:
+			recordSize = _ringSize - offset;
+			break;
+		default:
+			Assert_VGC_true(RECORD_PAD == header->type);
+		}
+		readCursor += MM_Math::roundToCeiling(sizeof(RecordHeader), recordSize);
+	}
+
+	if (NULL != _logFileStream) {
+		omrfilestream_sync(_logFileStream);
+	}
+
+	/* the records must be written out before the producer can reuse their space */
+	MM_AtomicOperations::readWriteBarrier();
+	_readCursor = readCursor;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeText(MM_EnvironmentBase *env, const char *text, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (NULL == _logFileStream) {
+		omrfilestream_write_text(OMRPORT_STREAM_ERR, text, length, J9STR_CODE_PLATFORM_RAW);
+	} else if (_binary) {
+		writeBinaryRecord(env, VERBOSEGC_BINARY_TEXT, NULL, 0, text, length);
+	} else {
+		omrfilestream_write_text(_logFileStream, text, length, J9STR_CODE_PLATFORM_RAW);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeEvent(MM_EnvironmentBase *env, RecordHeader *header)
+{
+	const char *format = (const char *)(header + 1);
+	uintptr_t formatLength = strlen(format) + 1;
+
+	/* a line without arguments is no bigger as text */
+	if (_binary && (NULL != _logFileStream) && (formatLength != header->length)) {
+		uintptr_t formatId = getFormatId(env, format);
+		if (ASYNCHRONOUS_FORMAT_COUNT != formatId) {
+			uint32_t prefix[2] = { (uint32_t)formatId, header->indent };
+			writeBinaryRecord(env, VERBOSEGC_BINARY_EVENT, prefix, sizeof(prefix), format + formatLength, header->length - formatLength);
+			return;
+		}
+	}
+
+	_eventBuffer->reset();
+	formatEvent(env, header);
+	writeText(env, _eventBuffer->contents(), _eventBuffer->currentSize());
+	_eventBuffer->reset();
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::formatEvent(MM_EnvironmentBase *env, RecordHeader *header)
+{
+	const char *cursor = (const char *)(header + 1);
+	const char *args = cursor + strlen(cursor) + 1;
+
+	for (uint32_t i = 0; i < header->indent; i++) {
+		_eventBuffer->add(env, VERBOSEGC_INDENT_SPACER);
+	}
+
+	for (;;) {
+		const char *start = NULL;
+		uintptr_t length = 0;
+		VerboseArgumentType type = verboseNextConversion(cursor, &start, &length);
+		if (start != cursor) {
+			eventBufferPrintf(env, "%.*s", (int)(start - cursor), cursor);
+		}
+		if (0 == length) {
+			break;
+		}
+		cursor = start + length;
+
+		char spec[VERBOSEGC_CONVERSION_MAX_LENGTH + 3];
+		verboseCopyConversion(spec, start, length, type);
+		switch (type) {
+		case VERBOSEGC_ARGUMENT_NONE:
+			_eventBuffer->add(env, "%");
+			break;
+		case VERBOSEGC_ARGUMENT_INT:
+		case VERBOSEGC_ARGUMENT_LONG:
+		case VERBOSEGC_ARGUMENT_LONG_LONG:
+		case VERBOSEGC_ARGUMENT_SIZE:
+		case VERBOSEGC_ARGUMENT_POINTER:
+		{
+			uint64_t value = 0;
+			memcpy(&value, args, sizeof(value));
+			args += sizeof(value);
+			if (VERBOSEGC_ARGUMENT_POINTER == type) {
+				eventBufferPrintf(env, spec, (void *)(uintptr_t)value);
+			} else if ('c' == start[length - 1]) {
+				eventBufferPrintf(env, spec, (int)value);
+			} else {
+				eventBufferPrintf(env, spec, (long long)value);
+			}
+			break;
+		}
+		case VERBOSEGC_ARGUMENT_DOUBLE:
+		{
+			double value = 0.0;
+			memcpy(&value, args, sizeof(value));
+			args += sizeof(value);
+			eventBufferPrintf(env, spec, value);
+			break;
+		}
+		case VERBOSEGC_ARGUMENT_STRING:
+			eventBufferPrintf(env, spec, args);
+			args += strlen(args) + 1;
+			break;
+		default:
+			Assert_VGC_true(false);
+			break;
+		}
+	}
+
+	_eventBuffer->add(env, "\n");
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::eventBufferPrintf(MM_EnvironmentBase *env, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	_eventBuffer->vprintf(env, format, args);
+	va_end(args);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeBinaryRecord(MM_EnvironmentBase *env, uint32_t type, const void *prefix, uintptr_t prefixLength, const void *data, uintptr_t dataLength)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	VerboseBinaryRecord record;
+	record.type = type;
+	record.length = (uint32_t)(prefixLength + dataLength);
+
+	omrfilestream_write(_logFileStream, &record, sizeof(record));
+	if (0 != prefixLength) {
+		omrfilestream_write(_logFileStream, prefix, prefixLength);
+	}
+	if (0 != dataLength) {
+		omrfilestream_write(_logFileStream, data, dataLength);
+	}
+}
+
+uintptr_t
+MM_VerboseWriterFileLoggingAsynchronous::getFormatId(MM_EnvironmentBase *env, const char *format)
+{
+	uintptr_t hash = 0;
+	for (const char *cursor = format; '\0' != *cursor; cursor++) {
+		hash = (hash * 31) + (uint8_t)*cursor;
+	}
+
+	for (uintptr_t probe = 0; probe < ASYNCHRONOUS_FORMAT_COUNT; probe++) {
+		uintptr_t formatId = (hash + probe) & (ASYNCHRONOUS_FORMAT_COUNT - 1);
+		if (NULL == _formats[formatId]) {
+			uintptr_t formatLength = strlen(format) + 1;
+			char *copy = (char *)env->getForge()->allocate(formatLength, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+			if (NULL == copy) {
+				break;
+			}
+			memcpy(copy, format, formatLength);
+			_formats[formatId] = copy;
+
+			uint32_t prefix = (uint32_t)formatId;
+			writeBinaryRecord(env, VERBOSEGC_BINARY_FORMAT, &prefix, sizeof(prefix), format, formatLength);
+			return formatId;
+		}
+		if (0 == strcmp(_formats[formatId], format)) {
+			return formatId;
+		}
+	}
+	return ASYNCHRONOUS_FORMAT_COUNT;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::clearFormats(MM_EnvironmentBase *env)
+{
+	for (uintptr_t formatId = 0; formatId < ASYNCHRONOUS_FORMAT_COUNT; formatId++) {
+		if (NULL != _formats[formatId]) {
+			env->getForge()->free(_formats[formatId]);
+			_formats[formatId] = NULL;
+		}
+	}
+}
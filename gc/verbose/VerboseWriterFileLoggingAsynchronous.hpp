@@ -0,0 +1,201 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+class MM_VerboseBuffer;
+
+/**
+ * Ouptut agent which directs verbosegc output to file from a background thread.
+ *
+ * The thread reporting a GC event (usually while the world is stopped) only copies each line of output into a ring
+ * buffer, unformatted: the format and its arguments.  A writer thread formats the lines and does the file I/O (opening,
+ * rotating, writing and closing the files) outside of the pause.  With -Xgc:binaryLogging the writer thread does not
+ * format the lines either, it writes them to the file as the binary records of VerboseBinaryFormat.hpp, which the
+ * vgcconvert tool turns into the XML.
+ *
+ * The ring has a single producer, since verbose output is already serialized by the writer chain, and a single
+ * consumer, so records are published with memory barriers rather than a lock.  The producer only waits when the ring
+ * is full, and writes the records out itself if the writer thread is not running.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	enum {
+		RECORD_TEXT = 0, /**< output for the file the record was written for */
+		RECORD_EVENT, /**< a line of output for the file the record was written for, as its format and arguments */
+		RECORD_CLOSE, /**< close the file being written */
+		RECORD_PAD /**< unused space up to the end of the ring */
+	};
+
+	enum {
+		STATE_ERROR = 0, /**< the writer thread is not running */
+		STATE_STARTING,
+		STATE_RUNNING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED
+	};
+
+	/**
+	 * Header of each record in the ring, followed by the text of RECORD_TEXT records, or the NUL terminated format of
+	 * RECORD_EVENT records followed by their arguments as they are laid out in the binary format.  Records are padded to a multiple
+	 * of the header size so that a header never wraps around the end of the ring.
+	 */
+	struct RecordHeader {
+		uint32_t type; /**< RECORD_TEXT, RECORD_EVENT, RECORD_CLOSE or RECORD_PAD */
+		uint32_t fileIndex; /**< the rotating file a RECORD_TEXT or RECORD_EVENT record goes to */
+		uint32_t length; /**< bytes following the header */
+		uint32_t indent; /**< the indent level of a RECORD_EVENT record */
+	};
+
+	OMR_VM *_omrVM;
+	omrthread_monitor_t _monitor; /**< protects _state and is used to wait for the writer thread, or for space in the ring */
+	volatile uintptr_t _state; /**< state of the writer thread */
+
+	char *_ring; /**< buffer of records not yet written */
+	uintptr_t _ringSize; /**< bytes in _ring, a power of two */
+	volatile uintptr_t _writeCursor; /**< bytes ever added to the ring, only updated by the producer */
+	volatile uintptr_t _readCursor; /**< bytes ever consumed from the ring, only updated by the writer thread */
+
+	OMRFileStream *_logFileStream; /**< the filestream being written to, only used by the writer thread once it is started */
+	uintptr_t _logFileIndex; /**< the rotating file _logFileStream is open on */
+
+	bool _binary; /**< true if the files are written in the binary format rather than as XML */
+	char **_formats; /**< copies of the formats which have been given an id (their index) in the binary file being written */
+	MM_VerboseBuffer *_eventBuffer; /**< the writer thread formats RECORD_EVENT records in this buffer */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+	virtual bool recordsEvents();
+
+	virtual void outputEvent(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	virtual void flushStream(MM_EnvironmentBase *env);
+
+	virtual void closeStream(MM_EnvironmentBase *env);
+
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env);
+	void closeFile(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, uintptr_t fileIndex);
+	void closeLogFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Add a record to the ring, waiting for the writer thread to make space if the ring is full.
+	 * @param[in] type the type of the record
+	 * @param[in] text the text following the header, NULL if length is 0
+	 * @param[in] length bytes of text, no more than half the ring
+	 */
+	void addRecord(MM_EnvironmentBase *env, uint32_t type, const char *text, uintptr_t length);
+
+	/**
+	 * Make space for a record at the end of the ring, waiting for the writer thread to make space if the ring is full,
+	 * or writing out the ring on the calling thread if the writer thread is not running.
+	 * @param[in] type the type of the record
+	 * @param[in] length bytes following the header, no more than half the ring
+	 * @return the header of the record, which is filled in but not seen by the writer thread until publishRecord()
+	 */
+	RecordHeader *reserveRecord(MM_EnvironmentBase *env, uint32_t type, uintptr_t length);
+
+	/**
+	 * Make the record returned by reserveRecord() available to the writer thread.
+	 */
+	void publishRecord(MM_EnvironmentBase *env, RecordHeader *header);
+
+	/**
+	 * Wake the writer thread, and wait until it has written every record added so far.
+	 */
+	void waitForWriterThread(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if the writer thread is running, so it will write out the records in the ring.  Called with _monitor held.
+	 */
+	MMINLINE bool isWriterThreadRunning() { return (STATE_RUNNING == _state) || (STATE_TERMINATION_REQUESTED == _state); }
+
+	static int J9THREAD_PROC writer_thread_proc(void *info);
+	void writerThreadEntryPoint();
+	void writeRecords(MM_EnvironmentBase *env);
+
+	/**
+	 * Write text to the current file, or to stderr if the file could not be opened.
+	 */
+	void writeText(MM_EnvironmentBase *env, const char *text, uintptr_t length);
+
+	/**
+	 * Write a line of output recorded as a RECORD_EVENT record to the current file, or to stderr if the file could not be opened.
+	 */
+	void writeEvent(MM_EnvironmentBase *env, RecordHeader *header);
+
+	/**
+	 * Format a RECORD_EVENT record into _eventBuffer, as the line the writer chain would have formatted.
+	 */
+	void formatEvent(MM_EnvironmentBase *env, RecordHeader *header);
+
+	/**
+	 * Print to _eventBuffer.
+	 */
+	void eventBufferPrintf(MM_EnvironmentBase *env, const char *format, ...);
+
+	/**
+	 * Write a record of the binary format to the current file, its payload being the prefix followed by the data.
+	 */
+	void writeBinaryRecord(MM_EnvironmentBase *env, uint32_t type, const void *prefix, uintptr_t prefixLength, const void *data, uintptr_t dataLength);
+
+	/**
+	 * Find the id of a format in the binary file being written, defining it the first time the format is seen.
+	 * @return the id, or ASYNCHRONOUS_FORMAT_COUNT if the file has as many formats as it can hold
+	 */
+	uintptr_t getFormatId(MM_EnvironmentBase *env, const char *format);
+
+	/**
+	 * Forget the formats defined in the binary file being written.
+	 */
+	void clearFormats(MM_EnvironmentBase *env);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
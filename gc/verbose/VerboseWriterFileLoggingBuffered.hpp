@@ -44,6 +44,8 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string);
 
+	virtual void flushStream(MM_EnvironmentBase *env);
+
 protected:
 	MM_VerboseWriterFileLoggingBuffered(MM_EnvironmentBase *env, MM_VerboseManager *manager);
 
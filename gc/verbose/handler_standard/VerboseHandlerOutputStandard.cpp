@@ -267,6 +267,36 @@ MM_VerboseHandlerOutputStandard::handleGCOPOuterStanzaEnd(MM_EnvironmentBase* en
 	writer->formatAndOutput(env, 0, "</gc-op>");
 }
 
+void
+MM_VerboseHandlerOutputStandard::outputNumaInfo(MM_EnvironmentBase* env, uintptr_t indent, uintptr_t localCount, uintptr_t remoteCount)
+{
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
+	uintptr_t totalCount = localCount + remoteCount;
+	uintptr_t localPercent = (0 == totalCount) ? 100 : ((localCount * 100) / totalCount);
+
+	writer->formatAndOutput(env, indent, "<numa-info local=\"%zu\" remote=\"%zu\" localpercent=\"%zu\" />", localCount, remoteCount, localPercent);
+}
+
+void
+MM_VerboseHandlerOutputStandard::outputRootScanInfo(MM_EnvironmentBase* env, uintptr_t indent, MM_RootScannerStats *rootScannerStats)
+{
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
+
+	for (uintptr_t entity = RootScannerEntity_None + 1; entity < RootScannerEntity_Count; entity++) {
+		if (0 != rootScannerStats->_entityScanTime[entity]) {
+			uint64_t totalTime = 0;
+			uint64_t maxTime = 0;
+			getTimeDeltaInMicroSeconds(&totalTime, 0, rootScannerStats->_entityScanTime[entity]);
+			getTimeDeltaInMicroSeconds(&maxTime, 0, rootScannerStats->_entityScanTimeMax[entity]);
+			writer->formatAndOutput(env, indent, "<root-scan entity=\"%s\" slices=\"%zu\" totalms=\"%llu.%03.3llu\" maxms=\"%llu.%03.3llu\" />",
+					getRootScannerEntityAsString((RootScannerEntity)entity), rootScannerStats->_entitySlicesScanned[entity],
+					totalTime / 1000, totalTime % 1000, maxTime / 1000, maxTime % 1000);
+		}
+	}
+}
+
 void
 MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
 {
@@ -285,6 +315,13 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
 
+	outputRootScanInfo(env, 1, &extensions->globalGCStats.rootScannerStats);
+
+	if (extensions->backgroundMarkMapClear) {
+		writer->formatAndOutput(env, 1, "<markmap-clear concurrentbytes=\"%zu\" pausebytes=\"%zu\" />",
+				markStats->_markMapBytesClearedConcurrently, markStats->_markMapBytesClearedInPause);
+	}
+
 	handleMarkEndInternal(env, eventData);
 
 	handleGCOPOuterStanzaEnd(env);
@@ -309,7 +346,15 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
 	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	if (extensions->numaAwareGCWork) {
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		outputNumaInfo(env, 1, sweepStats->_sweepChunksLocal, sweepStats->_sweepChunksRemote);
+		handleGCOPOuterStanzaEnd(env);
+		writer->flush(env);
+	} else {
+		handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	}
 
 	handleSweepEndInternal(env, eventData);
 	exitAtomicReportingBlock();
@@ -359,6 +404,28 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
 		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
 				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+
+		uint64_t setupTime = 0;
+		uint64_t summaryTime = 0;
+		uint64_t moveTime = 0;
+		uint64_t fixupTime = 0;
+		uint64_t rootFixupTime = 0;
+		uint64_t rebuildTime = 0;
+		getTimeDeltaInMicroSeconds(&setupTime, compactStats->_setupStartTime, compactStats->_setupEndTime);
+		getTimeDeltaInMicroSeconds(&summaryTime, compactStats->_summaryStartTime, compactStats->_summaryEndTime);
+		getTimeDeltaInMicroSeconds(&moveTime, compactStats->_moveStartTime, compactStats->_moveEndTime);
+		getTimeDeltaInMicroSeconds(&fixupTime, compactStats->_fixupStartTime, compactStats->_fixupEndTime);
+		getTimeDeltaInMicroSeconds(&rootFixupTime, compactStats->_rootFixupStartTime, compactStats->_rootFixupEndTime);
+		getTimeDeltaInMicroSeconds(&rebuildTime, compactStats->_rebuildStartTime, compactStats->_rebuildEndTime);
+		const char *mode = compactStats->_slidingCompaction ? "sliding" : "subarea";
+		if (0 != compactStats->_partialCompactAreas) {
+			mode = "partial";
+		}
+		writer->formatAndOutput(env, 1, "<compact-phases mode=\"%s\" areas=\"%zu\" setupms=\"%llu.%03.3llu\" summaryms=\"%llu.%03.3llu\" movems=\"%llu.%03.3llu\" fixupms=\"%llu.%03.3llu\" rootfixupms=\"%llu.%03.3llu\" rebuildms=\"%llu.%03.3llu\" />",
+				mode, compactStats->_partialCompactAreas,
+				setupTime / 1000, setupTime % 1000, summaryTime / 1000, summaryTime % 1000,
+				moveTime / 1000, moveTime % 1000, fixupTime / 1000, fixupTime % 1000,
+				rootFixupTime / 1000, rootFixupTime % 1000, rebuildTime / 1000, rebuildTime % 1000);
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -415,6 +482,8 @@ MM_VerboseHandlerOutputStandard::handleScavengeEnd(J9HookInterface** hook, uintp
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
 
+	outputRootScanInfo(env, 1, &scavengerStats->_rootScannerStats);
+
 	handleScavengeEndInternal(env, eventData);
 	
 	if(0 != scavengerStats->_tenureExpandedCount) {
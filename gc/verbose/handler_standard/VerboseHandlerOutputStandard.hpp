@@ -27,6 +27,7 @@
 
 class MM_CollectionStatistics;
 class MM_EnvironmentBase;
+class MM_RootScannerStats;
 
 class MM_VerboseHandlerOutputStandard : public MM_VerboseHandlerOutput
 {
@@ -52,6 +53,19 @@ protected:
 	void handleGCOPOuterStanzaStart(MM_EnvironmentBase* env, const char *type, uintptr_t contextID, uint64_t duration, bool deltaTimeSuccess);
 	void handleGCOPOuterStanzaEnd(MM_EnvironmentBase* env);
 
+	/**
+	 * Output the split of work between GC threads local and remote to the NUMA node backing it.
+	 * @param[IN] localCount units of work processed by a thread on the owning node
+	 * @param[IN] remoteCount units of work processed by a thread on another node
+	 */
+	void outputNumaInfo(MM_EnvironmentBase* env, uintptr_t indent, uintptr_t localCount, uintptr_t remoteCount);
+
+	/**
+	 * Output the time spent scanning each root scanner entity scanned during the operation.
+	 * @param[IN] rootScannerStats root scan times merged from all the GC threads
+	 */
+	void outputRootScanInfo(MM_EnvironmentBase* env, uintptr_t indent, MM_RootScannerStats *rootScannerStats);
+
 	virtual bool hasOutputMemoryInfoInnerStanza();
 	virtual void outputMemoryInfoInnerStanzaInternal(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
@@ -37,6 +37,17 @@
 #define OMR_GC_CYCLE_TYPE_GLOBAL      1
 #define OMR_GC_CYCLE_TYPE_SCAVENGE    2
 
+/* Pause time histograms kept by the GC, see OMR_GC_GetPauseTimeStats() */
+#define OMR_GC_PAUSE_TYPE_SCAVENGE 0 /* stop-the-world scavenge */
+#define OMR_GC_PAUSE_TYPE_GLOBAL 1 /* stop-the-world global collection, not completing a concurrent cycle */
+#define OMR_GC_PAUSE_TYPE_CONCURRENT_FINAL 2 /* stop-the-world global collection completing a concurrent cycle */
+#define OMR_GC_PAUSE_TYPE_ROOT_SCAN 3 /* root scanning of a mark or scavenge, as seen by the master GC thread */
+#define OMR_GC_PAUSE_TYPE_MARK 4
+#define OMR_GC_PAUSE_TYPE_SWEEP 5
+#define OMR_GC_PAUSE_TYPE_COMPACT 6
+#define OMR_GC_PAUSE_TYPE_REMEMBERED_SET_SCAN 7 /* remembered set scanning of a scavenge, as seen by the master GC thread */
+#define OMR_GC_PAUSE_TYPE_COUNT 8
+
 /* Core allocation flags defined for OMR are < OMR_GC_ALLOCATE_OBJECT_LANGUAGE_DEFINED_BASE */
 #define OMR_GC_ALLOCATE_OBJECT_NON_INSTRUMENTABLE 0x0
 #define OMR_GC_ALLOCATE_OBJECT_INSTRUMENTABLE 0x1
@@ -178,6 +189,7 @@ struct ModronLnrlOptions {
 #define MINIMUM_CONTRACTION_RATIO_MULTIPLIER	10
 
 #define DESIRED_SUBAREA_SIZE		((uintptr_t)(4*1024*1024))
+#define SLIDING_COMPACT_BLOCK_SIZE	((uintptr_t)(64*1024))
 
 typedef enum {
 	COMPACT_NONE = 0,
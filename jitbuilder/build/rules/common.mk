@@ -93,6 +93,8 @@ JITBUILDER_FILES=$(RELEASE_DIR)/Makefile \
              $(RELEASE_INCLUDE)/$(JIT_OMR_DIRTY_DIR)/ilgen/BytecodeBuilder.hpp \
              $(RELEASE_INCLUDE)/$(JIT_OMR_DIRTY_DIR)/ilgen/TypeDictionary.hpp \
              $(RELEASE_INCLUDE)/$(JIT_OMR_DIRTY_DIR)/ilgen/IlGen.hpp \
+             $(RELEASE_SRC)/AsyncCompile.hpp \
+             $(RELEASE_SRC)/AsyncCompile.cpp \
              $(RELEASE_SRC)/Call.hpp \
              $(RELEASE_SRC)/Call.cpp \
              $(RELEASE_SRC)/DotProduct.hpp \
@@ -0,0 +1,494 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016, 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "compile/CompilationTypes.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/Method.hpp"
+#include "control/CompilationQueue.hpp"
+#include "control/CompileMethod.hpp"
+#include "env/CompilerEnv.hpp"
+#include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
+#include "ilgen/MethodBuilder.hpp"
+
+// Compilations recurse deeply, so do not rely on the platform default
+// (which is only 512KB for secondary threads on OSX)
+#define COMPILATION_THREAD_STACK_SIZE (8 * 1024 * 1024)
+
+namespace JitBuilder
+{
+
+// The bucketing and percentile rules mirror MM_PauseTimeHistogram in
+// gc/stats/PauseTimeHistogram.cpp, which JitBuilder cannot link against;
+// keep the two in step so compile and GC pause percentiles compare directly.
+void
+CompileTimeHistogram::clear()
+   {
+   memset(_buckets, 0, sizeof(_buckets));
+   _count = 0;
+   _maximum = 0;
+   }
+
+uint32_t
+CompileTimeHistogram::getBucketIndex(uint64_t micros)
+   {
+   // The first 2 * SUB_BUCKETS buckets hold one value each, after which each
+   // power of two is split into SUB_BUCKETS
+   uint32_t shift = 0;
+   while ((micros >> shift) >= (2 * SUB_BUCKETS))
+      shift++;
+   if (shift > MAXIMUM_SHIFT)
+      return BUCKET_COUNT - 1;
+   return (shift * SUB_BUCKETS) + (uint32_t)(micros >> shift);
+   }
+
+uint64_t
+CompileTimeHistogram::getBucketLimit(uint32_t index)
+   {
+   if (index < (2 * SUB_BUCKETS))
+      return index;
+   uint32_t shift = (index / SUB_BUCKETS) - 1;
+   uint64_t mantissa = index - (shift * SUB_BUCKETS);
+   return ((mantissa + 1) << shift) - 1;
+   }
+
+void
+CompileTimeHistogram::add(uint64_t micros)
+   {
+   _buckets[getBucketIndex(micros)]++;
+   _count++;
+   if (micros > _maximum)
+      _maximum = micros;
+   }
+
+uint64_t
+CompileTimeHistogram::getPercentile(double percentile) const
+   {
+   if (_count == 0)
+      return 0;
+
+   // rank of the time at the percentile, rounded up
+   double exactRank = (percentile * (double)_count) / 100.0;
+   uint64_t rank = (uint64_t)exactRank;
+   if ((double)rank < exactRank)
+      rank++;
+   if (rank == 0)
+      rank = 1;
+
+   uint64_t seen = 0;
+   for (uint32_t i = 0; i < BUCKET_COUNT; i++)
+      {
+      seen += _buckets[i];
+      if (seen >= rank)
+         {
+         uint64_t limit = getBucketLimit(i);
+         return limit < _maximum ? limit : _maximum;
+         }
+      }
+   return _maximum;
+   }
+
+void
+CompileTimeHistogram::getTimes(JitCompileTimes *times) const
+   {
+   times->count = _count;
+   times->p50Micros = getPercentile(50.0);
+   times->p90Micros = getPercentile(90.0);
+   times->p99Micros = getPercentile(99.0);
+   times->maximumMicros = _maximum;
+   }
+
+
+CompilationQueue CompilationQueue::_instance;
+
+CompilationQueue::CompilationQueue()
+   : _threads(NULL),
+     _numThreads(0),
+     _shuttingDown(false),
+     _queue(NULL),
+     _inProgress(NULL),
+     _sequence(0),
+     _numRequests(0),
+     _numDuplicates(0),
+     _numFailures(0)
+   {
+   pthread_mutex_init(&_mutex, NULL);
+   pthread_cond_init(&_workAvailable, NULL);
+   pthread_cond_init(&_requestCompleted, NULL);
+   }
+
+bool
+CompilationQueue::startThreads(int32_t numThreads)
+   {
+   pthread_mutex_lock(&_mutex);
+   bool started = startThreadsLocked(numThreads);
+   pthread_mutex_unlock(&_mutex);
+   return started;
+   }
+
+bool
+CompilationQueue::startThreadsLocked(int32_t numThreads)
+   {
+   if (_numThreads > 0 || numThreads <= 0)
+      return false;
+
+   _threads = (pthread_t *)TR_Memory::jitPersistentAlloc(numThreads * sizeof(pthread_t), TR_Memory::CompilationInfo);
+   if (!_threads)
+      return false;
+
+   pthread_attr_t attr;
+   pthread_attr_init(&attr);
+   pthread_attr_setstacksize(&attr, COMPILATION_THREAD_STACK_SIZE);
+
+   _shuttingDown = false;
+   for (int32_t t = 0; t < numThreads; t++)
+      {
+      if (pthread_create(&_threads[_numThreads], &attr, compilationThread, this) != 0)
+         break;
+      _numThreads++;
+      }
+   pthread_attr_destroy(&attr);
+
+   if (_numThreads == 0)
+      {
+      TR_Memory::jitPersistentFree(_threads);
+      _threads = NULL;
+      return false;
+      }
+   return true;
+   }
+
+void
+CompilationQueue::shutdown()
+   {
+   pthread_mutex_lock(&_mutex);
+   if (_numThreads == 0)
+      {
+      pthread_mutex_unlock(&_mutex);
+      return;
+      }
+
+   _shuttingDown = true;
+   pthread_cond_broadcast(&_workAvailable);
+   pthread_mutex_unlock(&_mutex);
+
+   for (int32_t t = 0; t < _numThreads; t++)
+      pthread_join(_threads[t], NULL);
+
+   // No compilation thread is left to run the remaining requests
+   pthread_mutex_lock(&_mutex);
+   while (_queue)
+      {
+      CompileRequest *request = _queue;
+      _queue = request->_next;
+      request->_next = NULL;
+      pthread_mutex_unlock(&_mutex);
+      complete(request, COMPILATION_INTERRUPTED, NULL);
+      pthread_mutex_lock(&_mutex);
+      }
+
+   TR_Memory::jitPersistentFree(_threads);
+   _threads = NULL;
+   _numThreads = 0;
+   pthread_mutex_unlock(&_mutex);
+   }
+
+CompileRequest *
+CompilationQueue::findPending(TR::MethodBuilder *m)
+   {
+   for (CompileRequest *r = _queue; r; r = r->_next)
+      if (r->_method == m)
+         return r;
+   for (CompileRequest *r = _inProgress; r; r = r->_next)
+      if (r->_method == m)
+         return r;
+   return NULL;
+   }
+
+void
+CompilationQueue::insert(CompileRequest *request)
+   {
+   // A request whose priority was raised keeps its place among the requests
+   // of its new priority by the order it was first made in
+   CompileRequest **link = &_queue;
+   while (*link
+          && ((*link)->_priority > request->_priority
+              || ((*link)->_priority == request->_priority && (*link)->_sequence < request->_sequence)))
+      link = &(*link)->_next;
+   request->_next = *link;
+   *link = request;
+   }
+
+bool
+CompilationQueue::unlink(CompileRequest **list, CompileRequest *request)
+   {
+   for (CompileRequest **link = list; *link; link = &(*link)->_next)
+      {
+      if (*link == request)
+         {
+         *link = request->_next;
+         request->_next = NULL;
+         return true;
+         }
+      }
+   return false;
+   }
+
+CompileRequest *
+CompilationQueue::enqueue(TR::MethodBuilder *m, int32_t priority, JitCompileCallback callback, void *userData)
+   {
+   CompileCallbackRecord *record = NULL;
+   if (callback)
+      {
+      record = new (PERSISTENT_NEW) CompileCallbackRecord;
+      if (!record)
+         return NULL;
+      record->_callback = callback;
+      record->_userData = userData;
+      record->_next = NULL;
+      }
+
+   pthread_mutex_lock(&_mutex);
+
+   _numRequests++;
+   CompileRequest *request = findPending(m);
+   if (request)
+      {
+      _numDuplicates++;
+      if (priority > request->_priority && unlink(&_queue, request))
+         {
+         request->_priority = priority;
+         insert(request);
+         }
+      }
+   else
+      {
+      request = new (PERSISTENT_NEW) CompileRequest;
+      if (!request)
+         {
+         pthread_mutex_unlock(&_mutex);
+         if (record)
+            TR_Memory::jitPersistentFree(record);
+         return NULL;
+         }
+      request->_method = m;
+      request->_priority = priority;
+      request->_sequence = _sequence++;
+      request->_enqueueTime = TR::Compiler->vm.getUSecClock();
+      request->_callbacks = NULL;
+      request->_references = 1;
+      request->_done = false;
+      request->_rc = COMPILATION_REQUESTED;
+      request->_entry = NULL;
+      request->_next = NULL;
+      insert(request);
+
+      if (_numThreads == 0 && !startThreadsLocked(1))
+         {
+         unlink(&_queue, request);
+         TR_Memory::jitPersistentFree(request);
+         pthread_mutex_unlock(&_mutex);
+         if (record)
+            TR_Memory::jitPersistentFree(record);
+         return NULL;
+         }
+      pthread_cond_signal(&_workAvailable);
+      }
+
+   if (record)
+      {
+      record->_next = request->_callbacks;
+      request->_callbacks = record;
+      }
+   request->_references++;
+
+   pthread_mutex_unlock(&_mutex);
+   return request;
+   }
+
+void *
+CompilationQueue::compilationThread(void *queue)
+   {
+   static_cast<CompilationQueue *>(queue)->run();
+   return NULL;
+   }
+
+void
+CompilationQueue::run()
+   {
+   pthread_mutex_lock(&_mutex);
+   while (true)
+      {
+      while (!_queue && !_shuttingDown)
+         pthread_cond_wait(&_workAvailable, &_mutex);
+      if (_shuttingDown)
+         break;
+
+      CompileRequest *request = _queue;
+      _queue = request->_next;
+      request->_next = _inProgress;
+      _inProgress = request;
+      _queueWaitTimes.add(TR::Compiler->vm.getUSecClock() - request->_enqueueTime);
+
+      pthread_mutex_unlock(&_mutex);
+      compile(request);
+      pthread_mutex_lock(&_mutex);
+      }
+   pthread_mutex_unlock(&_mutex);
+
+   releaseScratchSegmentPool();
+   TR::Compiler->persistentAllocator().releaseThreadCache();
+   }
+
+void
+CompilationQueue::compile(CompileRequest *request)
+   {
+   uint64_t startTime = TR::Compiler->vm.getUSecClock();
+
+   TR::ResolvedMethod resolvedMethod(request->_method);
+   TR::IlGeneratorMethodDetails details(&resolvedMethod);
+   int32_t rc = 0;
+   uint8_t *entry = compileMethodFromDetails(NULL, details, warm, rc);
+
+   pthread_mutex_lock(&_mutex);
+   _compileTimes.add(TR::Compiler->vm.getUSecClock() - startTime);
+   if (rc != COMPILATION_SUCCEEDED)
+      _numFailures++;
+   unlink(&_inProgress, request);
+   pthread_mutex_unlock(&_mutex);
+
+   complete(request, rc, entry);
+   }
+
+// Called without the lock held, once request is no longer on any list
+void
+CompilationQueue::complete(CompileRequest *request, int32_t rc, uint8_t *entry)
+   {
+   pthread_mutex_lock(&_mutex);
+   request->_rc = rc;
+   request->_entry = entry;
+   request->_done = true;
+   CompileCallbackRecord *callbacks = request->_callbacks;
+   request->_callbacks = NULL;
+   pthread_cond_broadcast(&_requestCompleted);
+   pthread_mutex_unlock(&_mutex);
+
+   // Callbacks run in the order the requests were made
+   CompileCallbackRecord *ordered = NULL;
+   while (callbacks)
+      {
+      CompileCallbackRecord *next = callbacks->_next;
+      callbacks->_next = ordered;
+      ordered = callbacks;
+      callbacks = next;
+      }
+   while (ordered)
+      {
+      CompileCallbackRecord *next = ordered->_next;
+      ordered->_callback(request->_method, entry, rc, ordered->_userData);
+      TR_Memory::jitPersistentFree(ordered);
+      ordered = next;
+      }
+
+   pthread_mutex_lock(&_mutex);
+   releaseLocked(request);
+   pthread_mutex_unlock(&_mutex);
+   }
+
+int32_t
+CompilationQueue::wait(CompileRequest *request, uint8_t **entry)
+   {
+   pthread_mutex_lock(&_mutex);
+   while (!request->_done)
+      pthread_cond_wait(&_requestCompleted, &_mutex);
+   int32_t rc = request->_rc;
+   *entry = request->_entry;
+   pthread_mutex_unlock(&_mutex);
+   return rc;
+   }
+
+bool
+CompilationQueue::poll(CompileRequest *request, int32_t *rc, uint8_t **entry)
+   {
+   pthread_mutex_lock(&_mutex);
+   bool done = request->_done;
+   if (done)
+      {
+      *rc = request->_rc;
+      *entry = request->_entry;
+      }
+   pthread_mutex_unlock(&_mutex);
+   return done;
+   }
+
+void
+CompilationQueue::release(CompileRequest *request)
+   {
+   pthread_mutex_lock(&_mutex);
+   releaseLocked(request);
+   pthread_mutex_unlock(&_mutex);
+   }
+
+void
+CompilationQueue::releaseLocked(CompileRequest *request)
+   {
+   if (--request->_references == 0)
+      TR_Memory::jitPersistentFree(request);
+   }
+
+void
+CompilationQueue::getTimes(JitCompileTimes *queueWait, JitCompileTimes *compileTime)
+   {
+   pthread_mutex_lock(&_mutex);
+   if (queueWait)
+      _queueWaitTimes.getTimes(queueWait);
+   if (compileTime)
+      _compileTimes.getTimes(compileTime);
+   pthread_mutex_unlock(&_mutex);
+   }
+
+void
+CompilationQueue::printStatistics()
+   {
+   JitCompileTimes queueWait, compileTime;
+   pthread_mutex_lock(&_mutex);
+   uint64_t numRequests = _numRequests;
+   uint64_t numDuplicates = _numDuplicates;
+   uint64_t numFailures = _numFailures;
+   _queueWaitTimes.getTimes(&queueWait);
+   _compileTimes.getTimes(&compileTime);
+   pthread_mutex_unlock(&_mutex);
+
+   printf("Compilation queue: %llu requests, %llu duplicates, %llu failures\n",
+          (unsigned long long)numRequests, (unsigned long long)numDuplicates, (unsigned long long)numFailures);
+   printf("%-12s %10s %10s %10s %10s %10s\n", "(us)", "count", "p50", "p90", "p99", "max");
+   const char *names[] = { "queue wait", "compile" };
+   JitCompileTimes *times[] = { &queueWait, &compileTime };
+   for (int32_t i = 0; i < 2; i++)
+      {
+      printf("%-12s %10llu %10llu %10llu %10llu %10llu\n", names[i],
+             (unsigned long long)times[i]->count,
+             (unsigned long long)times[i]->p50Micros,
+             (unsigned long long)times[i]->p90Micros,
+             (unsigned long long)times[i]->p99Micros,
+             (unsigned long long)times[i]->maximumMicros);
+      }
+   }
+
+} // namespace JitBuilder
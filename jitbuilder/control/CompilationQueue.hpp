@@ -0,0 +1,176 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016, 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#ifndef JITBUILDER_COMPILATIONQUEUE_HPP
+#define JITBUILDER_COMPILATIONQUEUE_HPP
+
+#include <pthread.h>
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+
+namespace TR { class MethodBuilder; }
+
+// Must match the declarations in release/include/Jit.hpp
+typedef void (*JitCompileCallback)(TR::MethodBuilder *m, uint8_t *entry, int32_t rc, void *userData);
+
+struct JitCompileTimes
+   {
+   uint64_t count;
+   uint64_t p50Micros;
+   uint64_t p90Micros;
+   uint64_t p99Micros;
+   uint64_t maximumMicros;
+   };
+
+namespace JitBuilder
+{
+
+// Distribution of times in microseconds, counted in SUB_BUCKETS logarithmic
+// buckets per power of two so that recording is constant time and space and a
+// percentile is rounded up by less than 1/SUB_BUCKETS.
+// Not synchronized: callers must hold the lock of the owning CompilationQueue.
+class CompileTimeHistogram
+   {
+public:
+   enum
+      {
+      SUB_BUCKETS = 16,
+      MAXIMUM_SHIFT = 36,
+      BUCKET_COUNT = SUB_BUCKETS * (MAXIMUM_SHIFT + 2)
+      };
+
+   CompileTimeHistogram() { clear(); }
+
+   void clear();
+   void add(uint64_t micros);
+   uint64_t getPercentile(double percentile) const;
+   uint64_t getCount() const   { return _count; }
+   uint64_t getMaximum() const { return _maximum; }
+   void getTimes(JitCompileTimes *times) const;
+
+private:
+   static uint32_t getBucketIndex(uint64_t micros);
+   static uint64_t getBucketLimit(uint32_t index);
+
+   uint64_t _buckets[BUCKET_COUNT];
+   uint64_t _count;
+   uint64_t _maximum;
+   };
+
+struct CompileCallbackRecord
+   {
+   TR_PERSISTENT_ALLOC(TR_Memory::CompilationInfo)
+
+   JitCompileCallback     _callback;
+   void                 * _userData;
+   CompileCallbackRecord *_next;
+   };
+
+// A request to compile a MethodBuilder, shared by every caller that asked for
+// the same MethodBuilder while it was queued or being compiled. It is handed
+// out as a future: wait() blocks until _entry and _rc are set.
+class CompileRequest
+   {
+   TR_PERSISTENT_ALLOC(TR_Memory::CompilationInfo)
+
+   friend class CompilationQueue;
+
+   TR::MethodBuilder     *_method;
+   int32_t                _priority;
+   uint64_t               _sequence;     // orders requests of equal priority
+   uint64_t               _enqueueTime;  // microseconds
+   CompileCallbackRecord *_callbacks;
+   int32_t                _references;   // callers holding the request, plus one while it is pending
+   bool                   _done;
+   int32_t                _rc;
+   uint8_t               *_entry;
+   CompileRequest        *_next;         // in the queue or the in progress list
+   };
+
+// Compiles MethodBuilders on a pool of compilation threads, highest priority
+// first and in arrival order within a priority. A request for a MethodBuilder
+// that is already queued or being compiled joins the pending request (raising
+// its priority if needed) rather than compiling it twice.
+//
+// Each compilation gets its own segment provider, region and TR_Memory from
+// compileMethodFromDetails, so compilation threads share only the persistent
+// allocator and the code cache manager, which are both thread safe.
+class CompilationQueue
+   {
+public:
+   static CompilationQueue *instance() { return &_instance; }
+
+   // Start numThreads compilation threads. Fails if threads are already running.
+   bool startThreads(int32_t numThreads);
+
+   // Stop the compilation threads, after they finish the compilations in
+   // progress. Queued requests complete with COMPILATION_INTERRUPTED.
+   void shutdown();
+
+   // Queue m for compilation, starting a single compilation thread if none
+   // are running. callback (if not NULL) is called on the compilation thread
+   // once the compilation completes. The returned request must be passed to
+   // release() when the caller no longer needs it.
+   CompileRequest *enqueue(TR::MethodBuilder *m, int32_t priority, JitCompileCallback callback, void *userData);
+
+   // Block until request completes; return its return code and entry point
+   int32_t wait(CompileRequest *request, uint8_t **entry);
+
+   // Return true, and the return code and entry point, if request has completed
+   bool poll(CompileRequest *request, int32_t *rc, uint8_t **entry);
+
+   void release(CompileRequest *request);
+
+   void getTimes(JitCompileTimes *queueWait, JitCompileTimes *compileTime);
+   void printStatistics();
+
+private:
+   CompilationQueue();
+
+   static void *compilationThread(void *queue);
+   void run();
+   void compile(CompileRequest *request);
+   void complete(CompileRequest *request, int32_t rc, uint8_t *entry);
+   void insert(CompileRequest *request);
+   bool unlink(CompileRequest **list, CompileRequest *request);
+   CompileRequest *findPending(TR::MethodBuilder *m);
+   bool startThreadsLocked(int32_t numThreads);
+   void releaseLocked(CompileRequest *request);
+
+   static CompilationQueue _instance;
+
+   pthread_mutex_t      _mutex;
+   pthread_cond_t       _workAvailable;
+   pthread_cond_t       _requestCompleted;
+   pthread_t           *_threads;
+   int32_t              _numThreads;
+   bool                 _shuttingDown;
+   CompileRequest      *_queue;          // sorted by decreasing priority, then sequence
+   CompileRequest      *_inProgress;
+   uint64_t             _sequence;
+
+   uint64_t             _numRequests;
+   uint64_t             _numDuplicates;
+   uint64_t             _numFailures;
+   CompileTimeHistogram _queueWaitTimes;
+   CompileTimeHistogram _compileTimes;
+   };
+
+} // namespace JitBuilder
+
+#endif // !defined(JITBUILDER_COMPILATIONQUEUE_HPP)
@@ -20,11 +20,13 @@
 #include "codegen/CodeGenerator.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/Method.hpp"
+#include "control/CompilationQueue.hpp"
 #include "control/CompileMethod.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/FrontEnd.hpp"
 #include "env/IO.hpp"
 #include "env/RawAllocator.hpp"
+#include "env/VerboseLog.hpp"
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "runtime/CodeCache.hpp"
@@ -163,6 +165,12 @@ initializeJitBuilder(TR_RuntimeHelper *helperIDs, void **helperAddresses, int32_
 //     compileMethodBuilder() as many times as needed to create compiled code
 //     shuwdownJit() when the test is complete
 //
+// To compile in the background instead of on the calling thread:
+//     startCompilationThreads() to choose how many compilation threads to use (default 1)
+//     compileMethodBuilderAsync() to queue a compilation, which returns a request to pass to
+//        waitForCompilation() or pollCompilation(), and then releaseCompilation()
+//     getCompilationTimes() or printCompilationStatistics() to see queue wait and compile times
+//
 
 
 
@@ -193,12 +201,68 @@ compileMethodBuilder(TR::MethodBuilder *m, uint8_t **entry)
    return rc;
    }
 
+extern "C"
+bool
+startCompilationThreads(int32_t numThreads)
+   {
+   return JitBuilder::CompilationQueue::instance()->startThreads(numThreads);
+   }
+
+extern "C"
+JitBuilder::CompileRequest *
+compileMethodBuilderAsync(TR::MethodBuilder *m, int32_t priority, JitCompileCallback callback, void *userData)
+   {
+   return JitBuilder::CompilationQueue::instance()->enqueue(m, priority, callback, userData);
+   }
+
+extern "C"
+int32_t
+waitForCompilation(JitBuilder::CompileRequest *request, uint8_t **entry)
+   {
+   return JitBuilder::CompilationQueue::instance()->wait(request, entry);
+   }
+
+extern "C"
+bool
+pollCompilation(JitBuilder::CompileRequest *request, int32_t *rc, uint8_t **entry)
+   {
+   return JitBuilder::CompilationQueue::instance()->poll(request, rc, entry);
+   }
+
+extern "C"
+void
+releaseCompilation(JitBuilder::CompileRequest *request)
+   {
+   JitBuilder::CompilationQueue::instance()->release(request);
+   }
+
+extern "C"
+void
+getCompilationTimes(JitCompileTimes *queueWait, JitCompileTimes *compileTime)
+   {
+   JitBuilder::CompilationQueue::instance()->getTimes(queueWait, compileTime);
+   }
+
+extern "C"
+void
+printCompilationStatistics()
+   {
+   JitBuilder::CompilationQueue::instance()->printStatistics();
+   }
+
 extern "C"
 void
 shutdownJit()
    {
+   JitBuilder::CompilationQueue::instance()->shutdown();
+   releaseScratchSegmentPool();
+   TR::Compiler->persistentAllocator().releaseThreadCache();
+
    auto fe = JitBuilder::FrontEnd::instance();
 
+   if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseJitMemory))
+      fe->persistentMemory()->printMemoryUsage();
+
    TR::CodeCacheManager &codeCacheManager = fe->codeCacheManager();
    codeCacheManager.destroy();
    }
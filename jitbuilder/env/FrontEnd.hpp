@@ -70,6 +70,9 @@ class FrontEnd : public TR::FEBase<FrontEnd>
       //return (uint8_t *)((PyCodeObject *)method)->co_compiledCodeEntry;
       }
 
+   // Local arrays created by JitBuilder methods have no class
+   virtual TR_OpaqueClassBlock *getClassFromNewArrayType(int32_t arrayType) { return NULL; }
+
   TR_ResolvedMethod * createResolvedMethod(TR_Memory * trMemory, TR_OpaqueMethodBlock * aMethod,
                                             TR_ResolvedMethod * owningMethod, TR_OpaqueClassBlock *classForNewInstance);
 
@@ -148,6 +148,61 @@ static const OptimizationStrategy JBwarmStrategyOpts[] =
    };
 
 
+// The warm strategy plus the loop optimizations needed to vectorize loops,
+// used with enableAutoSIMD since they add to the compile time of every method
+// with loops
+//
+static const OptimizationStrategy JBvectorizationStrategyOpts[] =
+   {
+   { OMR::trivialDeadTreeRemoval,                    OMR::IfEnabled                },
+   { OMR::treeSimplification                                                       },
+   { OMR::lastLoopVersionerGroup,                    OMR::IfLoops                  },
+   { OMR::globalDeadStoreElimination,                OMR::IfEnabledAndLoops        },
+   { OMR::deadTreesElimination                                                     },
+   { OMR::basicBlockOrdering,                        OMR::IfLoops                  },
+   { OMR::treeSimplification                                                       },
+   { OMR::blockSplitter                                                            },
+   { OMR::treeSimplification                                                       },
+   { OMR::globalValuePropagation,                    OMR::IfLoops                  }, // constant increments for induction variable analysis
+   { OMR::basicBlockExtension,                       OMR::MarkLastRun              }, // extend blocks; move trees around if reqd
+   { OMR::treeSimplification                                                       }, // revisit; not really required ?
+   { OMR::treeSimplification,                        OMR::IfEnabled                },
+   { OMR::localDeadStoreElimination                                                }, // after latest copy propagation
+   { OMR::deadTreesElimination                                                     }, // remove dead anchors created by check/store removal
+   { OMR::treeSimplification,                        OMR::IfEnabled                },
+   { OMR::localCSE                                                                 },
+   { OMR::treeSimplification,                        OMR::MarkLastRun              },
+   { OMR::inductionVariableAnalysis,                 OMR::IfLoops                  },
+   { OMR::SPMDKernelParallelization,                 OMR::IfLoops                  }, // vectorize unit stride loops
+   { OMR::generalLoopUnroller,                       OMR::IfLoops                  },
+#ifdef TR_HOST_S390
+   { OMR::longRegAllocation                                                        },
+#endif
+   { OMR::andSimplification,                         OMR::IfEnabled                },  //clean up after versioner
+   { OMR::deadTreesElimination,                      OMR::IfEnabled                }, // cleanup at the end
+   { OMR::generalStoreSinking                                                      },
+   { OMR::treesCleansing,                            OMR::IfEnabled                },
+   { OMR::deadTreesElimination,                      OMR::IfEnabled                }, // cleanup at the end
+   { OMR::localCSE,                                  OMR::IfEnabled                }, // common up expressions for sunk stores
+   { OMR::treeSimplification,                        OMR::IfEnabledMarkLastRun     }, // cleanup the trees after sunk store and localCSE
+   { OMR::trivialBlockExtension                                                    },
+   { OMR::localDeadStoreElimination,                 OMR::IfEnabled                }, //remove the astore if no literal pool is required
+   { OMR::localCSE,                                  OMR::IfEnabled                },  //common up lit pool refs in the same block
+   { OMR::deadTreesElimination,                      OMR::IfEnabled                }, // cleanup at the end
+   { OMR::treeSimplification,                        OMR::IfEnabledMarkLastRun     }, // Simplify non-normalized address computations introduced by prefetch insertion
+   { OMR::trivialDeadTreeRemoval,                    OMR::IfEnabled                }, // final cleanup before opcode expansion
+   { OMR::cheapTacticalGlobalRegisterAllocatorGroup, OMR::IfEnabled                },
+   { OMR::globalDeadStoreGroup,                                                    },
+   { OMR::rematerialization                                                        },
+   { OMR::deadTreesElimination,                      OMR::IfEnabled                }, // remove dead anchors created by check/store removal
+   { OMR::deadTreesElimination,                      OMR::IfEnabled                }, // remove dead RegStores produced by previous deadTrees pass
+   //{ OMR::compactLocals                                                            },
+   { OMR::regDepCopyRemoval                                                        },
+
+   { OMR::endOpts                                                                  },
+   };
+
+
 namespace JitBuilder
 {
 
@@ -215,13 +270,15 @@ Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *methodSymb
 
    // force warm strategy for now
    if (!isIlGen)
-      self()->setStrategy(JBwarmStrategyOpts);
+      self()->setStrategy(optimizationStrategy(comp));
    }
 
 const OptimizationStrategy *
 Optimizer::optimizationStrategy(TR::Compilation *c)
    {
    // force warm strategy for now
+   if (c->getOption(TR_EnableAutoSIMD))
+      return JBvectorizationStrategyOpts;
    return JBwarmStrategyOpts;
    }
 
@@ -19,8 +19,34 @@
 #include <stdint.h>
 
 namespace TR { class MethodBuilder; }
+namespace JitBuilder { class CompileRequest; }
 class TR_Memory;
 
+// Called on a compilation thread when an asynchronous compilation completes
+typedef void (*JitCompileCallback)(TR::MethodBuilder *m, uint8_t *entry, int32_t rc, void *userData);
+
+// Distribution of queue wait or compile times, in microseconds
+struct JitCompileTimes
+   {
+   uint64_t count;
+   uint64_t p50Micros;
+   uint64_t p90Micros;
+   uint64_t p99Micros;
+   uint64_t maximumMicros;
+   };
+
 extern "C" bool initializeJit();
+extern "C" bool initializeJitWithOptions(char *options);
 extern "C" uint32_t compileMethodBuilder(TR::MethodBuilder *m, uint8_t **entry);
 extern "C" void shutdownJit();
+
+// Asynchronous compilation: requests are compiled on a pool of compilation threads,
+// highest priority first. Requests for a MethodBuilder that is already queued or being
+// compiled share that compilation. Each request returned must be released.
+extern "C" bool startCompilationThreads(int32_t numThreads);
+extern "C" JitBuilder::CompileRequest *compileMethodBuilderAsync(TR::MethodBuilder *m, int32_t priority, JitCompileCallback callback, void *userData);
+extern "C" int32_t waitForCompilation(JitBuilder::CompileRequest *request, uint8_t **entry);
+extern "C" bool pollCompilation(JitBuilder::CompileRequest *request, int32_t *rc, uint8_t **entry);
+extern "C" void releaseCompilation(JitBuilder::CompileRequest *request);
+extern "C" void getCompilationTimes(JitCompileTimes *queueWait, JitCompileTimes *compileTime);
+extern "C" void printCompilationStatistics();
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016, 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ ******************************************************************************/
+
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "Jit.hpp"
+#include "ilgen/TypeDictionary.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "AsyncCompile.hpp"
+
+using std::cout;
+using std::cerr;
+
+#define NUM_METHODS 16
+#define NUM_COMPILATION_THREADS 4
+
+static volatile int32_t completedCompilations = 0;
+
+// Runs on a compilation thread
+static void
+compilationComplete(TR::MethodBuilder *m, uint8_t *entry, int32_t rc, void *userData)
+   {
+   __sync_fetch_and_add(&completedCompilations, 1);
+   }
+
+int
+main(int argc, char *argv[])
+   {
+   cout << "Step 1: initialize JIT\n";
+   bool initialized = initializeJit();
+   if (!initialized)
+      {
+      cerr << "FAIL: could not initialize JIT\n";
+      exit(-1);
+      }
+
+   cout << "Step 2: start " << NUM_COMPILATION_THREADS << " compilation threads\n";
+   if (!startCompilationThreads(NUM_COMPILATION_THREADS))
+      {
+      cerr << "FAIL: could not start compilation threads\n";
+      exit(-1);
+      }
+
+   cout << "Step 3: define type dictionary\n";
+   TR::TypeDictionary types;
+
+   cout << "Step 4: queue " << NUM_METHODS << " method builders, later ones at higher priority\n";
+   AddConstantMethod *methods[NUM_METHODS];
+   JitBuilder::CompileRequest *requests[NUM_METHODS];
+   for (int32_t i = 0; i < NUM_METHODS; i++)
+      {
+      methods[i] = new AddConstantMethod(&types, i);
+      requests[i] = compileMethodBuilderAsync(methods[i], i, compilationComplete, NULL);
+      if (!requests[i])
+         {
+         cerr << "FAIL: could not queue compilation " << i << "\n";
+         exit(-2);
+         }
+      }
+
+   // Asking again for a method that is still pending shares its compilation
+   JitBuilder::CompileRequest *duplicate = compileMethodBuilderAsync(methods[0], NUM_METHODS, NULL, NULL);
+
+   cout << "Step 5: wait for compilations and invoke compiled code\n";
+   typedef int32_t (AddConstantFunction)(int32_t);
+   for (int32_t i = 0; i < NUM_METHODS; i++)
+      {
+      uint8_t *entry = 0;
+      int32_t rc = waitForCompilation(requests[i], &entry);
+      if (rc != 0)
+         {
+         cerr << "FAIL: compilation error " << rc << "\n";
+         exit(-2);
+         }
+      AddConstantFunction *add = (AddConstantFunction *)entry;
+      cout << "add" << i << "(100) == " << add(100) << "\n";
+      if (add(100) != 100 + i)
+         {
+         cerr << "FAIL: wrong result\n";
+         exit(-3);
+         }
+      releaseCompilation(requests[i]);
+      }
+
+   uint8_t *duplicateEntry = 0;
+   int32_t rc = waitForCompilation(duplicate, &duplicateEntry);
+   if (rc != 0 || duplicateEntry == 0)
+      {
+      cerr << "FAIL: duplicate request failed " << rc << "\n";
+      exit(-4);
+      }
+   releaseCompilation(duplicate);
+
+   cout << "Step 6: print compilation statistics\n";
+   printCompilationStatistics();
+
+   cout << "Step 7: shutdown JIT\n";
+   shutdownJit();
+
+   if (completedCompilations != NUM_METHODS)
+      {
+      cerr << "FAIL: " << completedCompilations << " callbacks for " << NUM_METHODS << " compilations\n";
+      exit(-5);
+      }
+   cout << "PASS\n";
+   }
+
+
+
+AddConstantMethod::AddConstantMethod(TR::TypeDictionary *d, int32_t constant)
+   : MethodBuilder(d),
+   _constant(constant)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+
+   snprintf(_name, sizeof(_name), "add%d", constant);
+   DefineName(_name);
+   DefineParameter("value", Int32);
+   DefineReturnType(Int32);
+   }
+
+bool
+AddConstantMethod::buildIL()
+   {
+   Return(
+      Add(
+         Load("value"),
+         ConstInt32(_constant)));
+
+   return true;
+   }
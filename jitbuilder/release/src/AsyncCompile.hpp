@@ -0,0 +1,35 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016, 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ ******************************************************************************/
+
+#ifndef ASYNCCOMPILE_INCL
+#define ASYNCCOMPILE_INCL
+
+#include "ilgen/MethodBuilder.hpp"
+
+class AddConstantMethod : public TR::MethodBuilder
+   {
+   public:
+   AddConstantMethod(TR::TypeDictionary *, int32_t constant);
+   virtual bool buildIL();
+
+   private:
+   int32_t _constant;
+   char _name[32];
+   };
+
+#endif // !defined(ASYNCCOMPILE_INCL)
@@ -22,37 +22,13 @@
 #include <stdint.h>
 #include <dlfcn.h>
 #include <errno.h>
+#include <time.h>
 
 #include "Jit.hpp"
 #include "ilgen/TypeDictionary.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "DotProduct.hpp"
 
-static void printString(int64_t ptr)
-   {
-   #define PRINTSTRING_LINE LINETOSTR(__LINE__)
-   char *str = (char *) ptr;
-   printf("%s", str);
-   }
-
-static void printInt32(int32_t val)
-   {
-   #define PRINTINT32_LINE LINETOSTR(__LINE__)
-   printf("%d", val);
-   }
-
-static void printDouble(double val)
-   {
-   #define PRINTDOUBLE_LINE LINETOSTR(__LINE__)
-   printf("%lf", val);
-   }
-
-static void printPointer(int64_t val)
-   {
-   #define PRINTPOINTER_LINE LINETOSTR(__LINE__)
-   printf("%lx", val);
-   }
-
 DotProduct::DotProduct(TR::TypeDictionary *types)
    : MethodBuilder(types)
 
@@ -70,64 +46,11 @@ DotProduct::DotProduct(TR::TypeDictionary *types)
    DefineParameter("length", Int32);
 
    DefineReturnType(NoType);
-
-   DefineFunction((char *)"printString", 
-                  (char *)__FILE__,
-                  (char *)PRINTSTRING_LINE,
-                  (void *)&printString,
-                  NoType,
-                  1,
-                  Int64);
-   DefineFunction((char *)"printInt32", 
-                  (char *)__FILE__,
-                  (char *)PRINTINT32_LINE,
-                  (void *)&printInt32,
-                  NoType,
-                  1,
-                  Int32);
-   DefineFunction((char *)"printDouble", 
-                  (char *)__FILE__,
-                  (char *)PRINTDOUBLE_LINE,
-                  (void *)&printDouble,
-                  NoType,
-                  1,
-                  Double);
-   DefineFunction((char *)"printPointer", 
-                  (char *)__FILE__,
-                  (char *)PRINTPOINTER_LINE,
-                  (void *)&printPointer,
-                  NoType,
-                  1,
-                  Int64);
-   }
-
-void
-DotProduct::PrintString(TR::IlBuilder *bldr, const char *s)
-   {
-   bldr->Call("printString", 1,
-   bldr->   ConstInt64((int64_t)(char *)s));
    }
 
 bool
 DotProduct::buildIL()
    {
-   PrintString(this, "dotproduct parameters:\n");
-
-   PrintString(this, "   result is ");
-   Call("printPointer", 1,
-      Load("result"));
-   PrintString(this, "\n");
-
-   PrintString(this, "   vector1 is ");
-   Call("printPointer", 1,
-      Load("vector1"));
-   PrintString(this, "\n");
-
-   PrintString(this, "   vector2 is ");
-   Call("printPointer", 1,
-      Load("vector2"));
-   PrintString(this, "\n");
-
    TR::IlBuilder *loop = NULL;
    ForLoopUp("i", &loop,
       ConstInt32(0),
@@ -154,11 +77,19 @@ DotProduct::buildIL()
    }
 
 
+static double
+currentSeconds()
+   {
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+   }
+
 int
 main(int argc, char *argv[])
    {
    printf("Step 1: initialize JIT\n");
-   bool initialized = initializeJit();
+   bool initialized = initializeJitWithOptions((char *)"-Xjit:enableAutoSIMD");
    if (!initialized)
       {
       fprintf(stderr, "FAIL: could not initialize JIT\n");
@@ -192,7 +123,38 @@ main(int argc, char *argv[])
       printf("           %lf\n", result[i]);
    printf("         ]\n\n");
 
-   printf ("Step 6: shutdown JIT\n");
+   // the loop is vectorized because the JIT is initialized with enableAutoSIMD;
+   //    run with TR_Options=disableAutoSIMD for the scalar timing
+   printf("Step 6: benchmark compiled code\n");
+   const int32_t length=4096;
+   const int32_t iterations=50000;
+   double *bigResult = (double *) malloc(3 * length * sizeof(double));
+   double *bigValues1 = bigResult + length;
+   double *bigValues2 = bigValues1 + length;
+   for (int32_t i=0;i < length;i++)
+      {
+      bigValues1[i] = (double)i + 0.5;
+      bigValues2[i] = (double)(length - i) + 0.5;
+      }
+
+   double start = currentSeconds();
+   for (int32_t it=0;it < iterations;it++)
+      test(bigResult, bigValues1, bigValues2, length);
+   double elapsed = currentSeconds() - start;
+   printf("   %d calls of length %d: %lf ns per element\n",
+          iterations, length, elapsed * 1e9 / ((double)iterations * length));
+
+   for (int32_t i=0;i < length;i++)
+      {
+      if (bigResult[i] != bigValues1[i] * bigValues2[i])
+         {
+         fprintf(stderr, "FAIL: wrong result at index %d\n", i);
+         exit(-3);
+         }
+      }
+   free(bigResult);
+
+   printf ("Step 7: shutdown JIT\n");
    shutdownJit();
 
    printf("PASS\n");
@@ -27,8 +27,6 @@ typedef void (DotProductFunctionType)(double *, double *, double *, int32_t);
 class DotProduct : public TR::MethodBuilder
    {
    private:
-
-   void PrintString (TR::IlBuilder *bldr, const char *s);
    TR::IlType *pDouble;
 
    public:
@@ -22,6 +22,8 @@
 #include <stdint.h>
 #include <dlfcn.h>
 #include <errno.h>
+#include <string.h>
+#include <time.h>
 
 #include "Jit.hpp"
 #include "ilgen/TypeDictionary.hpp"
@@ -46,8 +48,6 @@ MatMult::MatMult(TR::TypeDictionary *types)
    DefineParameter("N", Int32);
 
    DefineReturnType(NoType);
-
-   DefineLocal("sum", Double);
    }
 
 
@@ -97,7 +97,7 @@ MatMult::buildIL()
    AllLocalsHaveBeenDefined();
 
    TR::IlValue *i, *j, *k;
-   TR::IlValue *A_ik, *B_kj;
+   TR::IlValue *A_ik, *B_kj, *C_ij;
 
    TR::IlValue *A = Load("A");
    TR::IlValue *B = Load("B");
@@ -106,31 +106,35 @@ MatMult::buildIL()
    TR::IlValue *zero = ConstInt32(0);
    TR::IlValue *one = ConstInt32(1);
 
-   TR::IlBuilder *iloop=NULL, *jloop=NULL, *kloop=NULL;
+   // loops are ordered i, k, j so that the innermost loop walks rows of B
+   //    and C with unit stride, which lets the optimizer vectorize it
+   TR::IlBuilder *iloop=NULL, *zloop=NULL, *kloop=NULL, *jloop=NULL;
    ForLoopUp("i", &iloop, zero, N, one);
       {
       i = iloop->Load("i");
 
-      iloop->ForLoopUp("j", &jloop, zero, N, one);
+      iloop->ForLoopUp("j", &zloop, zero, N, one);
          {
-         j = jloop->Load("j");
+         j = zloop->Load("j");
+         Store2D(zloop, C, i, j, N, zloop->ConstDouble(0.0));
+         }
 
-         jloop->Store("sum",
-         jloop->   ConstDouble(0.0));
+      iloop->ForLoopUp("k", &kloop, zero, N, one);
+         {
+         k = kloop->Load("k");
 
-         jloop->ForLoopUp("k", &kloop, zero, N, one);
+         A_ik = Load2D(kloop, A, i, k, N);                    // A[i,k] is invariant over j
+
+         kloop->ForLoopUp("j", &jloop, zero, N, one);
             {
-            k = kloop->Load("k");
+            j = jloop->Load("j");
 
-            A_ik = Load2D(kloop, A, i, k, N);
-            B_kj = Load2D(kloop, B, k, j, N);
-            kloop->Store("sum",
-            kloop->   Add(
-            kloop->      Load("sum"),
-            kloop->      Mul(A_ik, B_kj)));
+            B_kj = Load2D(jloop, B, k, j, N);
+            C_ij = Load2D(jloop, C, i, j, N);
+            Store2D(jloop, C, i, j, N,
+            jloop->   Add(C_ij,
+            jloop->      Mul(A_ik, B_kj)));
             }
-
-         Store2D(jloop, C, i, j, N, jloop->Load("sum"));
          }
       }
 
@@ -270,6 +274,23 @@ VectorMatMult::buildIL()
    }
 
 
+static double
+currentSeconds()
+   {
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+   }
+
+static double
+timeMatMult(MatMultFunctionType *function, double *C, double *A, double *B, int32_t N, int32_t iterations)
+   {
+   double start = currentSeconds();
+   for (int32_t it=0;it < iterations;it++)
+      function(C, A, B, N);
+   return (currentSeconds() - start) / iterations;
+   }
+
 void
 printMatrix(double *M, int32_t N, const char *name)
    {
@@ -288,7 +309,7 @@ int
 main(int argc, char *argv[])
    {
    printf("Step 1: initialize JIT\n");
-   bool initialized = initializeJit();
+   bool initialized = initializeJitWithOptions((char *)"-Xjit:enableAutoSIMD");
    if (!initialized)
       {
       fprintf(stderr, "FAIL: could not initialize JIT\n");
@@ -342,12 +363,40 @@ main(int argc, char *argv[])
       exit(-2);
       }
 
-   printf("Step 7: invoke MatMult compiled code\n");
+   printf("Step 7: invoke VectorMatMult compiled code\n");
    MatMultFunctionType *vectest = (MatMultFunctionType *)vecentry;
    vectest(D, A, B, N);
    printMatrix(D, N, "D");
 
-   printf ("Step 8: shutdown JIT\n");
+   // MatMult's inner loop is vectorized because the JIT is initialized with
+   //    enableAutoSIMD; run with TR_Options=disableAutoSIMD for the scalar timing
+   printf("Step 8: benchmark compiled code\n");
+   const int32_t benchN=256;
+   const int32_t iterations=10;
+   double *bigA = (double *) malloc(4 * benchN * benchN * sizeof(double));
+   double *bigB = bigA + benchN * benchN;
+   double *bigC = bigB + benchN * benchN;
+   double *bigD = bigC + benchN * benchN;
+   for (int32_t i=0;i < benchN * benchN;i++)
+      {
+      bigA[i] = (double)(i % 7);
+      bigB[i] = (double)(i % 5) - 2.0;
+      }
+
+   double matmultTime = timeMatMult(test, bigC, bigA, bigB, benchN, iterations);
+   double vecmatmultTime = timeMatMult(vectest, bigD, bigA, bigB, benchN, iterations);
+   printf("   %d x %d matrices: matmult %lf ms, vecmatmult %lf ms\n",
+          benchN, benchN, matmultTime * 1000.0, vecmatmultTime * 1000.0);
+
+   bool matched = (memcmp(bigC, bigD, benchN * benchN * sizeof(double)) == 0);
+   free(bigA);
+   if (!matched)
+      {
+      fprintf(stderr, "FAIL: matmult and vecmatmult results differ\n");
+      exit(-3);
+      }
+
+   printf ("Step 9: shutdown JIT\n");
    shutdownJit();
 
    printf("PASS\n");
@@ -0,0 +1,296 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "VerboseGCLogAnalyzer.hpp"
+
+/* Growth below this many milliseconds is not reported as a regression */
+static const double REGRESSION_MINIMUM_MS = 0.1;
+
+const char * const VerboseGCLogAnalyzer::_phaseNames[PHASE_COUNT] = {
+	"mark",
+	"sweep",
+	"compact",
+	"scavenge",
+	"expand",
+	"contract",
+	"global gc"
+};
+
+VerboseGCPhaseHistogram::VerboseGCPhaseHistogram()
+	: _histogram()
+	, _totalMs(0.0)
+{
+}
+
+void
+VerboseGCPhaseHistogram::add(double timeMs)
+{
+	uint64_t timeUs = (timeMs <= 0.0) ? 0 : (uint64_t)((timeMs * 1000.0) + 0.5);
+	_histogram.addPause(timeUs);
+	_totalMs += timeMs;
+}
+
+VerboseGCLogAnalyzer::VerboseGCLogAnalyzer(OMRPortLibrary *portLibrary)
+	: _portLibrary(portLibrary)
+	, _totalMarkBytes(0.0)
+	, _inMarkOp(false)
+	, _scanState(SCAN_TEXT)
+	, _inQuotes(false)
+	, _tagOverflow(false)
+	, _tagLength(0)
+{
+}
+
+bool
+VerboseGCLogAnalyzer::analyze(const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		omrtty_printf("Error opening file : %s\n", fileName);
+		return false;
+	}
+
+	char *buffer = (char *)omrmem_allocate_memory(READ_BUFFER_SIZE, OMRMEM_CATEGORY_MM);
+	if (NULL == buffer) {
+		omrtty_printf("Failed to allocate the read buffer for : %s\n", fileName);
+		omrfile_close(fd);
+		return false;
+	}
+
+	_scanState = SCAN_TEXT;
+	_inMarkOp = false;
+
+	intptr_t bytesRead = 0;
+	while (0 < (bytesRead = omrfile_read(fd, buffer, READ_BUFFER_SIZE))) {
+		scan(buffer, (uintptr_t)bytesRead);
+	}
+
+	omrmem_free_memory(buffer);
+	omrfile_close(fd);
+	return true;
+}
+
+void
+VerboseGCLogAnalyzer::scan(const char *buffer, uintptr_t length)
+{
+	for (uintptr_t i = 0; i < length; i++) {
+		char c = buffer[i];
+		switch (_scanState) {
+		case SCAN_TEXT:
+			if ('<' == c) {
+				_scanState = SCAN_TAG;
+				_inQuotes = false;
+				_tagOverflow = false;
+				_tagLength = 0;
+			}
+			break;
+		case SCAN_TAG:
+			if (('>' == c) && !_inQuotes) {
+				_tag[_tagLength] = '\0';
+				if (!_tagOverflow) {
+					handleTag();
+				}
+				_scanState = SCAN_TEXT;
+				break;
+			}
+			if ('"' == c) {
+				_inQuotes = !_inQuotes;
+			}
+			if (_tagLength < (TAG_BUFFER_SIZE - 1)) {
+				_tag[_tagLength++] = c;
+				if ((3 == _tagLength) && (0 == strncmp(_tag, "!--", 3))) {
+					/* Comments may contain quotes and '>', so they are skipped up to "-->" */
+					_scanState = SCAN_COMMENT;
+					_tagLength = 0;
+				}
+			} else {
+				_tagOverflow = true;
+			}
+			break;
+		case SCAN_COMMENT:
+			if (('>' == c) && (2 <= _tagLength)) {
+				_scanState = SCAN_TEXT;
+			} else if ('-' == c) {
+				_tagLength += 1;
+			} else {
+				_tagLength = 0;
+			}
+			break;
+		}
+	}
+}
+
+void
+VerboseGCLogAnalyzer::handleTag()
+{
+	const char *tag = _tag;
+	if (('?' == tag[0]) || ('!' == tag[0])) {
+		return;
+	}
+	if ('/' == tag[0]) {
+		if (0 == strncmp(tag + 1, "gc-op", 5)) {
+			_inMarkOp = false;
+		}
+		return;
+	}
+
+	uintptr_t nameLength = strcspn(tag, " \t\r\n/");
+	bool isEmptyElement = (0 < _tagLength) && ('/' == tag[_tagLength - 1]);
+	handleStartTag(tag, nameLength, isEmptyElement);
+}
+
+void
+VerboseGCLogAnalyzer::handleStartTag(const char *name, uintptr_t nameLength, bool isEmptyElement)
+{
+	char type[ATTRIBUTE_BUFFER_SIZE];
+	double timeMs = 0.0;
+
+	if ((5 == nameLength) && (0 == strncmp(name, "gc-op", 5))) {
+		if (getAttribute("type", type) && getTimeAttribute("timems", &timeMs)) {
+			if (0 == strcmp(type, "mark")) {
+				_phases[PHASE_MARK].add(timeMs);
+				_inMarkOp = !isEmptyElement;
+			} else if (0 == strcmp(type, "sweep")) {
+				_phases[PHASE_SWEEP].add(timeMs);
+			} else if (0 == strcmp(type, "compact")) {
+				_phases[PHASE_COMPACT].add(timeMs);
+			} else if (0 == strcmp(type, "scavenge")) {
+				_phases[PHASE_SCAVENGE].add(timeMs);
+			}
+		}
+	} else if ((10 == nameLength) && (0 == strncmp(name, "trace-info", 10))) {
+		char scanBytes[ATTRIBUTE_BUFFER_SIZE];
+		if (_inMarkOp && getAttribute("scanbytes", scanBytes)) {
+			_totalMarkBytes += strtod(scanBytes, NULL);
+		}
+	} else if ((11 == nameLength) && (0 == strncmp(name, "heap-resize", 11))) {
+		if (getAttribute("type", type) && getTimeAttribute("timems", &timeMs)) {
+			if (0 == strcmp(type, "expand")) {
+				_phases[PHASE_EXPAND].add(timeMs);
+			} else if (0 == strcmp(type, "contract")) {
+				_phases[PHASE_CONTRACT].add(timeMs);
+			}
+		}
+	} else if ((6 == nameLength) && (0 == strncmp(name, "gc-end", 6))) {
+		if (getAttribute("type", type) && (0 == strcmp(type, "global")) && getTimeAttribute("durationms", &timeMs)) {
+			_phases[PHASE_GLOBAL_GC].add(timeMs);
+		}
+	}
+}
+
+bool
+VerboseGCLogAnalyzer::getAttribute(const char *name, char *value) const
+{
+	uintptr_t nameLength = strlen(name);
+	const char *cursor = _tag;
+	while (NULL != (cursor = strstr(cursor, name))) {
+		/* Match whole attribute names only, e.g. "timems" must not match "usertimems" */
+		bool startsName = (cursor > _tag) && ((' ' == cursor[-1]) || ('\t' == cursor[-1]) || ('\r' == cursor[-1]) || ('\n' == cursor[-1]));
+		if (startsName && ('=' == cursor[nameLength]) && ('"' == cursor[nameLength + 1])) {
+			const char *start = cursor + nameLength + 2;
+			const char *end = strchr(start, '"');
+			if (NULL == end) {
+				return false;
+			}
+			uintptr_t length = OMR_MIN((uintptr_t)(end - start), (uintptr_t)(ATTRIBUTE_BUFFER_SIZE - 1));
+			memcpy(value, start, length);
+			value[length] = '\0';
+			return true;
+		}
+		cursor += nameLength;
+	}
+	return false;
+}
+
+bool
+VerboseGCLogAnalyzer::getTimeAttribute(const char *name, double *timeMs) const
+{
+	char value[ATTRIBUTE_BUFFER_SIZE];
+	if (!getAttribute(name, value)) {
+		return false;
+	}
+	*timeMs = strtod(value, NULL);
+	return true;
+}
+
+void
+VerboseGCLogAnalyzer::report() const
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	omrtty_printf("Phase              Count         p50 (ms)         p99 (ms)         Max (ms)\n");
+	omrtty_printf("---------------------------------------------------------------------------\n");
+	for (uintptr_t i = 0; i < PHASE_COUNT; i++) {
+		const VerboseGCPhaseHistogram *phase = &_phases[i];
+		omrtty_printf("%-12s %11llu %16.3f %16.3f %16.3f\n",
+			_phaseNames[i], (unsigned long long)phase->getCount(), phase->getPercentile(50.0), phase->getPercentile(99.0), phase->getMaximum());
+	}
+
+	double totalMarkTime = _phases[PHASE_MARK].getTotal();
+	double markThroughput = (0 < totalMarkTime) ? (_totalMarkBytes / totalMarkTime) : 0.0;
+	omrtty_printf("Mark throughput : %f bytes/ms (%f bytes in %f ms)\n\n", markThroughput, _totalMarkBytes, totalMarkTime);
+}
+
+uintptr_t
+VerboseGCLogAnalyzer::compare(const VerboseGCLogAnalyzer *baseline, double thresholdPercent) const
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	uintptr_t regressions = 0;
+
+	omrtty_printf("                   Baseline (ms)                     Candidate (ms)\n");
+	omrtty_printf("Phase            p50      p99      max            p50      p99      max     p50 %%   p99 %%\n");
+	omrtty_printf("------------------------------------------------------------------------------------------\n");
+	for (uintptr_t i = 0; i < PHASE_COUNT; i++) {
+		const VerboseGCPhaseHistogram *before = &baseline->_phases[i];
+		const VerboseGCPhaseHistogram *after = &_phases[i];
+		if ((0 == before->getCount()) || (0 == after->getCount())) {
+			omrtty_printf("%-12s (%llu samples in baseline, %llu in candidate)\n",
+				_phaseNames[i], (unsigned long long)before->getCount(), (unsigned long long)after->getCount());
+			continue;
+		}
+
+		double percentiles[] = { 50.0, 99.0 };
+		double change[2];
+		bool regressed = false;
+		for (uintptr_t p = 0; p < 2; p++) {
+			double beforeMs = before->getPercentile(percentiles[p]);
+			double afterMs = after->getPercentile(percentiles[p]);
+			change[p] = (0.0 < beforeMs) ? (((afterMs - beforeMs) * 100.0) / beforeMs) : 0.0;
+			if (((afterMs - beforeMs) > REGRESSION_MINIMUM_MS) && (((afterMs - beforeMs) * 100.0) > (beforeMs * thresholdPercent))) {
+				regressed = true;
+			}
+		}
+
+		omrtty_printf("%-12s %8.3f %8.3f %8.3f       %8.3f %8.3f %8.3f  %+6.1f  %+6.1f%s\n",
+			_phaseNames[i],
+			before->getPercentile(50.0), before->getPercentile(99.0), before->getMaximum(),
+			after->getPercentile(50.0), after->getPercentile(99.0), after->getMaximum(),
+			change[0], change[1], regressed ? "  REGRESSION" : "");
+		if (regressed) {
+			regressions += 1;
+		}
+	}
+	omrtty_printf("\n%zu phase(s) regressed by more than %.1f%%\n\n", regressions, thresholdPercent);
+
+	return regressions;
+}
@@ -0,0 +1,162 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(VERBOSEGCLOGANALYZER_HPP_)
+#define VERBOSEGCLOGANALYZER_HPP_
+
+#include "omrcomp.h"
+#include "omrport.h"
+
+#include "PauseTimeHistogram.hpp"
+
+/**
+ * Distribution of the times of one GC phase, in milliseconds as the verbose GC log reports them.  The times are
+ * counted in the same logarithmic buckets as the pause times the collector itself keeps (MM_PauseTimeHistogram), so
+ * any number of samples can be recorded in constant memory and the percentiles of both agree.
+ */
+class VerboseGCPhaseHistogram
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	MM_PauseTimeHistogram _histogram; /**< of the times in microseconds */
+	double _totalMs;
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Record a time.
+	 * @param[in] timeMs the time in milliseconds, with microsecond precision
+	 */
+	void add(double timeMs);
+
+	/**
+	 * @param[in] percentile between 0 and 100
+	 * @return the time in milliseconds which percentile percent of the recorded times do not exceed, 0 if none
+	 */
+	double getPercentile(double percentile) const { return (double)_histogram.getPercentile(percentile) / 1000.0; }
+
+	uint64_t getCount() const { return _histogram.getCount(); }
+	double getMaximum() const { return (double)_histogram.getMaximum() / 1000.0; }
+	double getTotal() const { return _totalMs; }
+
+	VerboseGCPhaseHistogram();
+};
+
+/**
+ * Streaming analyzer of verbose GC logs.  The log is read in fixed size chunks and scanned for the start tags of the
+ * elements of interest, so memory use does not depend on the size of the log, and logs much larger than memory (e.g.
+ * from production systems) can be analyzed.  Only the attributes of gc-op (mark, sweep, compact, scavenge),
+ * heap-resize (expand, contract) and gc-end (global) elements are looked at.
+ */
+class VerboseGCLogAnalyzer
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum Phase {
+		PHASE_MARK = 0,
+		PHASE_SWEEP,
+		PHASE_COMPACT,
+		PHASE_SCAVENGE,
+		PHASE_EXPAND,
+		PHASE_CONTRACT,
+		PHASE_GLOBAL_GC, /**< duration of global collections, from gc-end */
+		PHASE_COUNT
+	};
+
+protected:
+private:
+	enum {
+		READ_BUFFER_SIZE = 64 * 1024,
+		TAG_BUFFER_SIZE = 4 * 1024, /**< longer tags are ignored */
+		ATTRIBUTE_BUFFER_SIZE = 64
+	};
+
+	enum ScanState {
+		SCAN_TEXT = 0,
+		SCAN_TAG,
+		SCAN_COMMENT
+	};
+
+	static const char * const _phaseNames[PHASE_COUNT];
+
+	OMRPortLibrary *_portLibrary;
+	VerboseGCPhaseHistogram _phases[PHASE_COUNT];
+	double _totalMarkBytes; /**< bytes scanned by mark, from the trace-info of mark gc-ops */
+	bool _inMarkOp; /**< the scan is inside a mark gc-op element */
+
+	ScanState _scanState;
+	bool _inQuotes;
+	bool _tagOverflow;
+	uintptr_t _tagLength;
+	char _tag[TAG_BUFFER_SIZE];
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Analyze a verbose GC log, adding to the statistics of any log analyzed before.
+	 * @param[in] fileName the log
+	 * @return false if the log could not be read
+	 */
+	bool analyze(const char *fileName);
+
+	/**
+	 * Print the statistics of each phase.
+	 */
+	void report() const;
+
+	/**
+	 * Print the statistics of each phase next to those of a baseline run, flagging the phases whose median or 99th
+	 * percentile time grew by more than thresholdPercent (and by more than REGRESSION_MINIMUM_MS, so that the noise
+	 * of very short phases is not reported).
+	 * @param[in] baseline the analyzer of the baseline run
+	 * @param[in] thresholdPercent growth tolerated before a phase is flagged
+	 * @return the number of phases flagged
+	 */
+	uintptr_t compare(const VerboseGCLogAnalyzer *baseline, double thresholdPercent) const;
+
+	const VerboseGCPhaseHistogram *getPhase(Phase phase) const { return &_phases[phase]; }
+	static const char *getPhaseName(Phase phase) { return _phaseNames[phase]; }
+
+	VerboseGCLogAnalyzer(OMRPortLibrary *portLibrary);
+
+private:
+	void scan(const char *buffer, uintptr_t length);
+	void handleTag();
+	void handleStartTag(const char *name, uintptr_t nameLength, bool isEmptyElement);
+
+	/**
+	 * Find an attribute of the current tag.
+	 * @param[in] name the attribute name
+	 * @param[out] value the attribute value, truncated to ATTRIBUTE_BUFFER_SIZE - 1 characters
+	 * @return false if the tag has no such attribute
+	 */
+	bool getAttribute(const char *name, char *value) const;
+	bool getTimeAttribute(const char *name, double *timeMs) const;
+};
+
+#endif /* VERBOSEGCLOGANALYZER_HPP_ */
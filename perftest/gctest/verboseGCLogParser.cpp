@@ -16,37 +16,54 @@
  *    Multiple authors (IBM Corp.) - initial implementation and documentation
  *******************************************************************************/
 
+#include <stdlib.h>
 #include <string.h>
-#include <algorithm>
-#include <vector>
-#include <iterator>
-#include <numeric>
 #include <stdio.h>
 
-#include "pugixml.hpp"
-
 #include "omr.h"
 #include "omrport.h"
 #include "omrthread.h"
 
-const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
-const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
-const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
-const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
+#include "VerboseGCLogAnalyzer.hpp"
+
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
-
-double getAvg(std::vector<double> v);
-void analyze(char* fileName, OMRPortLibrary portLibrary);
-
-int main(void)
+const double DEFAULT_REGRESSION_THRESHOLD = 10.0;
+
+/*
+ * Usage:
+ *   omrperfgctest                                   analyze (and delete) the VerboseGC* logs of the current directory
+ *   omrperfgctest <log> ...                         analyze the given logs, e.g. from production systems
+ *   omrperfgctest [-threshold=<percent>] -compare <baseline log> <candidate log>
+ *                                                   report the phases whose p50 or p99 regressed by more than
+ *                                                   <percent> (default 10) in the candidate run, exit code 1 if any
+ */
+static int analyzeCurrentDirectory(OMRPortLibrary *portLibrary);
+static int analyzeFiles(OMRPortLibrary *portLibrary, int fileCount, char **fileNames);
+static int compareFiles(OMRPortLibrary *portLibrary, const char *baselineFile, const char *candidateFile, double thresholdPercent);
+
+int main(int argc, char **argv)
 {
-	int32_t totalFiles = 0;
 	intptr_t rc = 0;
-	char resultBuffer[128];
-	uintptr_t rcFile;
-	uintptr_t handle;
+	int result = 0;
 	OMRPortLibrary portLibrary;
+	double thresholdPercent = DEFAULT_REGRESSION_THRESHOLD;
+	bool compare = false;
+	int argIndex = 1;
+
+	for (; argIndex < argc; argIndex++) {
+		if (0 == strncmp(argv[argIndex], "-threshold=", strlen("-threshold="))) {
+			thresholdPercent = atof(argv[argIndex] + strlen("-threshold="));
+		} else if (0 == strcmp(argv[argIndex], "-compare")) {
+			compare = true;
+		} else {
+			break;
+		}
+	}
+	if (compare && (2 != (argc - argIndex))) {
+		fprintf(stderr, "Usage: %s [-threshold=<percent>] -compare <baseline log> <candidate log>\n", argv[0]);
+		return -1;
+	}
 
 	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
 	if (0 != rc) {
@@ -60,7 +77,28 @@ int main(void)
 		return -1;
 	}
 
-	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+	if (compare) {
+		result = compareFiles(&portLibrary, argv[argIndex], argv[argIndex + 1], thresholdPercent);
+	} else if (argIndex < argc) {
+		result = analyzeFiles(&portLibrary, argc - argIndex, argv + argIndex);
+	} else {
+		result = analyzeCurrentDirectory(&portLibrary);
+	}
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return result;
+}
+
+static int
+analyzeCurrentDirectory(OMRPortLibrary *portLibrary)
+{
+	int32_t totalFiles = 0;
+	char resultBuffer[128];
+	uintptr_t rcFile;
+	uintptr_t handle;
+
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
 
 	rcFile = handle = omrfile_findfirst(SRC_DIR, resultBuffer);
 
@@ -71,7 +109,11 @@ int main(void)
 
 	while ((uintptr_t)-1 != rcFile) {
 		if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
-			analyze(resultBuffer, portLibrary);
+			VerboseGCLogAnalyzer analyzer(portLibrary);
+			if (analyzer.analyze(resultBuffer)) {
+				omrtty_printf("\nResults for : %s\n", resultBuffer);
+				analyzer.report();
+			}
 			totalFiles++;
 			/* Clean up verbose log file */
 			omrfile_unlink(resultBuffer);
@@ -85,119 +127,38 @@ int main(void)
 	if(totalFiles < 1) {
 		omrtty_printf("Failed to find any verbose GC file to process!\n\n");
 	}
-
-	portLibrary.port_shutdown_library(&portLibrary);
-	omrthread_detach(NULL);
+	return 0;
 }
 
-double
-getAvg(std::vector<double> v)
+static int
+analyzeFiles(OMRPortLibrary *portLibrary, int fileCount, char **fileNames)
 {
-	double sum = std::accumulate(v.begin(), v.end(), 0.0);
-	double avg = sum / v.size();
-	return avg;
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	int result = 0;
+
+	for (int i = 0; i < fileCount; i++) {
+		VerboseGCLogAnalyzer analyzer(portLibrary);
+		if (analyzer.analyze(fileNames[i])) {
+			omrtty_printf("\nResults for : %s\n", fileNames[i]);
+			analyzer.report();
+		} else {
+			result = -1;
+		}
+	}
+	return result;
 }
 
-void
-analyze(char* fileName, OMRPortLibrary portLibrary)
+static int
+compareFiles(OMRPortLibrary *portLibrary, const char *baselineFile, const char *candidateFile, double thresholdPercent)
 {
-	std::vector<double> mark_values;
-	std::vector<double> sweep_values;
-	std::vector<double> expand_values;
-	std::vector<double> gcduration_values;
-
-	pugi::xpath_node_set markTimes;
-	pugi::xpath_node_set sweepTimes;
-	pugi::xpath_node_set expandTimes;
-	pugi::xpath_node_set gcTimes;
-
-	double maxMark = 0;
-	double minMark = 0;
-	double avgMark = 0;
-
-	double maxSweep = 0;
-	double minSweep = 0;
-	double avgSweep = 0;
-
-	double maxExpand = 0;
-	double minExpand = 0;
-	double avgExpand = 0;
-
-	double maxGCDuration = 0;
-	double minGCDuration = 0;
-	double avgGCDuration = 0;
-
-	pugi::xml_document doc;
-	pugi::xml_parse_result result = doc.load_file(fileName);
-
-	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
-	if(!result) {
-		omrtty_printf("Error loading file : %s\n", fileName);
-		return;
-	} else {
-		omrtty_printf("\nResults for : %s\n",fileName);
-	}
-
-	markTimes = doc.select_nodes(XPATH_GET_ALL_MARK_TIME);
-	for (pugi::xpath_node_set::const_iterator it = markTimes.begin(); it != markTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    mark_values.push_back(value);
-	}
-
-	sweepTimes = doc.select_nodes(XPATH_GET_ALL_SWEEP_TIME);
-	for (pugi::xpath_node_set::const_iterator it = sweepTimes.begin(); it != sweepTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    sweep_values.push_back(value);
-	}
-
-	expandTimes = doc.select_nodes(XPATH_GET_ALL_EXPAND_TIME);
-	for (pugi::xpath_node_set::const_iterator it = expandTimes.begin(); it != expandTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    expand_values.push_back(value);
-	}
-
-	gcTimes = doc.select_nodes(XPATH_GET_TOTAL_GC_TIME);
-	for (pugi::xpath_node_set::const_iterator it = gcTimes.begin(); it != gcTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("durationms").as_double();
-	    gcduration_values.push_back(value);
-	}
-
-	if (!mark_values.empty()) {
-		maxMark = *std::max_element(mark_values.begin(), mark_values.end());
-		minMark = *std::min_element(mark_values.begin(), mark_values.end());
-		avgMark = getAvg(mark_values);
-	}
-
-	if (!sweep_values.empty()) {
-		maxSweep = *std::max_element(sweep_values.begin(), sweep_values.end());
-		minSweep = *std::min_element(sweep_values.begin(), sweep_values.end());
-		avgSweep = getAvg(sweep_values);
-	}
-
-	if (!expand_values.empty()) {
-		maxExpand = *std::max_element(expand_values.begin(), expand_values.end());
-		minExpand = *std::min_element(expand_values.begin(), expand_values.end());
-		avgExpand = getAvg(expand_values);
-	}
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	VerboseGCLogAnalyzer baseline(portLibrary);
+	VerboseGCLogAnalyzer candidate(portLibrary);
 
-	if (!gcduration_values.empty()) {
-		maxGCDuration = *std::max_element(gcduration_values.begin(), gcduration_values.end());
-		minGCDuration = *std::min_element(gcduration_values.begin(), gcduration_values.end());
-		avgGCDuration = getAvg(gcduration_values);
+	if (!baseline.analyze(baselineFile) || !candidate.analyze(candidateFile)) {
+		return -1;
 	}
 
-	omrtty_printf("            Mark           Sweep          Expand        GCDuration\n");
-	omrtty_printf("-------------------------------------------------------------------\n");
-	omrtty_printf("Max     : %f        %f        %f        %f\n",
-						maxMark, maxSweep, maxExpand, maxGCDuration);
-
-	omrtty_printf("Min     : %f        %f        %f        %f\n",
-								minMark, minSweep, minExpand, minGCDuration);
-
-	omrtty_printf("Average : %f        %f        %f        %f\n\n",
-								avgMark, avgSweep, avgExpand, avgGCDuration);
+	omrtty_printf("\nBaseline  : %s\nCandidate : %s\n\n", baselineFile, candidateFile);
+	return (0 == candidate.compare(&baseline, thresholdPercent)) ? 0 : 1;
 }
@@ -0,0 +1,239 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "VerboseBinaryConverter.hpp"
+#include "VerboseBinaryFormat.hpp"
+
+static uint32_t
+swap32(uint32_t value)
+{
+	return ((value & 0xFF) << 24) | ((value & 0xFF00) << 8) | ((value >> 8) & 0xFF00) | (value >> 24);
+}
+
+static uint64_t
+swap64(uint64_t value)
+{
+	return ((uint64_t)swap32((uint32_t)value) << 32) | swap32((uint32_t)(value >> 32));
+}
+
+/**
+ * The state of a conversion, so that the helpers can share it.
+ */
+struct VerboseBinaryConversion {
+	FILE *output;
+	bool swap; /**< true if the log was written on a machine with the other byte order */
+	uint32_t pointerSize; /**< the size of a pointer on the machine which wrote the log */
+	char **formats; /**< the formats defined so far, indexed by id */
+	uint32_t formatCount; /**< the number of entries of formats */
+};
+
+static uint32_t
+read32(VerboseBinaryConversion *conversion, const char *data)
+{
+	uint32_t value = 0;
+	memcpy(&value, data, sizeof(value));
+	return conversion->swap ? swap32(value) : value;
+}
+
+static uint64_t
+read64(VerboseBinaryConversion *conversion, const char *data)
+{
+	uint64_t value = 0;
+	memcpy(&value, data, sizeof(value));
+	return conversion->swap ? swap64(value) : value;
+}
+
+static const char *
+defineFormat(VerboseBinaryConversion *conversion, const char *payload, uint32_t length)
+{
+	if ((length <= sizeof(uint32_t)) || ('\0' != payload[length - 1])) {
+		return "malformed format record";
+	}
+	uint32_t formatId = read32(conversion, payload);
+	if (formatId >= VERBOSEGC_BINARY_FORMAT_COUNT) {
+		return "malformed format record";
+	}
+	if (formatId >= conversion->formatCount) {
+		uint32_t formatCount = formatId + 1;
+		char **formats = (char **)realloc(conversion->formats, formatCount * sizeof(char *));
+		if (NULL == formats) {
+			return "out of memory";
+		}
+		memset(formats + conversion->formatCount, 0, (formatCount - conversion->formatCount) * sizeof(char *));
+		conversion->formats = formats;
+		conversion->formatCount = formatCount;
+	}
+	const char *format = payload + sizeof(uint32_t);
+	char *copy = (char *)malloc(strlen(format) + 1);
+	if (NULL == copy) {
+		return "out of memory";
+	}
+	strcpy(copy, format);
+	free(conversion->formats[formatId]);
+	conversion->formats[formatId] = copy;
+	return NULL;
+}
+
+static const char *
+writeEvent(VerboseBinaryConversion *conversion, const char *payload, uint32_t length)
+{
+	if (length < (2 * sizeof(uint32_t))) {
+		return "malformed event record";
+	}
+	uint32_t formatId = read32(conversion, payload);
+	uint32_t indent = read32(conversion, payload + sizeof(uint32_t));
+	if ((formatId >= conversion->formatCount) || (NULL == conversion->formats[formatId])) {
+		return "event record with an undefined format";
+	}
+	const char *cursor = conversion->formats[formatId];
+	const char *args = payload + (2 * sizeof(uint32_t));
+	const char *argsEnd = payload + length;
+
+	for (uint32_t i = 0; i < indent; i++) {
+		fputs(VERBOSEGC_INDENT_SPACER, conversion->output);
+	}
+
+	for (;;) {
+		const char *start = NULL;
+		uintptr_t conversionLength = 0;
+		VerboseArgumentType type = verboseNextConversion(cursor, &start, &conversionLength);
+		fwrite(cursor, 1, start - cursor, conversion->output);
+		if (VERBOSEGC_ARGUMENT_UNSUPPORTED == type) {
+			return "event record with an unsupported format";
+		}
+		if (0 == conversionLength) {
+			break;
+		}
+		cursor = start + conversionLength;
+
+		char spec[VERBOSEGC_CONVERSION_MAX_LENGTH + 3];
+		verboseCopyConversion(spec, start, conversionLength, type);
+		switch (type) {
+		case VERBOSEGC_ARGUMENT_NONE:
+			fputc('%', conversion->output);
+			break;
+		case VERBOSEGC_ARGUMENT_STRING:
+		{
+			const char *end = (const char *)memchr(args, '\0', argsEnd - args);
+			if (NULL == end) {
+				return "event record too short for its format";
+			}
+			fprintf(conversion->output, spec, args);
+			args = end + 1;
+			break;
+		}
+		default:
+		{
+			if ((uintptr_t)(argsEnd - args) < sizeof(uint64_t)) {
+				return "event record too short for its format";
+			}
+			uint64_t value = read64(conversion, args);
+			args += sizeof(uint64_t);
+			if (VERBOSEGC_ARGUMENT_DOUBLE == type) {
+				double doubleValue = 0.0;
+				memcpy(&doubleValue, &value, sizeof(doubleValue));
+				fprintf(conversion->output, spec, doubleValue);
+			} else if (VERBOSEGC_ARGUMENT_POINTER == type) {
+				/* the way omrstr_printf prints a pointer, as all the hex digits of the writer's pointer size */
+				fprintf(conversion->output, "%0*llX", (int)(2 * conversion->pointerSize), (unsigned long long)value);
+			} else if ('c' == start[conversionLength - 1]) {
+				fprintf(conversion->output, spec, (int)value);
+			} else {
+				fprintf(conversion->output, spec, (long long)value);
+			}
+			break;
+		}
+		}
+	}
+	fputc('\n', conversion->output);
+	return NULL;
+}
+
+const char *
+convertVerboseBinaryLog(FILE *input, FILE *output)
+{
+	const char *error = NULL;
+	char fileHeader[VERBOSEGC_BINARY_MAGIC_LENGTH + (2 * sizeof(uint32_t))];
+	VerboseBinaryConversion conversion;
+	conversion.output = output;
+	conversion.swap = false;
+	conversion.pointerSize = 0;
+	conversion.formats = NULL;
+	conversion.formatCount = 0;
+	char *payload = NULL;
+	uint32_t payloadSize = 0;
+
+	if ((1 != fread(fileHeader, sizeof(fileHeader), 1, input)) || (0 != memcmp(fileHeader, VERBOSEGC_BINARY_MAGIC, VERBOSEGC_BINARY_MAGIC_LENGTH))) {
+		return "not a binary verbose GC log";
+	}
+	uint32_t version = read32(&conversion, fileHeader + VERBOSEGC_BINARY_MAGIC_LENGTH);
+	if (VERBOSEGC_BINARY_VERSION != version) {
+		conversion.swap = true;
+		version = swap32(version);
+		if (VERBOSEGC_BINARY_VERSION != version) {
+			return "unsupported binary verbose GC log version";
+		}
+	}
+	conversion.pointerSize = read32(&conversion, fileHeader + VERBOSEGC_BINARY_MAGIC_LENGTH + sizeof(uint32_t));
+
+	VerboseBinaryRecord record;
+	while ((NULL == error) && (1 == fread(&record, sizeof(record), 1, input))) {
+		uint32_t type = conversion.swap ? swap32(record.type) : record.type;
+		uint32_t length = conversion.swap ? swap32(record.length) : record.length;
+		if (length > payloadSize) {
+			char *newPayload = (char *)realloc(payload, length);
+			if (NULL == newPayload) {
+				error = "out of memory";
+				break;
+			}
+			payload = newPayload;
+			payloadSize = length;
+		}
+		if ((0 != length) && (1 != fread(payload, length, 1, input))) {
+			error = "truncated record";
+			break;
+		}
+		switch (type) {
+		case VERBOSEGC_BINARY_TEXT:
+			fwrite(payload, 1, length, output);
+			break;
+		case VERBOSEGC_BINARY_FORMAT:
+			error = defineFormat(&conversion, payload, length);
+			break;
+		case VERBOSEGC_BINARY_EVENT:
+			error = writeEvent(&conversion, payload, length);
+			break;
+		default:
+			error = "unknown record type";
+			break;
+		}
+	}
+	if ((NULL == error) && ferror(input)) {
+		error = "read error";
+	}
+
+	for (uint32_t i = 0; i < conversion.formatCount; i++) {
+		free(conversion.formats[i]);
+	}
+	free(conversion.formats);
+	free(payload);
+	return error;
+}
@@ -0,0 +1,33 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYCONVERTER_HPP_)
+#define VERBOSEBINARYCONVERTER_HPP_
+
+#include <stdio.h>
+
+/**
+ * Convert a verbose GC log written with -Xgc:binaryLogging to the XML the other verbose GC writers produce.
+ * A log written on a machine with the other byte order is converted too.
+ * @param[in] input the binary log, opened for binary reading
+ * @param[in] output the stream the XML is written to
+ * @return NULL on success, otherwise a description of what is wrong with the input
+ */
+const char *convertVerboseBinaryLog(FILE *input, FILE *output);
+
+#endif /* VERBOSEBINARYCONVERTER_HPP_ */
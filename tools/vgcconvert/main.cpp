@@ -0,0 +1,61 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "VerboseBinaryConverter.hpp"
+
+/**
+ * vgcconvert <binary log> [<XML log>]
+ * Converts a verbose GC log written with -Xgc:binaryLogging to XML, written to stdout if no output file is given.
+ */
+int
+main(int argc, char **argv)
+{
+	if ((argc < 2) || (argc > 3) || (0 == strcmp(argv[1], "-help"))) {
+		fprintf(stderr, "Usage: %s <binary verbose GC log> [<XML verbose GC log>]\n", argv[0]);
+		return 1;
+	}
+
+	FILE *input = fopen(argv[1], "rb");
+	if (NULL == input) {
+		fprintf(stderr, "%s: could not open %s\n", argv[0], argv[1]);
+		return 1;
+	}
+	FILE *output = stdout;
+	if (3 == argc) {
+		output = fopen(argv[2], "w");
+		if (NULL == output) {
+			fprintf(stderr, "%s: could not open %s\n", argv[0], argv[2]);
+			fclose(input);
+			return 1;
+		}
+	}
+
+	const char *error = convertVerboseBinaryLog(input, output);
+	if (NULL != error) {
+		fprintf(stderr, "%s: %s: %s\n", argv[0], argv[1], error);
+	}
+
+	fclose(input);
+	if (stdout != output) {
+		fclose(output);
+	}
+	return (NULL == error) ? 0 : 1;
+}